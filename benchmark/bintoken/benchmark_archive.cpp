@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/buffer/vector.hpp>
+#include <trial/protocol/bintoken/serialization.hpp>
+#include <trial/protocol/json/serialization.hpp>
+
+namespace json = trial::protocol::json;
+namespace bintoken = trial::protocol::bintoken;
+
+// JSON and bintoken archives are measured on the same STL containers. The
+// encoded size is reported as a counter.
+
+namespace
+{
+
+struct json_encoding
+{
+    using buffer_type = std::string;
+    using oarchive = json::oarchive;
+    using iarchive = json::iarchive;
+};
+
+struct bintoken_encoding
+{
+    using buffer_type = std::vector<std::uint8_t>;
+    using oarchive = bintoken::oarchive;
+    using iarchive = bintoken::iarchive;
+};
+
+template <typename> struct make;
+
+template <>
+struct make<std::vector<std::int64_t>>
+{
+    static std::vector<std::int64_t> value(int size)
+    {
+        std::vector<std::int64_t> result;
+        for (int i = 0; i < size; ++i)
+        {
+            result.push_back(std::int64_t(i) << 20);
+        }
+        return result;
+    }
+};
+
+template <>
+struct make<std::vector<double>>
+{
+    static std::vector<double> value(int size)
+    {
+        return std::vector<double>(size, 3.14);
+    }
+};
+
+template <>
+struct make<std::vector<std::string>>
+{
+    static std::vector<std::string> value(int size)
+    {
+        return std::vector<std::string>(size, "alpha bravo charlie");
+    }
+};
+
+template <>
+struct make<std::map<std::string, std::int64_t>>
+{
+    static std::map<std::string, std::int64_t> value(int size)
+    {
+        std::map<std::string, std::int64_t> result;
+        for (int i = 0; i < size; ++i)
+        {
+            result["key" + std::to_string(i)] = i;
+        }
+        return result;
+    }
+};
+
+template <typename Encoding, typename T>
+typename Encoding::buffer_type save(const T& data)
+{
+    typename Encoding::buffer_type result;
+    typename Encoding::oarchive ar(result);
+    ar << data;
+    return result;
+}
+
+} // anonymous namespace
+
+template <typename Encoding, typename T>
+void save_container(benchmark::State& state)
+{
+    const T data = make<T>::value(state.range(0));
+    typename Encoding::buffer_type output;
+    for (auto _ : state)
+    {
+        output.clear();
+        typename Encoding::oarchive ar(output);
+        ar << data;
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["size"] = output.size();
+}
+
+template <typename Encoding, typename T>
+void load_container(benchmark::State& state)
+{
+    const auto input = save<Encoding>(make<T>::value(state.range(0)));
+    for (auto _ : state)
+    {
+        T data;
+        typename Encoding::iarchive ar(input);
+        ar >> data;
+        benchmark::DoNotOptimize(data);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["size"] = input.size();
+}
+
+#define TRIAL_BENCHMARK_CONTAINER(type) \
+    BENCHMARK_TEMPLATE(save_container, json_encoding, type)->Arg(16)->Arg(4096); \
+    BENCHMARK_TEMPLATE(save_container, bintoken_encoding, type)->Arg(16)->Arg(4096); \
+    BENCHMARK_TEMPLATE(load_container, json_encoding, type)->Arg(16)->Arg(4096); \
+    BENCHMARK_TEMPLATE(load_container, bintoken_encoding, type)->Arg(16)->Arg(4096)
+
+using int_vector = std::vector<std::int64_t>;
+using real_vector = std::vector<double>;
+using string_vector = std::vector<std::string>;
+using string_map = std::map<std::string, std::int64_t>;
+
+TRIAL_BENCHMARK_CONTAINER(int_vector);
+TRIAL_BENCHMARK_CONTAINER(real_vector);
+TRIAL_BENCHMARK_CONTAINER(string_vector);
+TRIAL_BENCHMARK_CONTAINER(string_map);
+
+BENCHMARK_MAIN();
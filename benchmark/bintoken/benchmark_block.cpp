@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <trial/protocol/buffer/vector.hpp>
+#include <trial/protocol/bintoken/reader.hpp>
+#include <trial/protocol/bintoken/writer.hpp>
+#include <trial/protocol/bintoken/block_reader.hpp>
+#include <trial/protocol/bintoken/block_writer.hpp>
+
+namespace bintoken = trial::protocol::bintoken;
+namespace token = bintoken::token;
+
+// The container size is reported as the "bytes" counter.
+
+namespace
+{
+
+std::vector<std::uint8_t> make_block(std::size_t records)
+{
+    std::vector<std::uint8_t> result;
+    bintoken::writer writer(result);
+    writer.value<token::begin_array>();
+    for (std::size_t i = 0; i < records; ++i)
+    {
+        writer.value<token::begin_record>();
+        writer.value("identifier");
+        writer.value(std::int64_t(i) << 20);
+        writer.value("name");
+        writer.value("alpha bravo charlie");
+        writer.value("ratio");
+        writer.value(0.5 * (i % 16));
+        writer.value<token::end_record>();
+    }
+    writer.value<token::end_array>();
+    return result;
+}
+
+std::vector<std::uint8_t> make_container(const std::vector<std::uint8_t>& block,
+                                         std::size_t count)
+{
+    std::vector<std::uint8_t> result;
+    bintoken::block_writer writer(result);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        writer.write(block);
+    }
+    writer.close();
+    return result;
+}
+
+} // anonymous namespace
+
+void write_blocks(benchmark::State& state)
+{
+    const auto block = make_block(state.range(0));
+    std::size_t bytes = 0;
+    for (auto _ : state)
+    {
+        auto output = make_container(block, 16);
+        bytes = output.size();
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 16 * block.size());
+    state.counters["bytes"] = bytes;
+}
+BENCHMARK(write_blocks)->Arg(64)->Arg(1024);
+
+void read_blocks(benchmark::State& state)
+{
+    const auto block = make_block(state.range(0));
+    const auto input = make_container(block, 16);
+    std::vector<std::uint8_t> output;
+    for (auto _ : state)
+    {
+        bintoken::block_reader reader(input);
+        std::size_t tokens = 0;
+        for (std::size_t i = 0; i < reader.size(); ++i)
+        {
+            reader.read(i, output);
+            bintoken::reader tokenizer(output);
+            do
+            {
+                ++tokens;
+            } while (tokenizer.next());
+        }
+        benchmark::DoNotOptimize(tokens);
+    }
+    state.SetBytesProcessed(state.iterations() * 16 * block.size());
+    state.counters["bytes"] = input.size();
+}
+BENCHMARK(read_blocks)->Arg(64)->Arg(1024);
+
+BENCHMARK_MAIN();
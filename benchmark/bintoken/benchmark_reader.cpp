@@ -9,9 +9,12 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <array>
+#include <vector>
 #include <benchmark/benchmark.h>
 #include <trial/protocol/buffer/array.hpp>
+#include <trial/protocol/buffer/vector.hpp>
 #include <trial/protocol/bintoken/reader.hpp>
+#include <trial/protocol/bintoken/writer.hpp>
 
 namespace bintoken = trial::protocol::bintoken;
 
@@ -131,4 +134,59 @@ void parse_compact_array8(benchmark::State& state)
 BENCHMARK(parse_compact_array8);
 BENCHMARK(value_compact_array8);
 
+template <typename T>
+std::vector<std::uint8_t> make_compact_array(std::size_t size)
+{
+    std::vector<T> data(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        data[i] = T(i);
+    }
+    std::vector<std::uint8_t> result;
+    bintoken::writer writer(result);
+    writer.array(data.data(), data.size());
+    return result;
+}
+
+template <typename T>
+void value_compact_array(benchmark::State& state)
+{
+    const auto input = make_compact_array<T>(state.range(0));
+    bintoken::reader reader(input);
+    std::vector<T> output(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(reader.array<T>(output.data(), output.size()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename T>
+void view_compact_array(benchmark::State& state)
+{
+    // Payload is aligned because the vector storage is
+    std::vector<std::uint8_t> input;
+    {
+        std::vector<T> data(state.range(0));
+        bintoken::writer writer(input);
+        writer.align_arrays(true);
+        writer.array(data.data(), data.size());
+    }
+    bintoken::reader reader(input);
+    for (auto _ : state)
+    {
+        auto view = reader.array_view<T>();
+        benchmark::DoNotOptimize(view.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(value_compact_array, std::int16_t)->Arg(16)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(value_compact_array, std::int32_t)->Arg(16)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(value_compact_array, std::int64_t)->Arg(16)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(value_compact_array, float)->Arg(16)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(value_compact_array, double)->Arg(16)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(view_compact_array, double)->Arg(16)->Arg(1024)->Arg(65536);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/buffer/vector.hpp>
+#include <trial/protocol/bintoken/transcode.hpp>
+
+namespace json = trial::protocol::json;
+namespace bintoken = trial::protocol::bintoken;
+
+// Throughput is measured against the size of the input document.
+
+namespace
+{
+
+std::string make_document(std::size_t records)
+{
+    std::string result;
+    json::writer writer(result);
+    writer.value<json::token::begin_array>();
+    for (std::size_t i = 0; i < records; ++i)
+    {
+        writer.value<json::token::begin_object>();
+        writer.value("identifier");
+        writer.value(std::int64_t(i) << 20);
+        writer.value("name");
+        writer.value("alpha bravo charlie");
+        writer.value("ratio");
+        writer.value(0.5 * (i % 16));
+        writer.value("tags");
+        writer.value<json::token::begin_array>();
+        writer.value(true);
+        writer.value<json::token::null>();
+        writer.value<json::token::end_array>();
+        writer.value<json::token::end_object>();
+    }
+    writer.value<json::token::end_array>();
+    return result;
+}
+
+std::vector<std::uint8_t> to_bintoken(const std::string& input)
+{
+    std::vector<std::uint8_t> result;
+    json::reader reader(input);
+    bintoken::writer writer(result);
+    bintoken::transcode(reader, writer);
+    return result;
+}
+
+} // anonymous namespace
+
+void json_to_bintoken(benchmark::State& state)
+{
+    const auto input = make_document(state.range(0));
+    std::vector<std::uint8_t> output;
+    for (auto _ : state)
+    {
+        output.clear();
+        json::reader reader(input);
+        bintoken::writer writer(output);
+        bintoken::transcode(reader, writer);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(json_to_bintoken)->Arg(64)->Arg(4096);
+
+void bintoken_to_json(benchmark::State& state)
+{
+    const auto input = to_bintoken(make_document(state.range(0)));
+    std::string output;
+    for (auto _ : state)
+    {
+        output.clear();
+        bintoken::reader reader(input);
+        json::writer writer(output);
+        bintoken::transcode(reader, writer);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(bintoken_to_json)->Arg(64)->Arg(4096);
+
+BENCHMARK_MAIN();
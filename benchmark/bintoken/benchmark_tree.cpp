@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <trial/dynamic/variable.hpp>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/buffer/vector.hpp>
+#include <trial/protocol/bintoken/parse.hpp>
+#include <trial/protocol/bintoken/format.hpp>
+#include <trial/protocol/json/parse.hpp>
+#include <trial/protocol/json/format.hpp>
+
+namespace dynamic = trial::dynamic;
+namespace json = trial::protocol::json;
+namespace bintoken = trial::protocol::bintoken;
+
+// JSON and bintoken are measured on the same dynamic variable, so the
+// items processed are comparable between the two encodings. The encoded
+// size is reported as a counter.
+
+namespace
+{
+
+// Array of objects with mixed values
+dynamic::variable make_document(int size)
+{
+    dynamic::variable result = dynamic::array::make();
+    for (int i = 0; i < size; ++i)
+    {
+        dynamic::variable element = dynamic::map::make();
+        element["identifier"] = std::int64_t(i) << 20;
+        element["name"] = "customer name";
+        element["balance"] = i * 0.5;
+        element["active"] = (i % 2 == 0);
+        element["tags"] = dynamic::array::make({ 1, 2, 3 });
+        result.insert(std::move(element));
+    }
+    return result;
+}
+
+struct json_encoding
+{
+    using buffer_type = std::string;
+
+    static buffer_type format(const dynamic::variable& data)
+    {
+        return json::format<buffer_type>(data);
+    }
+
+    static dynamic::variable parse(const buffer_type& input)
+    {
+        return json::parse(input);
+    }
+};
+
+struct bintoken_encoding
+{
+    using buffer_type = std::vector<std::uint8_t>;
+
+    static buffer_type format(const dynamic::variable& data)
+    {
+        return bintoken::format<buffer_type>(data);
+    }
+
+    static dynamic::variable parse(const buffer_type& input)
+    {
+        return bintoken::parse(input);
+    }
+};
+
+} // anonymous namespace
+
+template <typename Encoding>
+void format_document(benchmark::State& state)
+{
+    const auto data = make_document(state.range(0));
+    std::size_t size = 0;
+    for (auto _ : state)
+    {
+        auto output = Encoding::format(data);
+        size = output.size();
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["size"] = size;
+}
+BENCHMARK_TEMPLATE(format_document, json_encoding)->Arg(16)->Arg(1024);
+BENCHMARK_TEMPLATE(format_document, bintoken_encoding)->Arg(16)->Arg(1024);
+
+template <typename Encoding>
+void parse_document(benchmark::State& state)
+{
+    const auto input = Encoding::format(make_document(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Encoding::parse(input));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["size"] = input.size();
+}
+BENCHMARK_TEMPLATE(parse_document, json_encoding)->Arg(16)->Arg(1024);
+BENCHMARK_TEMPLATE(parse_document, bintoken_encoding)->Arg(16)->Arg(1024);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <trial/protocol/buffer/vector.hpp>
+#include <trial/protocol/bintoken/reader.hpp>
+#include <trial/protocol/bintoken/writer.hpp>
+
+namespace bintoken = trial::protocol::bintoken;
+
+// The encoded size is reported as the "bytes" counter so that fixed-length
+// and variable-length encodings can be compared.
+
+namespace
+{
+
+// Event stream of increasing identifiers and small counters
+std::vector<std::int64_t> make_events(std::size_t size)
+{
+    std::vector<std::int64_t> result;
+    result.reserve(size);
+    std::int64_t identifier = INT64_C(1) << 33;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        identifier += 1 + (i % 7);
+        result.push_back((i % 2 == 0) ? identifier : std::int64_t(i % 1000) * 100);
+    }
+    return result;
+}
+
+std::vector<std::int64_t> make_identifiers(std::size_t size)
+{
+    std::vector<std::int64_t> result;
+    result.reserve(size);
+    std::int64_t identifier = INT64_C(1) << 33;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        identifier += 1 + (i % 7);
+        result.push_back(identifier);
+    }
+    return result;
+}
+
+std::vector<std::uint8_t> write_values(const std::vector<std::int64_t>& data, bool variable)
+{
+    std::vector<std::uint8_t> result;
+    bintoken::writer writer(result);
+    writer.variable_integers(variable);
+    for (auto value : data)
+    {
+        writer.value(value);
+    }
+    return result;
+}
+
+std::vector<std::uint8_t> write_array(const std::vector<std::int64_t>& data, bool variable)
+{
+    std::vector<std::uint8_t> result;
+    bintoken::writer writer(result);
+    writer.variable_integers(variable);
+    writer.array(data.data(), data.size());
+    return result;
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Scalar values
+//-----------------------------------------------------------------------------
+
+void write_values(benchmark::State& state)
+{
+    const auto data = make_events(state.range(0));
+    std::size_t bytes = 0;
+    for (auto _ : state)
+    {
+        auto output = write_values(data, state.range(1));
+        bytes = output.size();
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * data.size());
+    state.counters["bytes"] = bytes;
+}
+BENCHMARK(write_values)->ArgNames({"size", "varint"})->Args({4096, 0})->Args({4096, 1});
+
+void read_values(benchmark::State& state)
+{
+    const auto data = make_events(state.range(0));
+    const auto input = write_values(data, state.range(1));
+    for (auto _ : state)
+    {
+        bintoken::reader reader(input);
+        std::int64_t sum = 0;
+        do
+        {
+            sum += reader.value<std::int64_t>();
+        } while (reader.next());
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * data.size());
+    state.counters["bytes"] = input.size();
+}
+BENCHMARK(read_values)->ArgNames({"size", "varint"})->Args({4096, 0})->Args({4096, 1});
+
+//-----------------------------------------------------------------------------
+// Arrays
+//-----------------------------------------------------------------------------
+
+void write_array(benchmark::State& state)
+{
+    const auto data = make_identifiers(state.range(0));
+    std::size_t bytes = 0;
+    for (auto _ : state)
+    {
+        auto output = write_array(data, state.range(1));
+        bytes = output.size();
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * data.size());
+    state.counters["bytes"] = bytes;
+}
+BENCHMARK(write_array)->ArgNames({"size", "delta"})->Args({65536, 0})->Args({65536, 1});
+
+void read_array(benchmark::State& state)
+{
+    const auto data = make_identifiers(state.range(0));
+    const auto input = write_array(data, state.range(1));
+    std::vector<std::int64_t> output(data.size());
+    bintoken::reader reader(input);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(reader.array(output.data(), output.size()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * data.size());
+    state.counters["bytes"] = input.size();
+}
+BENCHMARK(read_array)->ArgNames({"size", "delta"})->Args({65536, 0})->Args({65536, 1});
+
+BENCHMARK_MAIN();
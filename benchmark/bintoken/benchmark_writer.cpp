@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <trial/protocol/buffer/vector.hpp>
+#include <trial/protocol/bintoken/writer.hpp>
+
+namespace bintoken = trial::protocol::bintoken;
+namespace token = bintoken::token;
+
+// Each benchmark writes state.range(0) values into a reused buffer.
+
+void write_int64(benchmark::State& state)
+{
+    std::vector<std::uint8_t> output;
+    for (auto _ : state)
+    {
+        output.clear();
+        bintoken::writer writer(output);
+        for (std::int64_t i = 0; i < state.range(0); ++i)
+        {
+            writer.value(i << 20);
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(write_int64)->Arg(64)->Arg(4096);
+
+void write_float64(benchmark::State& state)
+{
+    std::vector<std::uint8_t> output;
+    for (auto _ : state)
+    {
+        output.clear();
+        bintoken::writer writer(output);
+        for (std::int64_t i = 0; i < state.range(0); ++i)
+        {
+            writer.value(0.5 * i);
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(write_float64)->Arg(64)->Arg(4096);
+
+void write_string(benchmark::State& state)
+{
+    const std::string short_string = "alpha";
+    const std::string long_string(state.range(1), 'A');
+    const std::string& data = (state.range(1) > 0) ? long_string : short_string;
+    std::vector<std::uint8_t> output;
+    for (auto _ : state)
+    {
+        output.clear();
+        bintoken::writer writer(output);
+        for (std::int64_t i = 0; i < state.range(0); ++i)
+        {
+            writer.value(data);
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * data.size());
+}
+BENCHMARK(write_string)->Args({64, 0})->Args({4096, 0})->Args({64, 1024});
+
+void write_array_float64(benchmark::State& state)
+{
+    const std::vector<double> data(state.range(0), 3.14);
+    std::vector<std::uint8_t> output;
+    for (auto _ : state)
+    {
+        output.clear();
+        bintoken::writer writer(output);
+        writer.array(data.data(), data.size());
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(double));
+}
+BENCHMARK(write_array_float64)->Arg(64)->Arg(4096);
+
+template <bool Prefixed>
+void write_record(benchmark::State& state)
+{
+    std::vector<std::uint8_t> output;
+    for (auto _ : state)
+    {
+        output.clear();
+        bintoken::writer writer(output);
+        writer.prefix_containers(Prefixed);
+        writer.value<token::begin_array>();
+        for (std::int64_t i = 0; i < state.range(0); ++i)
+        {
+            writer.value<token::begin_record>();
+            writer.value(i);
+            writer.value("alpha bravo charlie");
+            writer.value(0.5 * i);
+            writer.value<token::begin_array>();
+            writer.value(true);
+            writer.value<token::null>();
+            writer.value<token::end_array>();
+            writer.value<token::end_record>();
+        }
+        writer.value<token::end_array>();
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(write_record, false)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(write_record, true)->Arg(64)->Arg(4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,401 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <benchmark/benchmark.h>
+#include <trial/dynamic/variable.hpp>
+#include <trial/dynamic/compact.hpp>
+#include <trial/dynamic/shared.hpp>
+#include <trial/dynamic/algorithm/visit.hpp>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/json/parse.hpp>
+#include <trial/protocol/json/format.hpp>
+
+namespace dynamic = trial::dynamic;
+namespace json = trial::protocol::json;
+
+// The benchmarks are instantiated for each storage layout
+#define TRIAL_BENCHMARK_LAYOUT(name) \
+    BENCHMARK_TEMPLATE(name, dynamic::variable)->Apply(arguments); \
+    BENCHMARK_TEMPLATE(name, dynamic::compact_variable)->Apply(arguments); \
+    BENCHMARK_TEMPLATE(name, dynamic::shared_variable)->Apply(arguments)
+
+namespace
+{
+
+void arguments(benchmark::internal::Benchmark *benchmark)
+{
+    benchmark->Arg(16)->Arg(256)->Arg(4096);
+}
+
+template <typename> struct layout;
+
+template <typename Allocator>
+struct layout<dynamic::basic_variable<Allocator>>
+{
+    using allocator_type = Allocator;
+    using array = dynamic::basic_array<Allocator>;
+    using map = dynamic::basic_map<Allocator>;
+};
+
+std::string make_key(int index)
+{
+    return "key" + std::to_string(index);
+}
+
+template <typename T>
+T make_array(int size)
+{
+    T result = layout<T>::array::make();
+    for (int i = 0; i < size; ++i)
+    {
+        result.insert(i);
+    }
+    return result;
+}
+
+template <typename T>
+T make_map(int size)
+{
+    T result = layout<T>::map::make();
+    for (int i = 0; i < size; ++i)
+    {
+        result[make_key(i)] = i;
+    }
+    return result;
+}
+
+// Array of objects with mixed values
+template <typename T>
+T make_document(int size)
+{
+    T result = layout<T>::array::make();
+    for (int i = 0; i < size; ++i)
+    {
+        T element = layout<T>::map::make();
+        element["identifier"] = i;
+        element["name"] = "customer name";
+        element["balance"] = i * 0.5;
+        element["active"] = (i % 2 == 0);
+        element["tags"] = layout<T>::array::make({ 1, 2, 3 });
+        result.insert(std::move(element));
+    }
+    return result;
+}
+
+struct counting_visitor
+{
+    template <typename U>
+    void operator()(const U&) { ++count; }
+
+    std::size_t count = 0;
+};
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Construction
+//-----------------------------------------------------------------------------
+
+template <typename T>
+void construct_array(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(make_array<T>(state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(construct_array);
+
+template <typename T>
+void construct_map(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(make_map<T>(state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(construct_map);
+
+//-----------------------------------------------------------------------------
+// Element access
+//-----------------------------------------------------------------------------
+
+template <typename T>
+void index_array(benchmark::State& state)
+{
+    const T data = make_array<T>(state.range(0));
+    const auto size = data.size();
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            benchmark::DoNotOptimize(data[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(index_array);
+
+template <typename T>
+void index_map(benchmark::State& state)
+{
+    const T data = make_map<T>(state.range(0));
+    std::vector<std::string> keys;
+    for (int i = 0; i < state.range(0); ++i)
+    {
+        keys.push_back(make_key(i));
+    }
+    for (auto _ : state)
+    {
+        for (const auto& key : keys)
+        {
+            benchmark::DoNotOptimize(data[key]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(index_map);
+
+//-----------------------------------------------------------------------------
+// Iteration
+//-----------------------------------------------------------------------------
+
+template <typename T>
+void iterate_array(benchmark::State& state)
+{
+    const T data = make_array<T>(state.range(0));
+    for (auto _ : state)
+    {
+        for (auto it = data.begin(); it != data.end(); ++it)
+        {
+            benchmark::DoNotOptimize(*it);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(iterate_array);
+
+template <typename T>
+void iterate_map(benchmark::State& state)
+{
+    const T data = make_map<T>(state.range(0));
+    for (auto _ : state)
+    {
+        for (auto it = data.begin(); it != data.end(); ++it)
+        {
+            benchmark::DoNotOptimize(*it);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(iterate_map);
+
+template <typename T>
+void iterate_map_key(benchmark::State& state)
+{
+    const T data = make_map<T>(state.range(0));
+    for (auto _ : state)
+    {
+        for (auto it = data.key_begin(); it != data.key_end(); ++it)
+        {
+            benchmark::DoNotOptimize(*it);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(iterate_map_key);
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template <typename T>
+void insert_erase_array(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        T data = make_array<T>(state.range(0));
+        while (!data.empty())
+        {
+            data.erase(data.begin());
+        }
+        benchmark::DoNotOptimize(data);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(insert_erase_array);
+
+template <typename T>
+void insert_erase_map(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        T data = make_map<T>(state.range(0));
+        while (!data.empty())
+        {
+            data.erase(data.begin());
+        }
+        benchmark::DoNotOptimize(data);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(insert_erase_map);
+
+//-----------------------------------------------------------------------------
+// Comparison
+//-----------------------------------------------------------------------------
+
+template <typename T>
+void equal_document(benchmark::State& state)
+{
+    const T lhs = make_document<T>(state.range(0));
+    const T rhs = make_document<T>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lhs == rhs);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(equal_document);
+
+template <typename T>
+void less_map(benchmark::State& state)
+{
+    const T lhs = make_map<T>(state.range(0));
+    // Every value is larger so all elements are compared
+    T rhs = make_map<T>(state.range(0));
+    for (auto& element : rhs)
+    {
+        element += 1;
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lhs < rhs);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(less_map);
+
+//-----------------------------------------------------------------------------
+// Visitation
+//-----------------------------------------------------------------------------
+
+template <typename T>
+void visit_array(benchmark::State& state)
+{
+    const T data = make_document<T>(state.range(0));
+    for (auto _ : state)
+    {
+        counting_visitor visitor;
+        for (const auto& element : data)
+        {
+            for (const auto& value : element)
+            {
+                dynamic::visit(visitor, value);
+            }
+        }
+        benchmark::DoNotOptimize(visitor.count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(visit_array);
+
+//-----------------------------------------------------------------------------
+// Copy and move
+//-----------------------------------------------------------------------------
+
+template <typename T>
+void copy_document(benchmark::State& state)
+{
+    const T data = make_document<T>(state.range(0));
+    for (auto _ : state)
+    {
+        T copy(data);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(copy_document);
+
+template <typename T>
+void copy_modify_document(benchmark::State& state)
+{
+    const T data = make_document<T>(state.range(0));
+    for (auto _ : state)
+    {
+        T copy(data);
+        copy[0]["name"] = "other name";
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+TRIAL_BENCHMARK_LAYOUT(copy_modify_document);
+
+template <typename T>
+void move_document(benchmark::State& state)
+{
+    T data = make_document<T>(state.range(0));
+    for (auto _ : state)
+    {
+        T other(std::move(data));
+        data = std::move(other);
+        benchmark::DoNotOptimize(data);
+    }
+}
+TRIAL_BENCHMARK_LAYOUT(move_document);
+
+//-----------------------------------------------------------------------------
+// JSON
+//-----------------------------------------------------------------------------
+
+template <typename T>
+void json_format(benchmark::State& state)
+{
+    const T data = make_document<T>(state.range(0));
+    std::size_t bytes = 0;
+    for (auto _ : state)
+    {
+        auto output = json::format<std::string>(data);
+        bytes += output.size();
+        benchmark::DoNotOptimize(output);
+    }
+    state.SetBytesProcessed(bytes);
+}
+TRIAL_BENCHMARK_LAYOUT(json_format);
+
+template <typename T>
+void json_parse(benchmark::State& state)
+{
+    const auto input = json::format<std::string>(make_document<T>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(json::parse<std::string, typename layout<T>::allocator_type>(input));
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+TRIAL_BENCHMARK_LAYOUT(json_parse);
+
+template <typename T>
+void json_round_trip(benchmark::State& state)
+{
+    const auto input = json::format<std::string>(make_document<T>(state.range(0)));
+    for (auto _ : state)
+    {
+        auto data = json::parse<std::string, typename layout<T>::allocator_type>(input);
+        benchmark::DoNotOptimize(json::format<std::string>(data));
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+TRIAL_BENCHMARK_LAYOUT(json_round_trip);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <benchmark/benchmark.h>
+#include <trial/dynamic/variable.hpp>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/json/filter.hpp>
+#include <trial/protocol/json/parse.hpp>
+#include <trial/protocol/json/format.hpp>
+
+namespace json = trial::protocol::json;
+
+// Redacting a single field by streaming is compared against copying the
+// input and against a parse and format round trip. Throughput is measured
+// against the size of the input.
+
+namespace
+{
+
+std::string make_document(std::size_t items)
+{
+    std::string result;
+    json::writer writer(result);
+    writer.value<json::token::begin_object>();
+    writer.value("user");
+    writer.value<json::token::begin_object>();
+    writer.value("name");
+    writer.value("alpha bravo");
+    writer.value("password");
+    writer.value("charlie");
+    writer.value<json::token::end_object>();
+    writer.value("items");
+    writer.value<json::token::begin_array>();
+    for (std::size_t i = 0; i < items; ++i)
+    {
+        writer.value<json::token::begin_object>();
+        writer.value("name");
+        writer.value("delta echo foxtrot");
+        writer.value("price");
+        writer.value(0.5 * i);
+        writer.value("tags");
+        writer.value<json::token::begin_array>();
+        writer.value(std::int64_t(i) << 20);
+        writer.value(true);
+        writer.value<json::token::null>();
+        writer.value<json::token::end_array>();
+        writer.value<json::token::end_object>();
+    }
+    writer.value<json::token::end_array>();
+    writer.value<json::token::end_object>();
+    return result;
+}
+
+} // anonymous namespace
+
+void copy_document(benchmark::State& state)
+{
+    const auto input = make_document(state.range(0));
+    std::string output;
+    for (auto _ : state)
+    {
+        output.assign(input);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(copy_document)->Arg(64)->Arg(4096);
+
+void filter_document(benchmark::State& state)
+{
+    const auto input = make_document(state.range(0));
+    json::filter filter;
+    filter.replace("/user/password",
+                   [] (const json::filter::match&, json::writer& writer)
+                   {
+                       writer.value("***");
+                   });
+    std::string output;
+    for (auto _ : state)
+    {
+        output.clear();
+        json::reader reader(input);
+        json::writer writer(output);
+        filter.apply(reader, writer);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(filter_document)->Arg(64)->Arg(4096);
+
+void parse_format_document(benchmark::State& state)
+{
+    const auto input = make_document(state.range(0));
+    std::string output;
+    for (auto _ : state)
+    {
+        auto data = json::parse(input);
+        data["user"]["password"] = "***";
+        output.clear();
+        json::format(data, output);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(parse_format_document)->Arg(64)->Arg(4096);
+
+BENCHMARK_MAIN();
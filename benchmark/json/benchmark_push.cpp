@@ -0,0 +1,145 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <benchmark/benchmark.h>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/json/writer.hpp>
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/push_parser.hpp>
+
+namespace json = trial::protocol::json;
+
+// Visiting every token with the push parser is compared against a pull
+// reader loop that dispatches on the current symbol.
+
+namespace
+{
+
+std::string make_document(std::size_t items)
+{
+    std::string result;
+    json::writer writer(result);
+    writer.value<json::token::begin_array>();
+    for (std::size_t i = 0; i < items; ++i)
+    {
+        writer.value<json::token::begin_object>();
+        writer.value("name");
+        writer.value("charlie");
+        writer.value("price");
+        writer.value(0.5 * i);
+        writer.value("tags");
+        writer.value<json::token::begin_array>();
+        writer.value(std::int64_t(i) << 20);
+        writer.value(true);
+        writer.value<json::token::null>();
+        writer.value<json::token::end_array>();
+        writer.value<json::token::end_object>();
+    }
+    writer.value<json::token::end_array>();
+    return result;
+}
+
+struct counter
+{
+    std::size_t tokens = 0;
+    std::intmax_t integers = 0;
+    double reals = 0.0;
+    std::size_t characters = 0;
+};
+
+class counting_parser : public json::push_parser<counting_parser>
+{
+public:
+    bool on_null() { ++result.tokens; return true; }
+    bool on_boolean(bool) { ++result.tokens; return true; }
+    bool on_integer(std::intmax_t value) { ++result.tokens; result.integers += value; return true; }
+    bool on_real(double value) { ++result.tokens; result.reals += value; return true; }
+    bool on_string(const view_type& value) { ++result.tokens; result.characters += value.size(); return true; }
+    bool on_key(const view_type& value) { ++result.tokens; result.characters += value.size(); return true; }
+    bool on_begin_array() { ++result.tokens; return true; }
+    bool on_end_array() { ++result.tokens; return true; }
+    bool on_begin_object() { ++result.tokens; return true; }
+    bool on_end_object() { ++result.tokens; return true; }
+
+    counter result;
+};
+
+} // anonymous namespace
+
+void pull_reader(benchmark::State& state)
+{
+    const auto input = make_document(state.range(0));
+    for (auto _ : state)
+    {
+        counter result;
+        json::reader reader(input);
+        do
+        {
+            ++result.tokens;
+            switch (reader.symbol())
+            {
+            case json::token::symbol::integer:
+                result.integers += reader.value<std::intmax_t>();
+                break;
+
+            case json::token::symbol::real:
+                result.reals += reader.value<double>();
+                break;
+
+            case json::token::symbol::string:
+                result.characters += reader.literal().size() - 2;
+                break;
+
+            default:
+                break;
+            }
+        } while (reader.next());
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(pull_reader)->Arg(64)->Arg(4096);
+
+void push_parser(benchmark::State& state)
+{
+    const auto input = make_document(state.range(0));
+    for (auto _ : state)
+    {
+        counting_parser parser;
+        parser.parse(input);
+        parser.finish();
+        benchmark::DoNotOptimize(parser.result);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(push_parser)->Arg(64)->Arg(4096);
+
+void push_parser_chunked(benchmark::State& state)
+{
+    const auto input = make_document(4096);
+    const std::size_t chunk_size = state.range(0);
+    for (auto _ : state)
+    {
+        counting_parser parser;
+        for (std::size_t i = 0; i < input.size(); i += chunk_size)
+        {
+            parser.parse(json::reader::view_type(input.data() + i,
+                                                 std::min(chunk_size, input.size() - i)));
+        }
+        parser.finish();
+        benchmark::DoNotOptimize(parser.result);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(push_parser_chunked)->Arg(256)->Arg(4096);
+
+BENCHMARK_MAIN();
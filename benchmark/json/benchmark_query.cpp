@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <benchmark/benchmark.h>
+#include <trial/dynamic/variable.hpp>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/json/writer.hpp>
+#include <trial/protocol/json/parse.hpp>
+#include <trial/protocol/json/query.hpp>
+
+namespace json = trial::protocol::json;
+
+// Extracting a few fields with a query is compared against parsing the
+// entire document. Throughput is measured against the size of the input.
+
+namespace
+{
+
+std::string make_document(std::size_t items)
+{
+    std::string result;
+    json::writer writer(result);
+    writer.value<json::token::begin_object>();
+    writer.value("user");
+    writer.value<json::token::begin_object>();
+    writer.value("name");
+    writer.value("alpha bravo");
+    writer.value("id");
+    writer.value(42);
+    writer.value<json::token::end_object>();
+    writer.value("items");
+    writer.value<json::token::begin_array>();
+    for (std::size_t i = 0; i < items; ++i)
+    {
+        writer.value<json::token::begin_object>();
+        writer.value("name");
+        writer.value("charlie delta echo");
+        writer.value("price");
+        writer.value(0.5 * i);
+        writer.value("tags");
+        writer.value<json::token::begin_array>();
+        writer.value(std::int64_t(i) << 20);
+        writer.value(true);
+        writer.value<json::token::null>();
+        writer.value<json::token::end_array>();
+        writer.value<json::token::end_object>();
+    }
+    writer.value<json::token::end_array>();
+    writer.value<json::token::end_object>();
+    return result;
+}
+
+} // anonymous namespace
+
+void query_user(benchmark::State& state)
+{
+    const auto input = make_document(state.range(0));
+    const json::query query({ "/user/id" });
+    for (auto _ : state)
+    {
+        json::reader reader(input);
+        int result = 0;
+        query.evaluate(reader,
+                       [&result] (const json::query::match& entry)
+                       {
+                           result = entry.value<int>();
+                       });
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(query_user)->Arg(64)->Arg(4096);
+
+void query_prices(benchmark::State& state)
+{
+    const auto input = make_document(state.range(0));
+    const json::query query({ "/user/id", "/items/*/price" });
+    for (auto _ : state)
+    {
+        json::reader reader(input);
+        double result = 0.0;
+        query.evaluate(reader,
+                       [&result] (const json::query::match& entry)
+                       {
+                           if (entry.path == 1)
+                               result += entry.value<double>();
+                       });
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(query_prices)->Arg(64)->Arg(4096);
+
+void parse_prices(benchmark::State& state)
+{
+    const auto input = make_document(state.range(0));
+    for (auto _ : state)
+    {
+        auto data = json::parse(input);
+        double result = 0.0;
+        for (const auto& item : data["items"])
+        {
+            result += item["price"].value<double>();
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(parse_prices)->Arg(64)->Arg(4096);
+
+BENCHMARK_MAIN();
@@ -9,6 +9,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
 #include <benchmark/benchmark.h>
 #include <trial/protocol/buffer/array.hpp>
 #include <trial/protocol/json/reader.hpp>
@@ -420,4 +423,89 @@ void parse_whitespaces(benchmark::State& state)
 
 BENCHMARK(parse_whitespaces);
 
+namespace
+{
+
+std::string make_array(std::size_t size, const char *element)
+{
+    std::string result = "[";
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (i != 0)
+            result += ',';
+        result += element;
+    }
+    result += ']';
+    return result;
+}
+
+} // anonymous namespace
+
+void next_array_int64(benchmark::State& state)
+{
+    const auto input = make_array(state.range(0), "81985529216");
+    std::vector<std::int64_t> result;
+    for (auto _ : state)
+    {
+        result.clear();
+        json::reader reader(input);
+        while (reader.next() && (reader.symbol() == json::token::symbol::integer))
+        {
+            result.push_back(reader.value<std::int64_t>());
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+void values_array_int64(benchmark::State& state)
+{
+    const auto input = make_array(state.range(0), "81985529216");
+    std::vector<std::int64_t> result;
+    for (auto _ : state)
+    {
+        result.clear();
+        json::reader reader(input);
+        reader.values(result);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+void next_array_double(benchmark::State& state)
+{
+    const auto input = make_array(state.range(0), "291.192");
+    std::vector<double> result;
+    for (auto _ : state)
+    {
+        result.clear();
+        json::reader reader(input);
+        while (reader.next() && (reader.symbol() == json::token::symbol::real))
+        {
+            result.push_back(reader.value<double>());
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+void values_array_double(benchmark::State& state)
+{
+    const auto input = make_array(state.range(0), "291.192");
+    std::vector<double> result;
+    for (auto _ : state)
+    {
+        result.clear();
+        json::reader reader(input);
+        reader.values(result);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+BENCHMARK(next_array_int64)->Arg(4096);
+BENCHMARK(values_array_int64)->Arg(4096);
+BENCHMARK(next_array_double)->Arg(4096);
+BENCHMARK(values_array_double)->Arg(4096);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <trial/dynamic/variable.hpp>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/json/writer.hpp>
+#include <trial/protocol/json/parse.hpp>
+#include <trial/protocol/json/schema.hpp>
+
+namespace json = trial::protocol::json;
+
+// Decoding objects into structs with a schema is compared against parsing
+// into a dynamic::variable and copying the members from there. Encoding
+// with a schema is compared against writing keys and values one by one.
+
+namespace
+{
+
+struct item
+{
+    std::int64_t id = 0;
+    std::string name;
+    double price = 0.0;
+    bool available = false;
+};
+
+const auto item_schema = json::make_schema<item>(
+    json::field("id", &item::id),
+    json::field("name", &item::name),
+    json::field("price", &item::price),
+    json::field("available", &item::available));
+
+std::string make_document(std::size_t items)
+{
+    std::string result;
+    json::writer writer(result);
+    writer.value<json::token::begin_array>();
+    for (std::size_t i = 0; i < items; ++i)
+    {
+        writer.value<json::token::begin_object>();
+        writer.value("available");
+        writer.value(i % 2 == 0);
+        writer.value("price");
+        writer.value(0.5 * i);
+        writer.value("name");
+        writer.value("alpha");
+        writer.value("id");
+        writer.value(std::int64_t(i));
+        writer.value<json::token::end_object>();
+    }
+    writer.value<json::token::end_array>();
+    return result;
+}
+
+std::vector<item> make_items(std::size_t size)
+{
+    std::vector<item> result(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        result[i].id = i;
+        result[i].name = "alpha";
+        result[i].price = 0.5 * i;
+        result[i].available = (i % 2 == 0);
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+void schema_items(benchmark::State& state)
+{
+    const auto input = make_document(state.range(0));
+    std::vector<item> result;
+    for (auto _ : state)
+    {
+        result.clear();
+        json::reader reader(input);
+        reader.next();
+        while (reader.symbol() == json::token::symbol::begin_object)
+        {
+            result.emplace_back();
+            item_schema.read(reader, result.back());
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(schema_items)->Arg(64)->Arg(4096);
+
+void parse_items(benchmark::State& state)
+{
+    const auto input = make_document(state.range(0));
+    std::vector<item> result;
+    for (auto _ : state)
+    {
+        result.clear();
+        auto data = json::parse(input);
+        for (const auto& entry : data)
+        {
+            item current;
+            current.id = entry["id"].value<std::int64_t>();
+            current.name = entry["name"].value<std::string>();
+            current.price = entry["price"].value<double>();
+            current.available = entry["available"].value<bool>();
+            result.push_back(std::move(current));
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(parse_items)->Arg(64)->Arg(4096);
+
+void schema_write_items(benchmark::State& state)
+{
+    const auto input = make_items(state.range(0));
+    std::string result;
+    for (auto _ : state)
+    {
+        result.clear();
+        json::writer writer(result);
+        writer.value<json::token::begin_array>();
+        for (const auto& entry : input)
+        {
+            item_schema.write(writer, entry);
+        }
+        writer.value<json::token::end_array>();
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(state.iterations() * result.size());
+}
+BENCHMARK(schema_write_items)->Arg(64)->Arg(4096);
+
+void writer_items(benchmark::State& state)
+{
+    const auto input = make_items(state.range(0));
+    std::string result;
+    for (auto _ : state)
+    {
+        result.clear();
+        json::writer writer(result);
+        writer.value<json::token::begin_array>();
+        for (const auto& entry : input)
+        {
+            writer.value<json::token::begin_object>();
+            writer.value("id");
+            writer.value(entry.id);
+            writer.value("name");
+            writer.value(entry.name);
+            writer.value("price");
+            writer.value(entry.price);
+            writer.value("available");
+            writer.value(entry.available);
+            writer.value<json::token::end_object>();
+        }
+        writer.value<json::token::end_array>();
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(state.iterations() * result.size());
+}
+BENCHMARK(writer_items)->Arg(64)->Arg(4096);
+
+BENCHMARK_MAIN();
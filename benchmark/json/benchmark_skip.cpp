@@ -0,0 +1,77 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <benchmark/benchmark.h>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/json/writer.hpp>
+#include <trial/protocol/json/partial/skip.hpp>
+
+namespace json = trial::protocol::json;
+
+// Skipping a nested document with validation of every token is compared
+// against counting brackets.
+
+namespace
+{
+
+std::string make_document(std::size_t items)
+{
+    std::string result;
+    json::writer writer(result);
+    writer.value<json::token::begin_array>();
+    for (std::size_t i = 0; i < items; ++i)
+    {
+        writer.value<json::token::begin_object>();
+        writer.value("name");
+        writer.value("charlie [delta] {echo}");
+        writer.value("price");
+        writer.value(0.5 * i);
+        writer.value("tags");
+        writer.value<json::token::begin_array>();
+        writer.value(std::int64_t(i) << 20);
+        writer.value(true);
+        writer.value<json::token::null>();
+        writer.value<json::token::end_array>();
+        writer.value<json::token::end_object>();
+    }
+    writer.value<json::token::end_array>();
+    return result;
+}
+
+template <json::partial::skip_mode Mode>
+void skip_document(benchmark::State& state)
+{
+    const auto input = make_document(state.range(0));
+    for (auto _ : state)
+    {
+        json::reader reader(input);
+        auto result = json::partial::skip(reader, Mode);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+} // anonymous namespace
+
+void skip_strict(benchmark::State& state)
+{
+    skip_document<json::partial::skip_mode::strict>(state);
+}
+BENCHMARK(skip_strict)->Arg(64)->Arg(4096);
+
+void skip_relaxed(benchmark::State& state)
+{
+    skip_document<json::partial::skip_mode::relaxed>(state);
+}
+BENCHMARK(skip_relaxed)->Arg(64)->Arg(4096);
+
+BENCHMARK_MAIN();
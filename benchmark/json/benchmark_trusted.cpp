@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <benchmark/benchmark.h>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/json/writer.hpp>
+#include <trial/protocol/json/reader.hpp>
+
+namespace json = trial::protocol::json;
+
+// The same documents are read with and without validation of the input.
+
+namespace
+{
+
+std::string make_strings(std::size_t items)
+{
+    std::string result;
+    json::writer writer(result);
+    writer.value<json::token::begin_array>();
+    for (std::size_t i = 0; i < items; ++i)
+    {
+        writer.value("alpha bravo charlie delta echo foxtrot golf hotel");
+        writer.value("k\xC3\xB8" "benhavn m\xC3\xBC" "nchen \xE2\x82\xAC" "100 \xF0\x9F\x98\x80");
+        writer.value("line\nbreak \"quoted\" back\\slash");
+    }
+    writer.value<json::token::end_array>();
+    return result;
+}
+
+std::string make_numbers(std::size_t items)
+{
+    std::string result;
+    json::writer writer(result);
+    writer.value<json::token::begin_array>();
+    for (std::size_t i = 0; i < items; ++i)
+    {
+        writer.value(std::int64_t(i) << 20);
+        writer.value(-std::int64_t(i));
+        writer.value(0.25 * i);
+        writer.value(1.5e-10 * i);
+    }
+    writer.value<json::token::end_array>();
+    return result;
+}
+
+template <typename Reader>
+std::size_t count_tokens(const std::string& input)
+{
+    std::size_t result = 0;
+    Reader reader(input);
+    do
+    {
+        ++result;
+    } while (reader.next());
+    return result;
+}
+
+} // anonymous namespace
+
+template <typename Reader>
+void scan_strings(benchmark::State& state)
+{
+    const auto input = make_strings(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(count_tokens<Reader>(input));
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK_TEMPLATE(scan_strings, json::reader)->Arg(4096);
+BENCHMARK_TEMPLATE(scan_strings, json::trusted_reader)->Arg(4096);
+
+template <typename Reader>
+void scan_numbers(benchmark::State& state)
+{
+    const auto input = make_numbers(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(count_tokens<Reader>(input));
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK_TEMPLATE(scan_numbers, json::reader)->Arg(4096);
+BENCHMARK_TEMPLATE(scan_numbers, json::trusted_reader)->Arg(4096);
+
+template <typename Reader>
+void convert_strings(benchmark::State& state)
+{
+    const auto input = make_strings(state.range(0));
+    for (auto _ : state)
+    {
+        std::size_t length = 0;
+        std::string value;
+        Reader reader(input);
+        while (reader.next())
+        {
+            if (reader.symbol() != json::token::symbol::string)
+                continue;
+            value.clear();
+            reader.string(value);
+            length += value.size();
+        }
+        benchmark::DoNotOptimize(length);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK_TEMPLATE(convert_strings, json::reader)->Arg(4096);
+BENCHMARK_TEMPLATE(convert_strings, json::trusted_reader)->Arg(4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,97 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/json/writer.hpp>
+
+namespace json = trial::protocol::json;
+
+// Writing arrays element by element is compared against writing them in bulk.
+
+namespace
+{
+
+template <typename T>
+std::vector<T> make_array(std::size_t size)
+{
+    std::vector<T> result;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        result.push_back(T(i * 81985529 % 1000003) / T(7));
+    }
+    return result;
+}
+
+template <typename T>
+void value_array(benchmark::State& state)
+{
+    const auto input = make_array<T>(state.range(0));
+    std::string result;
+    for (auto _ : state)
+    {
+        result.clear();
+        json::writer writer(result);
+        writer.value<json::token::begin_array>();
+        for (const auto& entry : input)
+        {
+            writer.value(entry);
+        }
+        writer.value<json::token::end_array>();
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(state.iterations() * result.size());
+}
+
+template <typename T>
+void values_array(benchmark::State& state)
+{
+    const auto input = make_array<T>(state.range(0));
+    std::string result;
+    for (auto _ : state)
+    {
+        result.clear();
+        json::writer writer(result);
+        writer.values(input.data(), input.size());
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(state.iterations() * result.size());
+}
+
+} // anonymous namespace
+
+void value_array_int64(benchmark::State& state)
+{
+    value_array<std::int64_t>(state);
+}
+BENCHMARK(value_array_int64)->Arg(4096);
+
+void values_array_int64(benchmark::State& state)
+{
+    values_array<std::int64_t>(state);
+}
+BENCHMARK(values_array_int64)->Arg(4096);
+
+void value_array_double(benchmark::State& state)
+{
+    value_array<double>(state);
+}
+BENCHMARK(value_array_double)->Arg(4096);
+
+void values_array_double(benchmark::State& state)
+{
+    values_array<double>(state);
+}
+BENCHMARK(values_array_double)->Arg(4096);
+
+BENCHMARK_MAIN();
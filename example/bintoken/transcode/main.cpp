@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Converts between JSON and BinToken files.
+//
+//   bintoken_transcode --to-bintoken <input.json> <output.bin>
+//   bintoken_transcode --to-json <input.bin> <output.json>
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <trial/protocol/buffer/ostream.hpp>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/buffer/vector.hpp>
+#include <trial/protocol/bintoken/transcode.hpp>
+
+namespace json = trial::protocol::json;
+namespace bintoken = trial::protocol::bintoken;
+
+namespace
+{
+
+template <typename T>
+bool load(const char *name, T& buffer)
+{
+    std::ifstream input(name, std::ios::binary);
+    if (!input)
+        return false;
+    buffer.assign(std::istreambuf_iterator<char>(input),
+                  std::istreambuf_iterator<char>());
+    return true;
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        if (argc != 4)
+        {
+            std::cerr << "Usage: " << argv[0] << " (--to-bintoken | --to-json) <input> <output>" << std::endl;
+            return 1;
+        }
+
+        const std::string direction(argv[1]);
+        if (direction == "--to-bintoken")
+        {
+            std::string input;
+            if (!load(argv[2], input))
+            {
+                std::cerr << "Cannot open " << argv[2] << std::endl;
+                return 1;
+            }
+            std::vector<std::uint8_t> buffer;
+            json::reader reader(input);
+            bintoken::writer writer(buffer);
+            bintoken::transcode(reader, writer);
+
+            std::ofstream output(argv[3], std::ios::binary);
+            output.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+        }
+        else if (direction == "--to-json")
+        {
+            std::vector<std::uint8_t> input;
+            if (!load(argv[2], input))
+            {
+                std::cerr << "Cannot open " << argv[2] << std::endl;
+                return 1;
+            }
+            // JSON is streamed directly to the output file
+            std::ofstream output(argv[3]);
+            bintoken::reader reader(input);
+            json::writer writer(output);
+            bintoken::transcode(reader, writer);
+        }
+        else
+        {
+            std::cerr << "Unknown option " << direction << std::endl;
+            return 1;
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Error: " << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -25,6 +25,8 @@ template <typename Allocator, typename T>
 auto count(const basic_variable<Allocator>& self,
            const T& other) -> typename basic_variable<Allocator>::size_type
 {
+    using overloader = detail::key_overloader<Allocator, T>;
+
     switch (self.symbol())
     {
     case symbol::null:
@@ -37,19 +39,22 @@ auto count(const basic_variable<Allocator>& self,
     case symbol::wstring:
     case symbol::u16string:
     case symbol::u32string:
-        return (self == other) ? 1 : 0;
+        return overloader::equal(self, other) ? 1 : 0;
 
     case symbol::array:
-    case symbol::map:
         {
             typename basic_variable<Allocator>::size_type result = 0;
             for (auto it = self.key_begin(); it != self.key_end(); ++it)
             {
-                if (*it == other)
+                if (overloader::equal(*it, other))
                     ++result;
             }
             return result;
         }
+
+    case symbol::map:
+        // Keys are unique
+        return (overloader::find(self, other) != self.key_end()) ? 1 : 0;
     }
     TRIAL_DYNAMIC_UNREACHABLE();
 }
@@ -29,6 +29,8 @@ template <typename Allocator, typename T>
 auto find(const basic_variable<Allocator>& self,
           const T& other) -> typename basic_variable<Allocator>::key_iterator
 {
+    using overloader = detail::key_overloader<Allocator, T>;
+
     switch (self.symbol())
     {
     case symbol::null:
@@ -41,16 +43,19 @@ auto find(const basic_variable<Allocator>& self,
     case symbol::wstring:
     case symbol::u16string:
     case symbol::u32string:
-        return (self == other) ? self.key_begin() : self.key_end();
+        return overloader::equal(self, other) ? self.key_begin() : self.key_end();
 
     case symbol::array:
-    case symbol::map:
         for (auto it = self.key_begin(); it != self.key_end(); ++it)
         {
-            if (*it == other)
+            if (overloader::equal(*it, other))
                 return it;
         }
         return self.key_end();
+
+    case symbol::map:
+        // Use the ordering of the associative array
+        return overloader::find(self, other);
     }
     TRIAL_DYNAMIC_UNREACHABLE();
 }
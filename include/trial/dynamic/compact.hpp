@@ -0,0 +1,101 @@
+#ifndef TRIAL_DYNAMIC_COMPACT_HPP
+#define TRIAL_DYNAMIC_COMPACT_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2017 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <memory>
+#include <type_traits>
+#include <trial/dynamic/variable.hpp>
+
+namespace trial
+{
+namespace dynamic
+{
+
+//! @brief Allocator adaptor for compact dynamic variables.
+//!
+//! A dynamic variable using this allocator only stores values that fit into a
+//! pointer inside the variable. Strings, arrays, maps, and `long double` are
+//! placed on the heap. This reduces the size of the variable to two pointers,
+//! including the type index.
+//!
+//! Memory is obtained from the underlying allocator. The string types use the
+//! underlying allocator directly, so `compact_variable::string_type` is the
+//! same as `variable::string_type` by default.
+//!
+//! @tparam Allocator Underlying allocator (defaults to `std::allocator`)
+
+template <typename Allocator = std::allocator<char>>
+class compact_allocator
+    : public Allocator
+{
+    template <typename T>
+    using underlying_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+public:
+    template <typename T>
+    struct rebind
+    {
+        using other = typename std::conditional<detail::is_character<T>::value,
+                                                underlying_allocator<T>,
+                                                compact_allocator<underlying_allocator<T>>>::type;
+    };
+
+    compact_allocator() = default;
+
+    compact_allocator(const Allocator& alloc)
+        : Allocator(alloc)
+    {
+    }
+
+    template <typename U>
+    compact_allocator(const compact_allocator<U>& other)
+        : Allocator(static_cast<const U&>(other))
+    {
+    }
+
+    friend bool operator== (const compact_allocator& lhs, const compact_allocator& rhs)
+    {
+        return static_cast<const Allocator&>(lhs) == static_cast<const Allocator&>(rhs);
+    }
+
+    friend bool operator!= (const compact_allocator& lhs, const compact_allocator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+#if !defined(BOOST_DOXYGEN_INVOKED)
+
+namespace detail
+{
+
+template <typename Allocator>
+struct layout_traits<compact_allocator<Allocator>>
+{
+    using max_type = void *;
+
+    template <typename T>
+    using is_shared = std::false_type;
+};
+
+} // namespace detail
+
+#endif
+
+using compact_variable = basic_variable<compact_allocator<>>;
+using compact_array = basic_array<compact_allocator<>>;
+using compact_map = basic_map<compact_allocator<>>;
+
+} // namespace dynamic
+} // namespace trial
+
+#endif // TRIAL_DYNAMIC_COMPACT_HPP
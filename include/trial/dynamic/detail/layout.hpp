@@ -0,0 +1,47 @@
+#ifndef TRIAL_DYNAMIC_DETAIL_LAYOUT_HPP
+#define TRIAL_DYNAMIC_DETAIL_LAYOUT_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2017 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <type_traits>
+
+namespace trial
+{
+namespace dynamic
+{
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// layout_traits
+//-----------------------------------------------------------------------------
+
+// Storage layout of the dynamic variable is selected by the allocator.
+//
+// Alternatives larger than max_type are placed on the heap and only a pointer
+// is stored inside the variable. Heap alternatives for which is_shared is true
+// are reference-counted and shared between copies.
+
+template <typename Allocator>
+struct layout_traits
+{
+    using max_type = std::max_align_t;
+
+    template <typename T>
+    using is_shared = std::false_type;
+};
+
+} // namespace detail
+} // namespace dynamic
+} // namespace trial
+
+#endif // TRIAL_DYNAMIC_DETAIL_LAYOUT_HPP
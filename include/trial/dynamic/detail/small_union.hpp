@@ -16,6 +16,7 @@
 #include <cassert>
 #include <type_traits>
 #include <trial/dynamic/detail/meta.hpp>
+#include <trial/dynamic/detail/layout.hpp>
 #include <trial/dynamic/detail/empty_value.hpp>
 
 namespace trial
@@ -25,6 +26,8 @@ namespace dynamic
 namespace detail
 {
 
+template <std::size_t M, typename T, bool Shared = false, typename Enable = void> struct small_traits;
+
 //-----------------------------------------------------------------------------
 // small_union
 //-----------------------------------------------------------------------------
@@ -34,6 +37,11 @@ class small_union : public detail::empty_value<Allocator>
 {
     using allocator_base = detail::empty_value<Allocator>;
 
+    template <typename T>
+    using traits = small_traits<sizeof(MaxType),
+                                T,
+                                layout_traits<Allocator>::template is_shared<T>::value>;
+
     template <typename T> struct make_small;
     using typelist = meta::transform<meta::list<Types...>, make_small>;
 
@@ -55,7 +63,7 @@ public:
     const allocator_type& get_allocator() const noexcept { return allocator_base::get(); }
     allocator_type& get_allocator() noexcept { return allocator_base::get(); }
 
-    template <typename T> T& get() noexcept;
+    template <typename T> T& get();
     template <typename T> const T& get() const noexcept;
 
     template <typename Visitor, typename R> R call();
@@ -64,12 +72,16 @@ public:
     template <typename Visitor, typename R, typename... Args> R call(Args&&...) const;
 
 private:
-    template <std::size_t M, typename T, typename Enable> friend struct small_traits;
+    template <std::size_t M, typename T, bool Shared, typename Enable> friend struct small_traits;
+
+    void reset();
 
     struct reconstructor;
+    struct move_reconstructor;
     struct destructor;
     struct copier;
     struct mover;
+    struct transferer;
 
     typename std::aligned_storage<sizeof(MaxType), alignof(MaxType)>::type storage;
     index_type current;
@@ -12,6 +12,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <new>
+#include <atomic>
 #include <memory>
 
 namespace trial
@@ -25,7 +26,7 @@ namespace detail
 // small_traits
 //-----------------------------------------------------------------------------
 
-template <std::size_t M, typename T, typename Enable = void>
+template <std::size_t M, typename T, bool Shared, typename Enable>
 struct small_traits
 {
     using type = typename std::remove_reference<T>::type;
@@ -56,22 +57,41 @@ struct small_traits
         allocator_traits::destroy(typed_allocator, &deref(storage));
     }
 
-    static void copy(void *target, const void *source)
+    template <typename Allocator>
+    static void clone(Allocator& alloc, void *target, const void *source)
+    {
+        construct(alloc, target, deref(source));
+    }
+
+    template <typename Allocator>
+    static void copy(Allocator&, void *target, const void *source)
     {
         deref(target) = deref(source);
     }
 
-    static void move(void *target, const void *source)
+    template <typename Allocator>
+    static void move(Allocator&, void *target, void *source)
     {
         deref(target) = std::move(deref(source));
     }
 
+    template <typename Allocator>
+    static void transfer(Allocator& alloc, void *target, void *source)
+    {
+        // Move object and leave source storage uninitialized
+        construct(alloc, target, std::move(deref(source)));
+        destroy(alloc, source);
+    }
+
+    template <typename Allocator>
+    static type& get(Allocator&, void *storage) noexcept { return deref(storage); }
+
     static type& deref(void *storage) noexcept { return *static_cast<type *>(storage); }
     static const type& deref(const void *storage) noexcept { return *static_cast<const type *>(storage); }
 };
 
 template <std::size_t M, typename T>
-struct small_traits<M, T, typename std::enable_if<(sizeof(T) > M)>::type>
+struct small_traits<M, T, false, typename std::enable_if<(sizeof(T) > M)>::type>
 {
     using type = typename std::remove_reference<T>::type;
     using pointer = typename std::add_pointer<type>::type;
@@ -110,20 +130,176 @@ struct small_traits<M, T, typename std::enable_if<(sizeof(T) > M)>::type>
         allocator_traits::deallocate(typed_allocator, ptr, 1);
     }
 
-    static void copy(void *target, const void *source)
+    template <typename Allocator>
+    static void clone(Allocator& alloc, void *target, const void *source)
+    {
+        construct(alloc, target, deref(source));
+    }
+
+    template <typename Allocator>
+    static void copy(Allocator&, void *target, const void *source)
     {
         deref(target) = deref(source);
     }
 
-    static void move(void *target, const void *source)
+    template <typename Allocator>
+    static void move(Allocator&, void *target, void *source)
     {
         deref(target) = std::move(deref(source));
     }
 
+    template <typename Allocator>
+    static void transfer(Allocator&, void *target, void *source)
+    {
+        // Steal heap object and leave source storage uninitialized
+        ::new (target) pointer{*static_cast<pointer *>(source)};
+    }
+
+    template <typename Allocator>
+    static type& get(Allocator&, void *storage) noexcept { return deref(storage); }
+
     static type& deref(void *storage) noexcept { return **static_cast<pointer *>(storage); }
     static const type& deref(const void *storage) noexcept { return **static_cast<const pointer *>(storage); }
 };
 
+// Heap object with reference count
+template <typename T>
+struct shared_node
+{
+    template <typename... Args>
+    explicit shared_node(Args&&... args)
+        : count(1),
+          value(std::forward<Args>(args)...)
+    {
+    }
+
+    std::atomic<std::size_t> count;
+    T value;
+};
+
+// Heap object shared between copies, which is copied when modified
+template <std::size_t M, typename T>
+struct small_traits<M, T, true, typename std::enable_if<(sizeof(T) > M)>::type>
+{
+    using type = typename std::remove_reference<T>::type;
+    using node_type = shared_node<type>;
+    using pointer = typename std::add_pointer<node_type>::type;
+    using small_type = pointer;
+
+    static_assert(M >= sizeof(pointer), "N must be larger than a pointer");
+
+    template <typename Allocator, typename... Args>
+    static void construct(Allocator& alloc, void *storage, Args&&... args)
+    {
+        ::new (storage) pointer{create(alloc, std::forward<Args>(args)...)};
+    }
+
+    template <typename Allocator>
+    static void destroy(Allocator& alloc, void *storage)
+    {
+        release(alloc, node(storage));
+    }
+
+    template <typename Allocator>
+    static void clone(Allocator&, void *target, const void *source)
+    {
+        ::new (target) pointer{acquire(node(source))};
+    }
+
+    template <typename Allocator>
+    static void copy(Allocator& alloc, void *target, const void *source)
+    {
+        if (node(target) == node(source))
+            return;
+        release(alloc, node(target));
+        node(target) = acquire(node(source));
+    }
+
+    template <typename Allocator>
+    static void move(Allocator& alloc, void *target, void *source)
+    {
+        // Source may be shared so it is copied
+        pointer ptr = create(alloc, deref(source));
+        release(alloc, node(target));
+        node(target) = ptr;
+    }
+
+    template <typename Allocator>
+    static void transfer(Allocator&, void *target, void *source)
+    {
+        ::new (target) pointer{node(source)};
+    }
+
+    template <typename Allocator>
+    static type& get(Allocator& alloc, void *storage)
+    {
+        // Detach before modification
+        if (node(storage)->count.load(std::memory_order_acquire) != 1)
+        {
+            pointer ptr = create(alloc, deref(storage));
+            release(alloc, node(storage));
+            node(storage) = ptr;
+        }
+        return deref(storage);
+    }
+
+    static type& deref(void *storage) noexcept { return node(storage)->value; }
+    static const type& deref(const void *storage) noexcept { return node(storage)->value; }
+
+    static bool unique(const void *storage) noexcept
+    {
+        return node(storage)->count.load(std::memory_order_acquire) == 1;
+    }
+
+private:
+    static pointer& node(void *storage) noexcept { return *static_cast<pointer *>(storage); }
+    static pointer node(const void *storage) noexcept { return *static_cast<const pointer *>(storage); }
+
+    template <typename Allocator, typename... Args>
+    static pointer create(Allocator& alloc, Args&&... args)
+    {
+        using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+        using allocator_traits = typename std::allocator_traits<allocator_type>;
+
+        allocator_type typed_allocator(alloc);
+
+        auto ptr = allocator_traits::allocate(typed_allocator, 1);
+        if (!ptr) throw std::bad_alloc{};
+        try
+        {
+            allocator_traits::construct(typed_allocator,
+                                        std::addressof(*ptr),
+                                        std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            allocator_traits::deallocate(typed_allocator, ptr, 1);
+            throw;
+        }
+        return std::addressof(*ptr);
+    }
+
+    static pointer acquire(pointer ptr) noexcept
+    {
+        ptr->count.fetch_add(1, std::memory_order_relaxed);
+        return ptr;
+    }
+
+    template <typename Allocator>
+    static void release(Allocator& alloc, pointer ptr)
+    {
+        using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+        using allocator_traits = typename std::allocator_traits<allocator_type>;
+
+        if (ptr->count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            allocator_type typed_allocator(alloc);
+            allocator_traits::destroy(typed_allocator, ptr);
+            allocator_traits::deallocate(typed_allocator, ptr, 1);
+        }
+    }
+};
+
 //-----------------------------------------------------------------------------
 // small_union
 //-----------------------------------------------------------------------------
@@ -132,7 +308,7 @@ template <typename Allocator, typename MaxType, typename IndexType, typename...
 template <typename T>
 struct small_union<Allocator, MaxType, IndexType, Types...>::make_small
 {
-    using type = typename small_traits<sizeof(MaxType), typename std::decay<T>::type>::small_type;
+    using type = typename traits<typename std::decay<T>::type>::small_type;
 };
 
 template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
@@ -157,9 +333,9 @@ small_union<Allocator, MaxType, IndexType, Types...>::small_union(T value, const
     using type = typename std::decay<T>::type;
 
     assert(current < sizeof...(Types));
-    small_traits<sizeof(MaxType), type>::construct(get_allocator(),
-                                                   std::addressof(storage),
-                                                   std::move(value));
+    traits<type>::construct(get_allocator(),
+                            std::addressof(storage),
+                            std::move(value));
 }
 
 template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
@@ -168,7 +344,7 @@ small_union<Allocator, MaxType, IndexType, Types...>::small_union(const small_un
                      std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator())),
       current(other.current)
 {
-    call<copier, void>(other);
+    call<reconstructor, void>(other);
 }
 
 template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
@@ -176,7 +352,8 @@ small_union<Allocator, MaxType, IndexType, Types...>::small_union(small_union&&
     : allocator_base(detail::empty_init_t{}, other.get_allocator()),
       current(other.current)
 {
-    call<mover, void>(std::move(other));
+    call<transferer, void>(std::move(other));
+    other.reset();
 }
 
 template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
@@ -186,9 +363,9 @@ void small_union<Allocator, MaxType, IndexType, Types...>::operator= (T value)
     using type = typename std::decay<T>::type;
 
     call<destructor, void>();
-    small_traits<sizeof(MaxType), type>::construct(get_allocator(),
-                                                   std::addressof(storage),
-                                                   std::move(value));
+    traits<type>::construct(get_allocator(),
+                            std::addressof(storage),
+                            std::move(value));
     current = to_index<type>::value;
 }
 
@@ -206,13 +383,19 @@ auto small_union<Allocator, MaxType, IndexType, Types...>::operator= (const smal
         call<destructor, void>();
         // Create with new allocator
         get_allocator() = other.get_allocator();
+        current = other.current;
         call<reconstructor, void>(other);
     }
-    else
+    else if (current == other.current)
     {
         call<copier, void>(other);
     }
-    current = other.current;
+    else
+    {
+        call<destructor, void>();
+        current = other.current;
+        call<reconstructor, void>(other);
+    }
     return *this;
 }
 
@@ -226,20 +409,30 @@ auto small_union<Allocator, MaxType, IndexType, Types...>::operator= (small_unio
 
     if (std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value)
     {
+        call<destructor, void>();
         get_allocator() = std::move(other.get_allocator());
-        call<mover, void>(std::move(other));
+        current = other.current;
+        call<transferer, void>(std::move(other));
+        other.reset();
     }
     else if (get_allocator() == other.get_allocator())
+    {
+        call<destructor, void>();
+        current = other.current;
+        call<transferer, void>(std::move(other));
+        other.reset();
+    }
+    else if (current == other.current)
     {
         call<mover, void>(std::move(other));
     }
     else
     {
+        // Objects cannot be stolen from other allocator
         call<destructor, void>();
-        get_allocator() = std::move(other.get_allocator());
-        call<reconstructor, void>(std::move(other));
+        current = other.current;
+        call<move_reconstructor, void>(std::move(other));
     }
-    current = other.current;
     return *this;
 }
 
@@ -249,12 +442,24 @@ small_union<Allocator, MaxType, IndexType, Types...>::~small_union()
     call<destructor, void>();
 }
 
+template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
+void small_union<Allocator, MaxType, IndexType, Types...>::reset()
+{
+    // Storage must be uninitialized
+    using type = meta::to_type<meta::list<Types...>, 0>;
+
+    traits<type>::construct(get_allocator(),
+                            std::addressof(storage),
+                            type{});
+    current = 0;
+}
+
 template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
 template <typename T>
-T& small_union<Allocator, MaxType, IndexType, Types...>::get() noexcept
+T& small_union<Allocator, MaxType, IndexType, Types...>::get()
 {
     using type = typename std::decay<T>::type;
-    return small_traits<sizeof(MaxType), type>::deref(std::addressof(storage));
+    return traits<type>::get(get_allocator(), std::addressof(storage));
 }
 
 template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
@@ -262,7 +467,7 @@ template <typename T>
 const T& small_union<Allocator, MaxType, IndexType, Types...>::get() const noexcept
 {
     using type = typename std::decay<T>::type;
-    return small_traits<sizeof(MaxType), type>::deref(std::addressof(storage));
+    return traits<type>::deref(std::addressof(storage));
 }
 
 template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
@@ -315,9 +520,21 @@ struct small_union<Allocator, MaxType, IndexType, Types...>::reconstructor
     template <typename T>
     static void call(small_union& self, const small_union& other)
     {
-        small_traits<sizeof(MaxType), T>::construct(self.get_allocator(),
-                                                    std::addressof(self.storage),
-                                                    other.get<T>());
+        traits<T>::clone(self.get_allocator(),
+                         std::addressof(self.storage),
+                         std::addressof(other.storage));
+    }
+};
+
+template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
+struct small_union<Allocator, MaxType, IndexType, Types...>::move_reconstructor
+{
+    template <typename T>
+    static void call(small_union& self, small_union&& other)
+    {
+        traits<T>::construct(self.get_allocator(),
+                             std::addressof(self.storage),
+                             std::move(other.get<T>()));
     }
 };
 
@@ -327,8 +544,8 @@ struct small_union<Allocator, MaxType, IndexType, Types...>::destructor
     template <typename T>
     static void call(small_union& self)
     {
-        small_traits<sizeof(MaxType), T>::destroy(self.get_allocator(),
-                                                  std::addressof(self.storage));
+        traits<T>::destroy(self.get_allocator(),
+                           std::addressof(self.storage));
     }
 };
 
@@ -338,8 +555,9 @@ struct small_union<Allocator, MaxType, IndexType, Types...>::copier
     template <typename T>
     static void call(small_union& self, const small_union& other)
     {
-        small_traits<sizeof(MaxType), T>::copy(std::addressof(self.storage),
-                                               std::addressof(other.storage));
+        traits<T>::copy(self.get_allocator(),
+                        std::addressof(self.storage),
+                        std::addressof(other.storage));
     }
 };
 
@@ -349,8 +567,21 @@ struct small_union<Allocator, MaxType, IndexType, Types...>::mover
     template <typename T>
     static void call(small_union& self, small_union&& other)
     {
-        small_traits<sizeof(MaxType), T>::move(std::addressof(self.storage),
-                                               std::addressof(other.storage));
+        traits<T>::move(self.get_allocator(),
+                        std::addressof(self.storage),
+                        std::addressof(other.storage));
+    }
+};
+
+template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
+struct small_union<Allocator, MaxType, IndexType, Types...>::transferer
+{
+    template <typename T>
+    static void call(small_union& self, small_union&& other)
+    {
+        traits<T>::transfer(self.get_allocator(),
+                            std::addressof(self.storage),
+                            std::addressof(other.storage));
     }
 };
 
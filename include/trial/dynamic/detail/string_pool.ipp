@@ -0,0 +1,65 @@
+#ifndef TRIAL_DYNAMIC_DETAIL_STRING_POOL_IPP
+#define TRIAL_DYNAMIC_DETAIL_STRING_POOL_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2017 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace trial
+{
+namespace dynamic
+{
+
+template <typename Allocator>
+template <typename CharT>
+auto basic_string_pool<Allocator>::intern(const CharT *data, size_type size) -> const_reference
+{
+    using string_type = detail::key_string<Allocator, CharT>;
+
+#if __cplusplus >= 201402L
+    // Only construct string if it is not already pooled
+    const detail::key_view<CharT> key{ data, size };
+    auto where = strings.lower_bound(key);
+    if ((where != strings.end()) && !strings.key_comp()(key, *where))
+        return *where;
+    return *strings.emplace_hint(where, string_type(data, size));
+#else
+    return *strings.insert(value_type(string_type(data, size))).first;
+#endif
+}
+
+template <typename Allocator>
+template <typename T>
+auto basic_string_pool<Allocator>::intern(const T& key) -> decltype(key.data(), key.size(), std::declval<const_reference>())
+{
+    return intern(key.data(), key.size());
+}
+
+template <typename Allocator>
+auto basic_string_pool<Allocator>::size() const noexcept -> size_type
+{
+    return strings.size();
+}
+
+template <typename Allocator>
+bool basic_string_pool<Allocator>::empty() const noexcept
+{
+    return strings.empty();
+}
+
+template <typename Allocator>
+void basic_string_pool<Allocator>::clear() noexcept
+{
+    strings.clear();
+}
+
+} // namespace dynamic
+} // namespace trial
+
+#endif // TRIAL_DYNAMIC_DETAIL_STRING_POOL_IPP
@@ -11,6 +11,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <stdexcept>
 #include <trial/dynamic/detail/type_traits.hpp>
 #include <trial/dynamic/error.hpp>
 
@@ -70,6 +71,76 @@ using is_array = std::is_same<T, typename basic_variable<Allocator>::array_type>
 template <typename Allocator, typename T>
 using is_map = std::is_same<T, typename basic_variable<Allocator>::map_type>;
 
+// String views and strings with any allocator
+template <typename T, typename = void>
+struct is_string_key : std::false_type {};
+
+template <typename T>
+struct is_string_key<T, meta::void_t<typename T::traits_type,
+                                     decltype(std::declval<const T&>().data()),
+                                     decltype(std::declval<const T&>().size())>>
+    : is_character<typename T::value_type>
+{
+};
+
+template <typename CharT> struct key_symbol;
+template <> struct key_symbol<char> : std::integral_constant<symbol::value, symbol::string> {};
+template <> struct key_symbol<wchar_t> : std::integral_constant<symbol::value, symbol::wstring> {};
+template <> struct key_symbol<char16_t> : std::integral_constant<symbol::value, symbol::u16string> {};
+template <> struct key_symbol<char32_t> : std::integral_constant<symbol::value, symbol::u32string> {};
+
+// Non-owning string key used for heterogeneous map lookup
+template <typename CharT>
+struct key_view
+{
+    const CharT *data;
+    std::size_t size;
+};
+
+template <typename Allocator, typename CharT>
+using key_string = std::basic_string<CharT,
+                                     std::char_traits<CharT>,
+                                     typename std::allocator_traits<typename basic_variable<Allocator>::allocator_type>::template rebind_alloc<CharT>>;
+
+// Three-way comparison between variable and string key that is consistent
+// with the ordering of operator<
+template <typename Allocator, typename CharT>
+int compare(const basic_variable<Allocator>& lhs, const key_view<CharT>& rhs) noexcept
+{
+    using string_type = key_string<Allocator, CharT>;
+
+    const auto symbol = lhs.symbol();
+    if (symbol != key_symbol<CharT>::value)
+        return (symbol < key_symbol<CharT>::value) ? -1 : 1;
+
+    const auto& key = lhs.template assume_value<string_type>();
+    return key.compare(0, key.size(), rhs.data, rhs.size);
+}
+
+template <typename Allocator>
+struct key_compare
+{
+    using is_transparent = void;
+    using variable_type = basic_variable<Allocator>;
+
+    bool operator() (const variable_type& lhs, const variable_type& rhs) const
+    {
+        return lhs < rhs;
+    }
+
+    template <typename CharT>
+    bool operator() (const variable_type& lhs, const key_view<CharT>& rhs) const noexcept
+    {
+        return detail::compare(lhs, rhs) < 0;
+    }
+
+    template <typename CharT>
+    bool operator() (const key_view<CharT>& lhs, const variable_type& rhs) const noexcept
+    {
+        return detail::compare(rhs, lhs) > 0;
+    }
+};
+
 } // namespace detail
 
 //-----------------------------------------------------------------------------
@@ -2206,6 +2277,210 @@ struct iterator_overloader<
 
 } // namespace detail
 
+//-----------------------------------------------------------------------------
+// detail::key_overloader
+//-----------------------------------------------------------------------------
+
+namespace detail
+{
+
+// Keys are converted into a variable before lookup
+
+template <typename Allocator, typename T, typename = void>
+struct key_overloader
+{
+    using variable_type = basic_variable<Allocator>;
+    using map_type = typename variable_type::map_type;
+
+    static const bool value = false;
+
+    static bool equal(const variable_type& self, const T& key)
+    {
+        return self == key;
+    }
+
+    static typename map_type::const_iterator find(const map_type& map,
+                                                  const T& key)
+    {
+        return map.find(variable_type(key));
+    }
+
+    static typename variable_type::key_iterator find(const variable_type& self,
+                                                     const T& key)
+    {
+        return typename variable_type::key_iterator(&self,
+                                                    find(self.template assume_value<map_type>(), key));
+    }
+};
+
+// String keys are looked up without constructing a variable
+
+template <typename Allocator, typename CharT>
+struct string_key_overloader
+{
+    using variable_type = basic_variable<Allocator>;
+    using string_type = key_string<Allocator, CharT>;
+    using map_type = typename variable_type::map_type;
+    using view_type = key_view<CharT>;
+
+    static bool equal(const variable_type& self, const view_type& key) noexcept
+    {
+        return detail::compare(self, key) == 0;
+    }
+
+    static typename map_type::const_iterator find(const map_type& map,
+                                                  const view_type& key)
+    {
+#if __cplusplus >= 201402L
+        return map.find(key);
+#else
+        return map.find(variable_type(string_type(key.data, key.size)));
+#endif
+    }
+
+    static typename variable_type::key_iterator find(const variable_type& self,
+                                                     const view_type& key)
+    {
+        return typename variable_type::key_iterator(&self,
+                                                    find(self.template assume_value<map_type>(), key));
+    }
+
+    static variable_type& at(variable_type& self, const view_type& key)
+    {
+        switch (self.symbol())
+        {
+        case symbol::null:
+            self = basic_map<Allocator>::make();
+            goto case_map;
+        case symbol::map:
+        case_map:
+            {
+                auto& map = self.template assume_value<map_type>();
+#if __cplusplus >= 201402L
+                auto where = map.lower_bound(key);
+                if ((where == map.end()) || map.key_comp()(key, where->first))
+                {
+                    // Only construct key on insertion
+                    where = map.emplace_hint(where,
+                                             variable_type(string_type(key.data, key.size)),
+                                             variable_type());
+                }
+                return where->second;
+#else
+                return map[variable_type(string_type(key.data, key.size))];
+#endif
+            }
+
+        default:
+            throw dynamic::error(incompatible_type);
+        }
+    }
+
+    static const variable_type& at(const variable_type& self, const view_type& key)
+    {
+        switch (self.symbol())
+        {
+        case symbol::map:
+            {
+                const auto& map = self.template assume_value<map_type>();
+                auto where = find(map, key);
+                if (where == map.end())
+                    throw std::out_of_range("key not found");
+                return where->second;
+            }
+
+        default:
+            throw dynamic::error(incompatible_type);
+        }
+    }
+};
+
+template <typename Allocator, typename T>
+struct key_overloader<
+    Allocator,
+    T,
+    typename std::enable_if<detail::is_string_key<T>::value>::type>
+    : string_key_overloader<Allocator, typename T::value_type>
+{
+    using super = string_key_overloader<Allocator, typename T::value_type>;
+    using super::equal;
+    using super::find;
+    using super::at;
+
+    static const bool value = true;
+
+    static typename super::view_type view(const T& key) noexcept
+    {
+        return { key.data(), key.size() };
+    }
+
+    static bool equal(const typename super::variable_type& self, const T& key) noexcept
+    {
+        return super::equal(self, view(key));
+    }
+
+    template <typename Variable>
+    static auto find(const Variable& self, const T& key) -> decltype(super::find(self, view(key)))
+    {
+        return super::find(self, view(key));
+    }
+
+    template <typename Variable>
+    static auto at(Variable& self, const T& key) -> decltype(super::at(self, view(key)))
+    {
+        return super::at(self, view(key));
+    }
+};
+
+template <typename Allocator, typename CharT>
+struct key_overloader<
+    Allocator,
+    CharT *,
+    typename std::enable_if<detail::is_character<typename std::remove_const<CharT>::type>::value>::type>
+    : string_key_overloader<Allocator, typename std::remove_const<CharT>::type>
+{
+    using super = string_key_overloader<Allocator, typename std::remove_const<CharT>::type>;
+    using super::equal;
+    using super::find;
+    using super::at;
+
+    static const bool value = false;
+
+    static typename super::view_type view(const CharT *key) noexcept
+    {
+        using traits_type = std::char_traits<typename std::remove_const<CharT>::type>;
+        return { key, traits_type::length(key) };
+    }
+
+    static bool equal(const typename super::variable_type& self, const CharT *key) noexcept
+    {
+        return super::equal(self, view(key));
+    }
+
+    template <typename Variable>
+    static auto find(const Variable& self, const CharT *key) -> decltype(super::find(self, view(key)))
+    {
+        return super::find(self, view(key));
+    }
+
+    template <typename Variable>
+    static auto at(Variable& self, const CharT *key) -> decltype(super::at(self, view(key)))
+    {
+        return super::at(self, view(key));
+    }
+};
+
+template <typename Allocator, typename CharT, std::size_t N>
+struct key_overloader<
+    Allocator,
+    CharT[N],
+    typename std::enable_if<detail::is_character<typename std::remove_const<CharT>::type>::value>::type>
+    : key_overloader<Allocator, CharT *>
+{
+};
+
+} // namespace detail
+
 //-----------------------------------------------------------------------------
 // variable::iterator_base
 //-----------------------------------------------------------------------------
@@ -2684,6 +2959,14 @@ basic_variable<Allocator>::key_iterator::key_iterator(pointer p, bool initialize
 {
 }
 
+template <typename Allocator>
+basic_variable<Allocator>::key_iterator::key_iterator(pointer p,
+                                                      typename super::map_iterator where)
+    : super(p, where),
+      index(0)
+{
+}
+
 template <typename Allocator>
 auto basic_variable<Allocator>::key_iterator::operator= (const key_iterator& other) -> key_iterator&
 {
@@ -2786,147 +3069,14 @@ basic_variable<Allocator>::basic_variable()
 
 template <typename Allocator>
 basic_variable<Allocator>::basic_variable(const basic_variable& other)
-    : storage(null)
+    : storage(other.storage)
 {
-    switch (other.code())
-    {
-    case code::null:
-        storage = null;
-        break;
-    case code::boolean:
-        storage = other.assume_value<bool>();
-        break;
-    case code::signed_char:
-        storage = other.assume_value<signed char>();
-        break;
-    case code::unsigned_char:
-        storage = other.assume_value<unsigned char>();
-        break;
-    case code::signed_short_integer:
-        storage = other.assume_value<signed short int>();
-        break;
-    case code::unsigned_short_integer:
-        storage = other.assume_value<unsigned short int>();
-        break;
-    case code::signed_integer:
-        storage = other.assume_value<signed int>();
-        break;
-    case code::unsigned_integer:
-        storage = other.assume_value<unsigned int>();
-        break;
-    case code::signed_long_integer:
-        storage = other.assume_value<signed long int>();
-        break;
-    case code::unsigned_long_integer:
-        storage = other.assume_value<unsigned long int>();
-        break;
-    case code::signed_long_long_integer:
-        storage = other.assume_value<signed long long int>();
-        break;
-    case code::unsigned_long_long_integer:
-        storage = other.assume_value<unsigned long long int>();
-        break;
-    case code::real:
-        storage = other.assume_value<float>();
-        break;
-    case code::long_real:
-        storage = other.assume_value<double>();
-        break;
-    case code::long_long_real:
-        storage = other.assume_value<long double>();
-        break;
-    case code::string:
-        storage = other.assume_value<string_type>();
-        break;
-    case code::wstring:
-        storage = other.assume_value<wstring_type>();
-        break;
-    case code::u16string:
-        storage = other.assume_value<u16string_type>();
-        break;
-    case code::u32string:
-        storage = other.assume_value<u32string_type>();
-        break;
-    case code::array:
-        storage = other.assume_value<array_type>();
-        break;
-    case code::map:
-        storage = other.assume_value<map_type>();
-        break;
-    }
 }
 
 template <typename Allocator>
 basic_variable<Allocator>::basic_variable(basic_variable&& other) noexcept
-    : storage(null)
+    : storage(std::move(other.storage))
 {
-    switch (other.code())
-    {
-    case code::null:
-        storage = null;
-        break;
-    case code::boolean:
-        storage = std::move(other.assume_value<bool>());
-        break;
-    case code::signed_char:
-        storage = std::move(other.assume_value<signed char>());
-        break;
-    case code::unsigned_char:
-        storage = std::move(other.assume_value<unsigned char>());
-        break;
-    case code::signed_short_integer:
-        storage = std::move(other.assume_value<signed short int>());
-        break;
-    case code::unsigned_short_integer:
-        storage = std::move(other.assume_value<unsigned short int>());
-        break;
-    case code::signed_integer:
-        storage = std::move(other.assume_value<signed int>());
-        break;
-    case code::unsigned_integer:
-        storage = std::move(other.assume_value<unsigned int>());
-        break;
-    case code::signed_long_integer:
-        storage = std::move(other.assume_value<signed long int>());
-        break;
-    case code::unsigned_long_integer:
-        storage = std::move(other.assume_value<unsigned long int>());
-        break;
-    case code::signed_long_long_integer:
-        storage = std::move(other.assume_value<signed long long int>());
-        break;
-    case code::unsigned_long_long_integer:
-        storage = std::move(other.assume_value<unsigned long long int>());
-        break;
-    case code::real:
-        storage = std::move(other.assume_value<float>());
-        break;
-    case code::long_real:
-        storage = std::move(other.assume_value<double>());
-        break;
-    case code::long_long_real:
-        storage = std::move(other.assume_value<long double>());
-        break;
-    case code::string:
-        storage = std::move(other.assume_value<string_type>());
-        break;
-    case code::wstring:
-        storage = std::move(other.assume_value<wstring_type>());
-        break;
-    case code::u16string:
-        storage = std::move(other.assume_value<u16string_type>());
-        break;
-    case code::u32string:
-        storage = std::move(other.assume_value<u32string_type>());
-        break;
-    case code::array:
-        storage = std::move(other.assume_value<array_type>());
-        break;
-    case code::map:
-        // This is not guaranteed to be noexcept
-        storage = std::move(other.assume_value<map_type>());
-        break;
-    }
 }
 
 template <typename Allocator>
@@ -3021,144 +3171,16 @@ basic_variable<Allocator>::basic_variable(typename basic_variable::map_type&& va
 template <typename Allocator>
 auto basic_variable<Allocator>::operator= (const basic_variable& other) -> basic_variable&
 {
-    switch (other.code())
-    {
-    case code::null:
-        storage = null;
-        break;
-    case code::boolean:
-        storage = other.assume_value<bool>();
-        break;
-    case code::signed_char:
-        storage = other.assume_value<signed char>();
-        break;
-    case code::unsigned_char:
-        storage = other.assume_value<unsigned char>();
-        break;
-    case code::signed_short_integer:
-        storage = other.assume_value<signed short int>();
-        break;
-    case code::unsigned_short_integer:
-        storage = other.assume_value<unsigned short int>();
-        break;
-    case code::signed_integer:
-        storage = other.assume_value<signed int>();
-        break;
-    case code::unsigned_integer:
-        storage = other.assume_value<unsigned int>();
-        break;
-    case code::signed_long_integer:
-        storage = other.assume_value<signed long int>();
-        break;
-    case code::unsigned_long_integer:
-        storage = other.assume_value<unsigned long int>();
-        break;
-    case code::signed_long_long_integer:
-        storage = other.assume_value<signed long long int>();
-        break;
-    case code::unsigned_long_long_integer:
-        storage = other.assume_value<unsigned long long int>();
-        break;
-    case code::real:
-        storage = other.assume_value<float>();
-        break;
-    case code::long_real:
-        storage = other.assume_value<double>();
-        break;
-    case code::long_long_real:
-        storage = other.assume_value<long double>();
-        break;
-    case code::string:
-        storage = other.assume_value<string_type>();
-        break;
-    case code::wstring:
-        storage = other.assume_value<wstring_type>();
-        break;
-    case code::u16string:
-        storage = other.assume_value<u16string_type>();
-        break;
-    case code::u32string:
-        storage = other.assume_value<u32string_type>();
-        break;
-    case code::array:
-        storage = other.assume_value<array_type>();
-        break;
-    case code::map:
-        storage = other.assume_value<map_type>();
-        break;
-    }
+    // Copy before assignment because other may be nested inside this variable
+    storage = storage_type(other.storage);
     return *this;
 }
 
 template <typename Allocator>
 auto basic_variable<Allocator>::operator= (basic_variable&& other) -> basic_variable&
 {
-    switch (other.code())
-    {
-    case code::null:
-        storage = null;
-        break;
-    case code::boolean:
-        storage = std::move(other.assume_value<bool>());
-        break;
-    case code::signed_char:
-        storage = std::move(other.assume_value<signed char>());
-        break;
-    case code::unsigned_char:
-        storage = std::move(other.assume_value<unsigned char>());
-        break;
-    case code::signed_short_integer:
-        storage = std::move(other.assume_value<signed short int>());
-        break;
-    case code::unsigned_short_integer:
-        storage = std::move(other.assume_value<unsigned short int>());
-        break;
-    case code::signed_integer:
-        storage = std::move(other.assume_value<signed int>());
-        break;
-    case code::unsigned_integer:
-        storage = std::move(other.assume_value<unsigned int>());
-        break;
-    case code::signed_long_integer:
-        storage = std::move(other.assume_value<signed long int>());
-        break;
-    case code::unsigned_long_integer:
-        storage = std::move(other.assume_value<unsigned long int>());
-        break;
-    case code::signed_long_long_integer:
-        storage = std::move(other.assume_value<signed long long int>());
-        break;
-    case code::unsigned_long_long_integer:
-        storage = std::move(other.assume_value<unsigned long long int>());
-        break;
-    case code::real:
-        storage = std::move(other.assume_value<float>());
-        break;
-    case code::long_real:
-        storage = std::move(other.assume_value<double>());
-        break;
-    case code::long_long_real:
-        storage = std::move(other.assume_value<long double>());
-        break;
-    case code::string:
-        storage = std::move(other.assume_value<string_type>());
-        break;
-    case code::wstring:
-        storage = std::move(other.assume_value<wstring_type>());
-        break;
-    case code::u16string:
-        storage = std::move(other.assume_value<u16string_type>());
-        break;
-    case code::u32string:
-        storage = std::move(other.assume_value<u32string_type>());
-        break;
-    case code::array:
-        storage = std::move(other.assume_value<array_type>());
-        break;
-    case code::map:
-        storage = std::move(other.assume_value<map_type>());
-        break;
-    }
+    // Steal before assignment because other may be nested inside this variable
+    storage = storage_type(std::move(other.storage));
     return *this;
 }
 
@@ -3499,6 +3521,34 @@ auto basic_variable<Allocator>::operator[] (const typename map_type::key_type& k
     }
 }
 
+template <typename Allocator>
+template <typename CharT>
+auto basic_variable<Allocator>::operator[] (const CharT *key) & -> basic_variable&
+{
+    return detail::key_overloader<Allocator, const CharT *>::at(*this, key);
+}
+
+template <typename Allocator>
+template <typename CharT>
+auto basic_variable<Allocator>::operator[] (const CharT *key) const & -> const basic_variable&
+{
+    return detail::key_overloader<Allocator, const CharT *>::at(*this, key);
+}
+
+template <typename Allocator>
+template <typename T>
+auto basic_variable<Allocator>::operator[] (const T& key) & -> typename std::enable_if<detail::key_overloader<Allocator, T, void>::value, basic_variable&>::type
+{
+    return detail::key_overloader<Allocator, T>::at(*this, key);
+}
+
+template <typename Allocator>
+template <typename T>
+auto basic_variable<Allocator>::operator[] (const T& key) const & -> typename std::enable_if<detail::key_overloader<Allocator, T, void>::value, const basic_variable&>::type
+{
+    return detail::key_overloader<Allocator, T>::at(*this, key);
+}
+
 template <typename Allocator>
 template <typename Tag>
 bool basic_variable<Allocator>::is() const noexcept
@@ -0,0 +1,108 @@
+#ifndef TRIAL_DYNAMIC_SHARED_HPP
+#define TRIAL_DYNAMIC_SHARED_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2017 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <memory>
+#include <type_traits>
+#include <trial/dynamic/compact.hpp>
+
+namespace trial
+{
+namespace dynamic
+{
+
+//! @brief Allocator adaptor for dynamic variables with shared subtrees.
+//!
+//! A dynamic variable using this allocator has the same layout as with
+//! `compact_allocator`, but strings, arrays, and maps are reference-counted
+//! and shared between copies of the variable. Copying a variable is therefore
+//! a constant-time operation regardless of the size of the tree.
+//!
+//! A shared string or container is copied before it is modified through a
+//! non-const accessor. Only the container itself is copied, because its
+//! elements are shared as well, so modifying a nested element copies the
+//! containers along the path to the element.
+//!
+//! References and iterators obtained from a non-const variable must not be
+//! used to modify the variable after it has been copied, because the
+//! modification will then be visible through the copy as well.
+//!
+//! @tparam Allocator Underlying allocator (defaults to `std::allocator`)
+
+template <typename Allocator = std::allocator<char>>
+class shared_allocator
+    : public compact_allocator<Allocator>
+{
+    using super = compact_allocator<Allocator>;
+
+    template <typename T>
+    using underlying_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+public:
+    template <typename T>
+    struct rebind
+    {
+        using other = typename std::conditional<detail::is_character<T>::value,
+                                                underlying_allocator<T>,
+                                                shared_allocator<underlying_allocator<T>>>::type;
+    };
+
+    shared_allocator() = default;
+
+    shared_allocator(const Allocator& alloc)
+        : super(alloc)
+    {
+    }
+
+    template <typename U>
+    shared_allocator(const shared_allocator<U>& other)
+        : super(static_cast<const U&>(other))
+    {
+    }
+
+    friend bool operator== (const shared_allocator& lhs, const shared_allocator& rhs)
+    {
+        return static_cast<const Allocator&>(lhs) == static_cast<const Allocator&>(rhs);
+    }
+
+    friend bool operator!= (const shared_allocator& lhs, const shared_allocator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+#if !defined(BOOST_DOXYGEN_INVOKED)
+
+namespace detail
+{
+
+template <typename Allocator>
+struct layout_traits<shared_allocator<Allocator>>
+{
+    using max_type = void *;
+
+    template <typename T>
+    using is_shared = std::true_type;
+};
+
+} // namespace detail
+
+#endif
+
+using shared_variable = basic_variable<shared_allocator<>>;
+using shared_array = basic_array<shared_allocator<>>;
+using shared_map = basic_map<shared_allocator<>>;
+
+} // namespace dynamic
+} // namespace trial
+
+#endif // TRIAL_DYNAMIC_SHARED_HPP
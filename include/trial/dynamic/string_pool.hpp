@@ -0,0 +1,91 @@
+#ifndef TRIAL_DYNAMIC_STRING_POOL_HPP
+#define TRIAL_DYNAMIC_STRING_POOL_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2017 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <memory>
+#include <set>
+#include <utility>
+#include <trial/dynamic/variable.hpp>
+#include <trial/dynamic/shared.hpp>
+
+namespace trial
+{
+namespace dynamic
+{
+
+//! @brief Pool of interned strings.
+//!
+//! Each distinct string is stored once in the pool and is returned as a
+//! dynamic variable. The pool is intended for map keys that are repeated
+//! across objects and documents, and can be passed to the parsers.
+//!
+//! Storage is only shared when the variable layout shares strings, such as
+//! with `shared_allocator`. Copies of the pooled variables then refer to the
+//! same string storage as the pool. With other layouts the pooled variables
+//! are copied as usual.
+//!
+//! @tparam Allocator Allocator type of the variables.
+
+template <typename Allocator>
+class basic_string_pool
+{
+public:
+    using value_type = basic_variable<Allocator>;
+    using const_reference = const value_type&;
+    using size_type = std::size_t;
+
+    //! @brief Constructs empty pool.
+    basic_string_pool() = default;
+
+    //! @brief Returns pooled string.
+    //!
+    //! Inserts the string into the pool if it is not already there.
+    //!
+    //! @param data Pointer to characters.
+    //! @param size Number of characters.
+    //! @returns Variable containing a string equal to `[data, data + size)`.
+    template <typename CharT>
+    const_reference intern(const CharT *data, size_type size);
+
+    //! @brief Returns pooled string.
+    //!
+    //! @param key String or string view.
+    //! @returns Variable containing a string equal to `key`.
+    template <typename T>
+    auto intern(const T& key) -> decltype(key.data(), key.size(), std::declval<const_reference>());
+
+    //! @brief Returns number of distinct strings in pool.
+    size_type size() const noexcept;
+
+    //! @brief Checks if pool is empty.
+    bool empty() const noexcept;
+
+    //! @brief Removes all strings from pool.
+    //!
+    //! Variables that have been copied from the pool remain valid.
+    void clear() noexcept;
+
+private:
+    using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<value_type>;
+
+    std::set<value_type, detail::key_compare<Allocator>, allocator_type> strings;
+};
+
+using string_pool = basic_string_pool<shared_allocator<>>;
+
+} // namespace dynamic
+} // namespace trial
+
+#include <trial/dynamic/detail/string_pool.ipp>
+
+#endif // TRIAL_DYNAMIC_STRING_POOL_HPP
@@ -19,6 +19,7 @@
 #include <vector>
 #include <map>
 #include <trial/dynamic/detail/config.hpp>
+#include <trial/dynamic/detail/layout.hpp>
 #include <trial/dynamic/detail/small_union.hpp>
 #include <trial/dynamic/error.hpp>
 #include <trial/dynamic/token.hpp>
@@ -37,6 +38,9 @@ template <typename T, typename U, typename> struct overloader;
 template <typename T, typename U, typename> struct operator_overloader;
 template <typename A, typename T, typename> struct same_overloader;
 template <typename A, typename U, typename> struct iterator_overloader;
+template <typename A, typename U, typename> struct key_overloader;
+template <typename A, typename CharT> struct string_key_overloader;
+template <typename Allocator> struct key_compare;
 
 } // namespace detail
 
@@ -131,7 +135,7 @@ public:
                                    allocator_type>;
     using map_type = std::map<value_type,
                               value_type,
-                              std::less<value_type>,
+                              detail::key_compare<Allocator>,
                               typename std::allocator_traits<allocator_type>::template rebind_alloc<map_value_type>>;
     using pair_type = typename map_type::value_type;
 
@@ -313,8 +317,11 @@ public:
 
     private:
         friend class basic_variable;
+        template <typename A, typename U, typename> friend struct detail::key_overloader;
+        template <typename A, typename CharT> friend struct detail::string_key_overloader;
 
         explicit key_iterator(pointer p, bool initialize = true);
+        explicit key_iterator(pointer p, typename super::map_iterator);
 
     private:
         typename std::remove_const<value_type>::type index;
@@ -614,6 +621,49 @@ public:
 
     const basic_variable& operator[] (const typename map_type::key_type& key) const &;
 
+    //! @brief Returns reference to element indexed by string key.
+    //!
+    //! Looks up @c key in an associative array without constructing a
+    //! temporary variable. A variable is only constructed from @c key
+    //! if it has to be inserted.
+    //!
+    //! @overload basic_variable<Allocator>::operator[](const typename map_type::key_type&)
+
+    template <typename CharT>
+    basic_variable& operator[] (const CharT *key) &;
+
+    //! @brief Returns constant reference to element indexed by string key.
+    //!
+    //! @overload basic_variable<Allocator>::operator[](const typename map_type::key_type&) const
+
+    template <typename CharT>
+    const basic_variable& operator[] (const CharT *key) const &;
+
+    //! @brief Returns reference to element indexed by string key.
+    //!
+    //! `T` must be a string view or a string type, such as `std::string_view`
+    //! or `std::string`.
+    //!
+    //! @overload basic_variable<Allocator>::operator[](const CharT *)
+
+#if defined(BOOST_DOXYGEN_INVOKED)
+    template <typename T> basic_variable& operator[] (const T& key) &;
+#else
+    template <typename T>
+    auto operator[] (const T& key) & -> typename std::enable_if<detail::key_overloader<Allocator, T, void>::value, basic_variable&>::type;
+#endif
+
+    //! @brief Returns constant reference to element indexed by string key.
+    //!
+    //! @overload basic_variable<Allocator>::operator[](const CharT *) const
+
+#if defined(BOOST_DOXYGEN_INVOKED)
+    template <typename T> const basic_variable& operator[] (const T& key) const &;
+#else
+    template <typename T>
+    auto operator[] (const T& key) const & -> typename std::enable_if<detail::key_overloader<Allocator, T, void>::value, const basic_variable&>::type;
+#endif
+
     //! @brief Checks if variable has a given tag.
     //!
     //! Converts `T` into a tag, and returns true if variable has the same
@@ -971,13 +1021,14 @@ private:
 private:
     template <typename T, typename U, typename> friend struct detail::overloader;
     template <typename A, typename U, typename> friend struct detail::iterator_overloader;
+    template <typename A, typename U, typename> friend struct detail::key_overloader;
     template <typename T, typename U, typename> friend struct detail::operator_overloader;
     template <typename A, typename T, typename> friend struct detail::same_overloader;
     template <typename T> struct similar_visitor;
 
     using index_type = unsigned char;
     using storage_type = detail::small_union<allocator_type,
-                                             std::max_align_t,
+                                             typename detail::layout_traits<Allocator>::max_type,
                                              index_type,
                                              nullable,
                                              bool,
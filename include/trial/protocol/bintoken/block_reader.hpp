@@ -0,0 +1,79 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_BLOCK_READER_HPP
+#define TRIAL_PROTOCOL_BINTOKEN_BLOCK_READER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <system_error>
+#include <vector>
+#include <trial/protocol/bintoken/error.hpp>
+#include <trial/protocol/bintoken/detail/decoder.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+
+//! @brief Reads the blocks of a container created by block_writer.
+//!
+//! Blocks are located via the block index, so they can be read in any
+//! order. Reading does not modify the block_reader, so several threads can
+//! decompress different blocks concurrently. Each decompressed block is
+//! parsed with its own reader.
+class block_reader
+{
+public:
+    using size_type = std::size_t;
+    using value_type = detail::decoder::value_type;
+    using view_type = detail::decoder::view_type;
+
+    //! @throws system_error if the block index is invalid.
+    block_reader(view_type);
+    template <typename T> block_reader(const T&);
+
+    //! @brief Returns the number of blocks.
+    size_type size() const BOOST_NOEXCEPT;
+
+    //! @brief Returns the decompressed length of a block.
+    //!
+    //! @throws system_error if the block header is invalid.
+    size_type length(size_type index) const;
+
+    //! @brief Decompresses a block into output.
+    //!
+    //! The output is resized to the decompressed length of the block and
+    //! the checksum of the decompressed data is verified.
+    void read(size_type index,
+              std::vector<value_type>& output,
+              std::error_code& ec) const;
+
+    //! @throws system_error if the block is corrupt.
+    void read(size_type index, std::vector<value_type>& output) const;
+
+private:
+    view_type header(size_type index, std::error_code&) const;
+
+private:
+    view_type input;
+    size_type count = 0;
+    size_type index_offset = 0;
+};
+
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/bintoken/detail/block_reader.ipp>
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_BLOCK_READER_HPP
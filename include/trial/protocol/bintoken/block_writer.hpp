@@ -0,0 +1,87 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_BLOCK_WRITER_HPP
+#define TRIAL_PROTOCOL_BINTOKEN_BLOCK_WRITER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <trial/protocol/buffer/base.hpp>
+#include <trial/protocol/bintoken/error.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+
+//! @brief Writes bintoken data as a sequence of compressed blocks.
+//!
+//! Each block holds complete bintoken values, typically the output of a
+//! writer, and is compressed and checksummed independently. An index of
+//! all blocks is appended when the container is closed, so that a
+//! block_reader can access blocks in any order.
+class block_writer
+{
+public:
+    using size_type = std::size_t;
+    using value_type = std::uint8_t;
+    using buffer_type = buffer::base<value_type>;
+    using view_type = buffer_type::view_type;
+
+    template <typename T> block_writer(T& output);
+    block_writer(const block_writer&) = delete;
+    block_writer& operator=(const block_writer&) = delete;
+
+    //! @brief Closes the container unless already closed.
+    ~block_writer();
+
+    //! @brief Appends a block with the given bintoken data.
+    //!
+    //! The data is stored uncompressed if compression does not make it
+    //! shorter.
+    //!
+    //! @returns Index of the block.
+    //!
+    //! @throws system_error if the container is closed or the output is full.
+    size_type write(const view_type&);
+
+    template <typename T>
+    size_type write(const T&);
+
+    //! @brief Appends the block index.
+    //!
+    //! No blocks can be written afterwards.
+    void close();
+
+    //! @brief Returns the number of blocks written so far.
+    size_type size() const BOOST_NOEXCEPT;
+
+private:
+    void output(const value_type *, size_type);
+
+private:
+    std::unique_ptr<buffer_type> buffer;
+    std::vector<std::uint64_t> offsets;
+    std::vector<value_type> scratch;
+    std::uint64_t offset = 0;
+    bool closed = false;
+};
+
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/bintoken/detail/block_writer.ipp>
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_BLOCK_WRITER_HPP
@@ -0,0 +1,84 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_DETAIL_BLOCK_HPP
+#define TRIAL_PROTOCOL_BINTOKEN_DETAIL_BLOCK_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+
+// Block container layout (all numbers are little-endian)
+//
+//   container = *block index footer
+//   block     = method:u8 stored-size:u32 length:u32 checksum:u32 payload
+//   index     = *offset:u64
+//   footer    = index-offset:u64 count:u32 magic:u32
+//
+// The payload is either the bintoken data itself or its LZ compression as
+// indicated by the method. The checksum is the Adler-32 of the bintoken
+// data. The index contains the offset of each block from the beginning of
+// the container.
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+namespace detail
+{
+namespace block
+{
+
+const std::uint32_t magic = UINT32_C(0x424B5442); // "BTKB"
+const std::size_t header_size = 13;
+const std::size_t index_entry_size = 8;
+const std::size_t footer_size = 16;
+
+namespace method
+{
+enum value : std::uint8_t
+{
+    stored = 0,
+    lz = 1
+};
+} // namespace method
+
+inline std::uint32_t adler32(const std::uint8_t *input, std::size_t length)
+{
+    const std::uint32_t modulus = 65521;
+    // Largest number of bytes before the sums must be reduced
+    const std::size_t stride = 5552;
+
+    std::uint32_t a = 1;
+    std::uint32_t b = 0;
+    while (length > 0)
+    {
+        const std::size_t size = (length < stride) ? length : stride;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            a += input[i];
+            b += a;
+        }
+        a %= modulus;
+        b %= modulus;
+        input += size;
+        length -= size;
+    }
+    return (b << 16) | a;
+}
+
+} // namespace block
+} // namespace detail
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_DETAIL_BLOCK_HPP
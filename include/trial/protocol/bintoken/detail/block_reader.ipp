@@ -0,0 +1,154 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_DETAIL_BLOCK_READER_IPP
+#define TRIAL_PROTOCOL_BINTOKEN_DETAIL_BLOCK_READER_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstring> // std::memcpy
+#include <trial/protocol/bintoken/detail/block.hpp>
+#include <trial/protocol/bintoken/detail/endian.hpp>
+#include <trial/protocol/bintoken/detail/lz.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+
+inline block_reader::block_reader(view_type view)
+    : input(std::move(view))
+{
+    using namespace detail;
+
+    if (input.size() < block::footer_size)
+        throw bintoken::error(invalid_length);
+    const value_type *footer = input.data() + input.size() - block::footer_size;
+    if (endian::load<std::uint32_t>(footer + 12) != block::magic)
+        throw bintoken::error(invalid_value);
+
+    const std::uint64_t offset = endian::load<std::uint64_t>(footer);
+    const std::uint64_t entries = endian::load<std::uint32_t>(footer + 8);
+    const std::uint64_t available = input.size() - block::footer_size;
+    if ((offset > available) ||
+        ((available - offset) != entries * block::index_entry_size))
+        throw bintoken::error(invalid_length);
+
+    count = size_type(entries);
+    index_offset = size_type(offset);
+}
+
+template <typename T>
+block_reader::block_reader(const T& input)
+    : block_reader(buffer::traits<T>::view_cast(input))
+{
+}
+
+inline auto block_reader::size() const BOOST_NOEXCEPT -> size_type
+{
+    return count;
+}
+
+inline auto block_reader::length(size_type index) const -> size_type
+{
+    std::error_code ec;
+    auto frame = header(index, ec);
+    if (ec)
+        throw bintoken::error(ec);
+    return detail::endian::load<std::uint32_t>(frame.data() + 5);
+}
+
+inline void block_reader::read(size_type index,
+                               std::vector<value_type>& output,
+                               std::error_code& ec) const
+{
+    using namespace detail;
+
+    auto frame = header(index, ec);
+    if (ec)
+        return;
+
+    const value_type *payload = frame.data() + block::header_size;
+    const size_type payload_size = frame.size() - block::header_size;
+    const size_type size = endian::load<std::uint32_t>(frame.data() + 5);
+    output.resize(size);
+    switch (frame[0])
+    {
+    case block::method::stored:
+        if (payload_size != size)
+        {
+            ec = invalid_length;
+            return;
+        }
+        if (size > 0)
+        {
+            std::memcpy(output.data(), payload, size);
+        }
+        break;
+
+    case block::method::lz:
+        if (lz::decompress(payload, payload_size, output.data(), size) != size)
+        {
+            ec = invalid_value;
+            return;
+        }
+        break;
+
+    default:
+        ec = invalid_value;
+        return;
+    }
+
+    if (block::adler32(output.data(), size) != endian::load<std::uint32_t>(frame.data() + 9))
+    {
+        ec = invalid_checksum;
+    }
+}
+
+inline void block_reader::read(size_type index,
+                               std::vector<value_type>& output) const
+{
+    std::error_code ec;
+    read(index, output, ec);
+    if (ec)
+        throw bintoken::error(ec);
+}
+
+inline auto block_reader::header(size_type index, std::error_code& ec) const -> view_type
+{
+    using namespace detail;
+
+    if (index >= count)
+    {
+        ec = invalid_value;
+        return {};
+    }
+    const value_type *entry = input.data() + index_offset + index * block::index_entry_size;
+    const std::uint64_t offset = endian::load<std::uint64_t>(entry);
+    if ((offset > index_offset) || (index_offset - offset < block::header_size))
+    {
+        ec = invalid_length;
+        return {};
+    }
+    const value_type *frame = input.data() + offset;
+    const std::uint64_t stored = endian::load<std::uint32_t>(frame + 1);
+    if (index_offset - offset - block::header_size < stored)
+    {
+        ec = invalid_length;
+        return {};
+    }
+    return view_type(frame, size_type(block::header_size + stored));
+}
+
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_DETAIL_BLOCK_READER_IPP
@@ -0,0 +1,120 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_DETAIL_BLOCK_WRITER_IPP
+#define TRIAL_PROTOCOL_BINTOKEN_DETAIL_BLOCK_WRITER_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <limits>
+#include <trial/protocol/bintoken/detail/block.hpp>
+#include <trial/protocol/bintoken/detail/endian.hpp>
+#include <trial/protocol/bintoken/detail/lz.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+
+template <typename T>
+block_writer::block_writer(T& output)
+    : buffer(new typename buffer::traits<T>::buffer_type(output))
+{
+}
+
+inline block_writer::~block_writer()
+{
+    if (!closed)
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+        }
+    }
+}
+
+inline auto block_writer::write(const view_type& data) -> size_type
+{
+    if (closed)
+        throw bintoken::error(invalid_value);
+    if (data.size() > std::numeric_limits<std::uint32_t>::max())
+        throw bintoken::error(invalid_length);
+
+    scratch.assign(detail::block::header_size, 0);
+    detail::lz::compress(data.data(), data.size(), scratch);
+    const size_type compressed = scratch.size() - detail::block::header_size;
+    const bool stored = (compressed >= data.size());
+
+    value_type *header = scratch.data();
+    header[0] = stored ? detail::block::method::stored : detail::block::method::lz;
+    detail::endian::store(header + 1, std::uint32_t(stored ? data.size() : compressed));
+    detail::endian::store(header + 5, std::uint32_t(data.size()));
+    detail::endian::store(header + 9, detail::block::adler32(data.data(), data.size()));
+
+    offsets.push_back(offset);
+    if (stored)
+    {
+        output(header, detail::block::header_size);
+        output(data.data(), data.size());
+    }
+    else
+    {
+        output(scratch.data(), scratch.size());
+    }
+    return offsets.size() - 1;
+}
+
+template <typename T>
+auto block_writer::write(const T& data) -> size_type
+{
+    return write(buffer::traits<T>::view_cast(data));
+}
+
+inline void block_writer::close()
+{
+    if (closed)
+        return;
+    closed = true;
+
+    const std::uint64_t index_offset = offset;
+    value_type entry[detail::block::index_entry_size];
+    for (auto block_offset : offsets)
+    {
+        detail::endian::store(entry, block_offset);
+        output(entry, sizeof(entry));
+    }
+    value_type footer[detail::block::footer_size];
+    detail::endian::store(footer, index_offset);
+    detail::endian::store(footer + 8, std::uint32_t(offsets.size()));
+    detail::endian::store(footer + 12, detail::block::magic);
+    output(footer, sizeof(footer));
+}
+
+inline auto block_writer::size() const BOOST_NOEXCEPT -> size_type
+{
+    return offsets.size();
+}
+
+inline void block_writer::output(const value_type *data, size_type size)
+{
+    if (!buffer->grow(size))
+        throw bintoken::error(overflow);
+    buffer->write(view_type(data, size));
+    offset += size;
+}
+
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_DETAIL_BLOCK_WRITER_IPP
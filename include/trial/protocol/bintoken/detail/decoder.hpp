@@ -38,6 +38,7 @@ public:
     template <typename T> decoder(const T& input);
 
     void next() BOOST_NOEXCEPT;
+    void skip() BOOST_NOEXCEPT;
 
     void code(token::code::value) BOOST_NOEXCEPT;
     token::code::value code() const BOOST_NOEXCEPT;
@@ -55,10 +56,15 @@ public:
     size_type array(token::int64::type *output, size_type output_length);
     size_type array(token::float32::type *output, size_type output_length);
     size_type array(token::float64::type *output, size_type output_length);
+    template <typename T> size_type delta_array(T *output, size_type output_length);
+    size_type delta_length() const;
 
 private:
     token::code::value next(value_type, std::int64_t) BOOST_NOEXCEPT;
     token::code::value next_length(value_type, size_type) BOOST_NOEXCEPT;
+    token::code::value next_container(value_type) BOOST_NOEXCEPT;
+    token::code::value next_varint() BOOST_NOEXCEPT;
+    token::code::value next_delta_array() BOOST_NOEXCEPT;
 
     template <typename Tag>
     token::code::value advance() BOOST_NOEXCEPT;
@@ -15,6 +15,8 @@
 #include <cstring> // std::memcpy
 #include <string>
 #include <trial/protocol/buffer/base.hpp>
+#include <trial/protocol/bintoken/detail/endian.hpp>
+#include <trial/protocol/bintoken/detail/varint.hpp>
 
 namespace trial
 {
@@ -114,7 +116,8 @@ struct decoder::overloader<token::int16>
     static return_type decode(const detail::decoder& self)
     {
         assert(self.code() == token::int16::code);
-        return endian(self.literal());
+        assert(self.literal().size() == sizeof(return_type));
+        return endian::load<return_type>(self.literal().data());
     }
 
     static size_type decode(const detail::decoder& self,
@@ -136,10 +139,7 @@ struct decoder::overloader<token::int16>
             {
                 auto view = self.literal();
                 const auto size = std::min(view.size() / token::int16::size, output_length);
-                for (size_type i = 0; i < size; ++i)
-                {
-                    output[i] = endian(view_type(&view[i * token::int16::size], token::int16::size));
-                }
+                endian::load(output, view.data(), size);
                 return size;
             }
 
@@ -147,16 +147,6 @@ struct decoder::overloader<token::int16>
             throw bintoken::error(invalid_value);
         }
     }
-
-    static return_type endian(const view_type& view)
-    {
-        assert(view.size() == sizeof(return_type));
-        const std::uint16_t endian = UINT16_C(0x0100);
-        return_type result = 0;
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[0]] = static_cast<std::uint8_t>(view[0]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[1]] = static_cast<std::uint8_t>(view[1]);
-        return result;
-    }
 };
 
 template <>
@@ -167,7 +157,8 @@ struct decoder::overloader<token::int32>
     static return_type decode(const detail::decoder& self)
     {
         assert(self.code() == token::int32::code);
-        return endian(self.literal());
+        assert(self.literal().size() == sizeof(return_type));
+        return endian::load<return_type>(self.literal().data());
     }
 
     static size_type decode(const detail::decoder& self,
@@ -189,10 +180,7 @@ struct decoder::overloader<token::int32>
             {
                 auto view = self.literal();
                 const auto size = std::min(view.size() / token::int32::size, output_length);
-                for (size_type i = 0; i < size; ++i)
-                {
-                    output[i] = endian(view_type(&view[i * token::int32::size], token::int32::size));
-                }
+                endian::load(output, view.data(), size);
                 return size;
             }
 
@@ -200,18 +188,6 @@ struct decoder::overloader<token::int32>
             throw bintoken::error(invalid_value);
         }
     }
-
-    static return_type endian(const view_type& view)
-    {
-        assert(view.size() == sizeof(return_type));
-        const std::uint32_t endian = UINT32_C(0x03020100);
-        return_type result = 0;
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[0]] = static_cast<std::uint8_t>(view[0]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[1]] = static_cast<std::uint8_t>(view[1]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[2]] = static_cast<std::uint8_t>(view[2]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[3]] = static_cast<std::uint8_t>(view[3]);
-        return result;
-    }
 };
 
 template <>
@@ -222,7 +198,8 @@ struct decoder::overloader<token::int64>
     static return_type decode(const detail::decoder& self)
     {
         assert(self.code() == token::int64::code);
-        return endian(self.literal());
+        assert(self.literal().size() == sizeof(return_type));
+        return endian::load<return_type>(self.literal().data());
     }
 
     static size_type decode(const detail::decoder& self,
@@ -244,10 +221,7 @@ struct decoder::overloader<token::int64>
             {
                 auto view = self.literal();
                 const auto size = std::min(view.size() / token::int64::size, output_length);
-                for (size_type i = 0; i < size; ++i)
-                {
-                    output[i] = endian(view_type(&view[i * token::int64::size], token::int64::size));
-                }
+                endian::load(output, view.data(), size);
                 return size;
             }
 
@@ -255,22 +229,6 @@ struct decoder::overloader<token::int64>
             throw bintoken::error(invalid_value);
         }
     }
-
-    static return_type endian(const view_type& view)
-    {
-        assert(view.size() == sizeof(return_type));
-        const std::uint64_t endian = UINT64_C(0x0706050403020100);
-        return_type result = 0;
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[0]] = static_cast<std::uint8_t>(view[0]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[1]] = static_cast<std::uint8_t>(view[1]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[2]] = static_cast<std::uint8_t>(view[2]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[3]] = static_cast<std::uint8_t>(view[3]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[4]] = static_cast<std::uint8_t>(view[4]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[5]] = static_cast<std::uint8_t>(view[5]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[6]] = static_cast<std::uint8_t>(view[6]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[7]] = static_cast<std::uint8_t>(view[7]);
-        return result;
-    }
 };
 
 template <>
@@ -282,7 +240,8 @@ struct decoder::overloader<token::float32>
     {
         // IEEE 754 single precision
         assert(self.code() == token::float32::code);
-        return endian(self.literal());
+        assert(self.literal().size() == sizeof(return_type));
+        return endian::load<return_type>(self.literal().data());
     }
 
     static size_type decode(const detail::decoder& self,
@@ -304,10 +263,7 @@ struct decoder::overloader<token::float32>
             {
                 auto view = self.literal();
                 const auto size = std::min(view.size() / token::float32::size, output_length);
-                for (size_type i = 0; i < size; ++i)
-                {
-                    output[i] = endian(view_type(&view[i * token::float32::size], token::float32::size));
-                }
+                endian::load(output, view.data(), size);
                 return size;
             }
 
@@ -315,18 +271,6 @@ struct decoder::overloader<token::float32>
             throw bintoken::error(invalid_value);
         }
     }
-
-    static return_type endian(const view_type& view)
-    {
-        assert(view.size() == sizeof(return_type));
-        const std::uint32_t endian = UINT32_C(0x03020100);
-        return_type result = 0;
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[0]] = static_cast<std::uint8_t>(view[0]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[1]] = static_cast<std::uint8_t>(view[1]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[2]] = static_cast<std::uint8_t>(view[2]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[3]] = static_cast<std::uint8_t>(view[3]);
-        return result;
-    }
 };
 
 template <>
@@ -337,7 +281,8 @@ struct decoder::overloader<token::float64>
     static return_type decode(const detail::decoder& self)
     {
         assert(self.code() == token::float64::code);
-        return endian(self.literal());
+        assert(self.literal().size() == sizeof(return_type));
+        return endian::load<return_type>(self.literal().data());
     }
 
     static size_type decode(const detail::decoder& self,
@@ -359,10 +304,7 @@ struct decoder::overloader<token::float64>
             {
                 auto view = self.literal();
                 const auto size = std::min(view.size() / token::float64::size, output_length);
-                for (size_type i = 0; i < size; ++i)
-                {
-                    output[i] = endian(view_type(&view[i * token::float64::size], token::float64::size));
-                }
+                endian::load(output, view.data(), size);
                 return size;
             }
 
@@ -370,21 +312,21 @@ struct decoder::overloader<token::float64>
             throw bintoken::error(invalid_value);
         }
     }
+};
+
+template <>
+struct decoder::overloader<token::varint>
+{
+    using return_type = token::varint::type;
 
-    static return_type endian(const view_type& view)
+    static return_type decode(const detail::decoder& self)
     {
-        assert(view.size() == sizeof(return_type));
-        const std::uint64_t endian = UINT64_C(0x0706050403020100);
-        return_type result = 0;
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[0]] = static_cast<std::uint8_t>(view[0]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[1]] = static_cast<std::uint8_t>(view[1]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[2]] = static_cast<std::uint8_t>(view[2]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[3]] = static_cast<std::uint8_t>(view[3]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[4]] = static_cast<std::uint8_t>(view[4]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[5]] = static_cast<std::uint8_t>(view[5]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[6]] = static_cast<std::uint8_t>(view[6]);
-        ((volatile std::uint8_t *)&result)[((std::uint8_t *)&endian)[7]] = static_cast<std::uint8_t>(view[7]);
-        return result;
+        assert(self.code() == token::varint::code);
+        std::uint64_t result = 0;
+        const auto size = varint::read(self.literal().data(), self.literal().size(), result);
+        assert(size == self.literal().size());
+        (void)size;
+        return varint::unzigzag(result);
     }
 };
 
@@ -488,12 +430,54 @@ inline auto decoder::array(token::float64::type *buffer, size_type size) -> size
     return overloader<token::float64>::decode(*this, buffer, size);
 }
 
+template <typename T>
+auto decoder::delta_array(T *output, size_type output_length) -> size_type
+{
+    assert(code() == token::code::delta_array);
+
+    const value_type *cursor = literal().data();
+    const value_type * const tail = cursor + literal().size();
+    std::uint64_t count = 0;
+    cursor += varint::read(cursor, tail - cursor, count);
+    const size_type size = std::min(size_type(count), output_length);
+
+    // Values are accumulated with wrap-around so that the full range of
+    // both signed and unsigned 64-bit integers can be represented.
+    std::uint64_t current = 0;
+    for (size_type i = 0; i < size; ++i)
+    {
+        std::uint64_t delta = 0;
+        const auto length = varint::read(cursor, tail - cursor, delta);
+        if (length == 0)
+            throw bintoken::error(invalid_value);
+        cursor += length;
+        current += std::uint64_t(varint::unzigzag(delta));
+        if (!varint::convert(current, output[i]))
+            throw bintoken::error(overflow);
+    }
+    return size;
+}
+
+inline auto decoder::delta_length() const -> size_type
+{
+    assert(code() == token::code::delta_array);
+
+    std::uint64_t count = 0;
+    varint::read(literal().data(), literal().size(), count);
+    return size_type(count);
+}
+
 //-----------------------------------------------------------------------------
 
 inline void decoder::next() BOOST_NOEXCEPT
 {
     // FIXME: return if error
 
+    while (!input.empty() && (input.front() == token::code::padding))
+    {
+        input.remove_prefix(1);
+    }
+
     if (input.empty())
     {
         current.code = token::code::end;
@@ -636,10 +620,39 @@ inline void decoder::next() BOOST_NOEXCEPT
         case token::code::string64:
             current.code = next_length(element, token::int8::size);
             break;
+
+        case token::code::length8:
+        case token::code::length16:
+        case token::code::length32:
+        case token::code::length64:
+            current.code = next_container(element);
+            break;
+
+        case token::code::varint:
+            current.code = next_varint();
+            break;
+
+        case token::code::delta_array:
+            current.code = next_delta_array();
+            break;
+
+        case token::code::index:
+            // The index footer is not part of the token stream
+            current.code = token::code::end;
+            current.view = view_type();
+            input = view_type();
+            break;
         }
     }
 }
 
+inline void decoder::skip() BOOST_NOEXCEPT
+{
+    // The literal of a length-prefixed container spans its content
+    input.remove_prefix(current.view.size());
+    next();
+}
+
 inline token::code::value decoder::next_length(value_type element, size_type size_alignment) BOOST_NOEXCEPT
 {
     if (input.empty())
@@ -694,6 +707,115 @@ inline token::code::value decoder::next_length(value_type element, size_type siz
     return token::code::error_unknown_token;
 }
 
+inline token::code::value decoder::next_container(value_type element) BOOST_NOEXCEPT
+{
+    size_type size = 0;
+    switch (element)
+    {
+    case token::code::length8:
+        current.code = advance<token::int8>();
+        if (category() == token::category::status)
+            return current.code;
+        size = static_cast<uint8_t>(value<token::int8>());
+        break;
+
+    case token::code::length16:
+        current.code = advance<token::int16>();
+        if (category() == token::category::status)
+            return current.code;
+        size = static_cast<uint16_t>(value<token::int16>());
+        break;
+
+    case token::code::length32:
+        current.code = advance<token::int32>();
+        if (category() == token::category::status)
+            return current.code;
+        size = static_cast<uint32_t>(value<token::int32>());
+        break;
+
+    case token::code::length64:
+        current.code = advance<token::int64>();
+        if (category() == token::category::status)
+            return current.code;
+        size = static_cast<uint64_t>(value<token::int64>());
+        break;
+    }
+
+    // The length covers both the begin and the end token
+    if (size < 2)
+        return token::code::error_invalid_length;
+    if (input.size() < size)
+        return token::code::end;
+
+    token::code::value end_code;
+    const auto begin_code = static_cast<token::code::value>(input.front());
+    switch (begin_code)
+    {
+    case token::code::begin_record:
+        end_code = token::code::end_record;
+        break;
+
+    case token::code::begin_array:
+        end_code = token::code::end_array;
+        break;
+
+    case token::code::begin_assoc_array:
+        end_code = token::code::end_assoc_array;
+        break;
+
+    default:
+        return token::code::error_unexpected_token;
+    }
+    if (input[size - 1] != end_code)
+        return token::code::error_invalid_length;
+
+    // The content is decoded as usual, but the literal spans it so that
+    // skip() can jump past the entire container.
+    current.view = input.substr(1, size - 1);
+    input.remove_prefix(1);
+    return begin_code;
+}
+
+inline token::code::value decoder::next_varint() BOOST_NOEXCEPT
+{
+    std::uint64_t value = 0;
+    const auto size = varint::read(input.data(), input.size(), value);
+    if (size == 0)
+    {
+        return (input.size() < varint::max_size)
+            ? token::code::end
+            : token::code::error_overflow;
+    }
+    current.view = input.substr(0, size);
+    input.remove_prefix(size);
+    return token::code::varint;
+}
+
+inline token::code::value decoder::next_delta_array() BOOST_NOEXCEPT
+{
+    std::uint64_t size = 0;
+    const auto length_size = varint::read(input.data(), input.size(), size);
+    if (length_size == 0)
+    {
+        return (input.size() < varint::max_size)
+            ? token::code::end
+            : token::code::error_overflow;
+    }
+    if (input.size() - length_size < size)
+        return token::code::end;
+
+    // Every element occupies at least one byte
+    const view_type payload = input.substr(length_size, size);
+    std::uint64_t count = 0;
+    const auto count_size = varint::read(payload.data(), payload.size(), count);
+    if ((count_size == 0) || (payload.size() - count_size < count))
+        return token::code::error_invalid_length;
+
+    current.view = payload;
+    input.remove_prefix(length_size + size);
+    return token::code::delta_array;
+}
+
 inline token::code::value decoder::next(value_type element, std::int64_t size) BOOST_NOEXCEPT
 {
     if (size < 0)
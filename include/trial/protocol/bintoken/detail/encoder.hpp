@@ -62,6 +62,17 @@ public:
     size_type array(const token::float32::type *, size_type);
     size_type array(const token::float64::type *, size_type);
 
+    size_type varint_value(std::int64_t);
+    template <typename T> size_type delta_array(const T *, size_type);
+
+    size_type padding(size_type);
+    size_type length(size_type);
+    size_type literal(const view_type&);
+
+    static size_type array_header_size(size_type);
+    static size_type varint_size(std::int64_t);
+    template <typename T> static size_type delta_array_size(const T *, size_type);
+
 private:
     template <typename T, typename = void>
     struct overloader;
@@ -83,6 +94,12 @@ private:
     void endian_write(std::uint32_t);
     void endian_write(std::uint64_t);
 
+    template <typename T>
+    void endian_write(const T *, size_type);
+
+    template <typename T>
+    static size_type delta_payload_size(const T *, size_type);
+
     buffer_type& buffer();
     const buffer_type& buffer() const;
 
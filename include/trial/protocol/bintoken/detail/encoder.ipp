@@ -12,9 +12,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <limits>
+#include <boost/predef/other/endian.h>
 #include <trial/protocol/buffer/base.hpp>
 #include <trial/protocol/bintoken/token.hpp>
 #include <trial/protocol/bintoken/error.hpp>
+#include <trial/protocol/bintoken/detail/varint.hpp>
 
 namespace trial
 {
@@ -396,10 +398,7 @@ auto basic_encoder<N>::array(const token::int16::type *data,
         size = write_length(static_cast<std::uint64_t>(length_size));
     }
 
-    for (size_type i = 0; i < length; ++i)
-    {
-        endian_write(data[i]);
-    }
+    endian_write(data, length);
     return sizeof(value_type) + size + length_size;
 }
 
@@ -441,10 +440,7 @@ auto basic_encoder<N>::array(const token::int32::type *data,
         size = write_length(static_cast<std::uint64_t>(length_size));
     }
 
-    for (size_type i = 0; i < length; ++i)
-    {
-        endian_write(data[i]);
-    }
+    endian_write(data, length);
     return sizeof(value_type) + size + length_size;
 }
 
@@ -486,10 +482,7 @@ auto basic_encoder<N>::array(const token::int64::type *data,
         size = write_length(static_cast<std::uint64_t>(length_size));
     }
 
-    for (size_type i = 0; i < length; ++i)
-    {
-        endian_write(data[i]);
-    }
+    endian_write(data, length);
     return sizeof(value_type) + size + length_size;
 }
 
@@ -531,10 +524,7 @@ auto basic_encoder<N>::array(const token::float32::type *data,
         size = write_length(static_cast<std::uint64_t>(length_size));
     }
 
-    for (size_type i = 0; i < length; ++i)
-    {
-        endian_write(data[i]);
-    }
+    endian_write(data, length);
     return sizeof(value_type) + size + length_size;
 }
 
@@ -576,11 +566,148 @@ auto basic_encoder<N>::array(const token::float64::type *data,
         size = write_length(static_cast<std::uint64_t>(length_size));
     }
 
+    endian_write(data, length);
+    return sizeof(value_type) + size + length_size;
+}
+
+template <std::size_t N>
+auto basic_encoder<N>::padding(size_type count) -> size_type
+{
+    if (!buffer().grow(count))
+        return 0;
+    for (size_type i = 0; i < count; ++i)
+    {
+        buffer().write(token::code::padding);
+    }
+    return count;
+}
+
+template <std::size_t N>
+auto basic_encoder<N>::varint_value(std::int64_t data) -> size_type
+{
+    value_type output[sizeof(value_type) + varint::max_size];
+    output[0] = token::code::varint;
+    const size_type size = sizeof(value_type) + varint::write(varint::zigzag(data), output + 1);
+    return write(view_type(output, size));
+}
+
+template <std::size_t N>
+template <typename T>
+auto basic_encoder<N>::delta_array(const T *data, size_type length) -> size_type
+{
+    static_assert(std::is_integral<T>::value, "Delta arrays require integers");
+
+    const size_type payload = delta_payload_size(data, length);
+    const size_type size = sizeof(value_type) + varint::size(payload) + payload;
+    if (!buffer().grow(size))
+        return 0;
+
+    // Varints are collected in a local chunk to avoid a virtual call per byte
+    value_type chunk[256];
+    size_type used = 0;
+    chunk[used++] = token::code::delta_array;
+    used += varint::write(payload, chunk + used);
+    used += varint::write(length, chunk + used);
+
+    std::uint64_t previous = 0;
     for (size_type i = 0; i < length; ++i)
     {
-        endian_write(data[i]);
+        if (used > sizeof(chunk) - varint::max_size)
+        {
+            buffer().write(view_type(chunk, used));
+            used = 0;
+        }
+        const std::uint64_t current = static_cast<std::uint64_t>(data[i]);
+        used += varint::write(varint::zigzag(std::int64_t(current - previous)), chunk + used);
+        previous = current;
     }
-    return sizeof(value_type) + size + length_size;
+    buffer().write(view_type(chunk, used));
+    return size;
+}
+
+// Byte length prefix of a container
+template <std::size_t N>
+auto basic_encoder<N>::length(size_type data) -> size_type
+{
+    if (data <= static_cast<size_type>(std::numeric_limits<std::uint8_t>::max()))
+    {
+        if (!buffer().grow(sizeof(value_type) + sizeof(std::uint8_t)))
+            return 0;
+        buffer().write(token::code::length8);
+        return sizeof(value_type) + write_length(static_cast<std::uint8_t>(data));
+    }
+    else if (data <= static_cast<size_type>(std::numeric_limits<std::uint16_t>::max()))
+    {
+        if (!buffer().grow(sizeof(value_type) + sizeof(std::uint16_t)))
+            return 0;
+        buffer().write(token::code::length16);
+        return sizeof(value_type) + write_length(static_cast<std::uint16_t>(data));
+    }
+    else if (data <= static_cast<size_type>(std::numeric_limits<std::uint32_t>::max()))
+    {
+        if (!buffer().grow(sizeof(value_type) + sizeof(std::uint32_t)))
+            return 0;
+        buffer().write(token::code::length32);
+        return sizeof(value_type) + write_length(static_cast<std::uint32_t>(data));
+    }
+    else
+    {
+        if (!buffer().grow(sizeof(value_type) + sizeof(std::uint64_t)))
+            return 0;
+        buffer().write(token::code::length64);
+        return sizeof(value_type) + write_length(static_cast<std::uint64_t>(data));
+    }
+}
+
+// Already encoded tokens
+template <std::size_t N>
+auto basic_encoder<N>::literal(const view_type& data) -> size_type
+{
+    return write(data);
+}
+
+// Size of the token and length field written in front of a compact array
+// payload of the given number of bytes.
+template <std::size_t N>
+auto basic_encoder<N>::array_header_size(size_type length) -> size_type
+{
+    if (length < static_cast<std::string::size_type>(std::numeric_limits<std::uint8_t>::max()))
+        return sizeof(value_type) + sizeof(std::uint8_t);
+    if (length < static_cast<std::string::size_type>(std::numeric_limits<std::uint16_t>::max()))
+        return sizeof(value_type) + sizeof(std::uint16_t);
+    if (length < static_cast<std::string::size_type>(std::numeric_limits<std::uint32_t>::max()))
+        return sizeof(value_type) + sizeof(std::uint32_t);
+    return sizeof(value_type) + sizeof(std::uint64_t);
+}
+
+template <std::size_t N>
+auto basic_encoder<N>::varint_size(std::int64_t data) -> size_type
+{
+    return sizeof(value_type) + varint::size(varint::zigzag(data));
+}
+
+template <std::size_t N>
+template <typename T>
+auto basic_encoder<N>::delta_array_size(const T *data, size_type length) -> size_type
+{
+    const size_type payload = delta_payload_size(data, length);
+    return sizeof(value_type) + varint::size(payload) + payload;
+}
+
+// Size of the element count and the differences
+template <std::size_t N>
+template <typename T>
+auto basic_encoder<N>::delta_payload_size(const T *data, size_type length) -> size_type
+{
+    size_type result = varint::size(length);
+    std::uint64_t previous = 0;
+    for (size_type i = 0; i < length; ++i)
+    {
+        const std::uint64_t current = static_cast<std::uint64_t>(data[i]);
+        result += varint::size(varint::zigzag(std::int64_t(current - previous)));
+        previous = current;
+    }
+    return result;
 }
 
 template <std::size_t N>
@@ -745,6 +872,23 @@ void basic_encoder<N>::endian_write(token::float64::type data)
     buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[7]]));
 }
 
+template <std::size_t N>
+template <typename T>
+void basic_encoder<N>::endian_write(const T *data, size_type length)
+{
+#if BOOST_ENDIAN_LITTLE_BYTE
+    // Host order is the same as the encoding order so the entire payload
+    // can be written at once.
+    buffer().write(view_type(reinterpret_cast<const value_type *>(data),
+                             length * sizeof(T)));
+#else
+    for (size_type i = 0; i < length; ++i)
+    {
+        endian_write(data[i]);
+    }
+#endif
+}
+
 template <std::size_t N>
 auto basic_encoder<N>::buffer() -> buffer_type&
 {
@@ -0,0 +1,104 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_DETAIL_ENDIAN_HPP
+#define TRIAL_PROTOCOL_BINTOKEN_DETAIL_ENDIAN_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <boost/predef/other/endian.h>
+
+// Numbers are encoded in little-endian order. The conversion functions use
+// plain copying on little-endian hosts, and otherwise reassemble the bytes
+// with shifts which compilers turn into byte-swap instructions.
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+namespace detail
+{
+namespace endian
+{
+
+template <std::size_t N>
+struct unsigned_type;
+
+template <>
+struct unsigned_type<2>
+{
+    using type = std::uint16_t;
+};
+
+template <>
+struct unsigned_type<4>
+{
+    using type = std::uint32_t;
+};
+
+template <>
+struct unsigned_type<8>
+{
+    using type = std::uint64_t;
+};
+
+//! @brief Converts a single value from encoding order to host order.
+template <typename T>
+T load(const std::uint8_t *input)
+{
+    T result;
+#if BOOST_ENDIAN_LITTLE_BYTE
+    std::memcpy(&result, input, sizeof(T));
+#else
+    using integer_type = typename unsigned_type<sizeof(T)>::type;
+    integer_type value = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        value |= integer_type(input[i]) << (8 * i);
+    }
+    std::memcpy(&result, &value, sizeof(T));
+#endif
+    return result;
+}
+
+//! @brief Converts consecutive values from encoding order to host order.
+template <typename T>
+void load(T *output, const std::uint8_t *input, std::size_t count)
+{
+#if BOOST_ENDIAN_LITTLE_BYTE
+    std::memcpy(output, input, count * sizeof(T));
+#else
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        output[i] = load<T>(input + i * sizeof(T));
+    }
+#endif
+}
+
+//! @brief Converts an integer from host order to encoding order.
+template <typename T>
+void store(std::uint8_t *output, T value)
+{
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        output[i] = std::uint8_t(value >> (8 * i));
+    }
+}
+
+} // namespace endian
+} // namespace detail
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_DETAIL_ENDIAN_HPP
@@ -62,6 +62,15 @@ public:
 
         case expected_end_assoc_array:
             return "expected end assoc array bracket";
+
+        case invalid_length:
+            return "invalid length";
+
+        case insufficient_tokens:
+            return "insufficient tokens";
+
+        case invalid_checksum:
+            return "invalid checksum";
         }
         return "trial.protocol.bintoken error";
     }
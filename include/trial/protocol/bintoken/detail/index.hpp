@@ -0,0 +1,56 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_DETAIL_INDEX_HPP
+#define TRIAL_PROTOCOL_BINTOKEN_DETAIL_INDEX_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+
+// Index footer layout (all numbers are little-endian)
+//
+//   footer  = index-token *entry trailer
+//   entry   = offset:u64 [key:i64]
+//   trailer = footer-offset:u64 count:u64 flags:u32 magic:u32
+//
+// Offsets are measured from the beginning of the writer output. Entries
+// contain keys if the keys flag is set.
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+namespace detail
+{
+namespace index
+{
+
+const std::uint32_t magic = UINT32_C(0x58495442); // "BTIX"
+const std::size_t offset_size = 8;
+const std::size_t key_size = 8;
+const std::size_t trailer_size = 24;
+
+namespace flags
+{
+enum value : std::uint32_t
+{
+    keys = 1
+};
+} // namespace flags
+
+} // namespace index
+} // namespace detail
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_DETAIL_INDEX_HPP
@@ -0,0 +1,203 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_DETAIL_LZ_HPP
+#define TRIAL_PROTOCOL_BINTOKEN_DETAIL_LZ_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <vector>
+
+// Fast LZ77 compression in the style of LZ4.
+//
+// The compressed data is a sequence of commands. Each command starts with a
+// byte whose high nibble is the number of literals and whose low nibble is
+// the match length minus four. A nibble of 15 is followed by extension bytes
+// that are added to the length until a byte below 255 is found. The
+// literals follow, and then a two byte little-endian offset back into the
+// output where the match is copied from. The last command only contains
+// literals.
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+namespace detail
+{
+namespace lz
+{
+
+const std::size_t min_match = 4;
+const std::size_t max_offset = 0xFFFF;
+const std::size_t hash_bits = 12;
+
+inline std::uint32_t load32(const std::uint8_t *input)
+{
+    std::uint32_t result;
+    std::memcpy(&result, input, sizeof(result));
+    return result;
+}
+
+inline std::size_t hash(std::uint32_t sequence)
+{
+    return (sequence * UINT32_C(2654435761)) >> (32 - hash_bits);
+}
+
+inline void write_length(std::vector<std::uint8_t>& output, std::size_t length)
+{
+    while (length >= 0xFF)
+    {
+        output.push_back(0xFF);
+        length -= 0xFF;
+    }
+    output.push_back(std::uint8_t(length));
+}
+
+inline void write_command(std::vector<std::uint8_t>& output,
+                          const std::uint8_t *literals,
+                          std::size_t literal_length,
+                          std::size_t offset,
+                          std::size_t match_length)
+{
+    const std::size_t match_code = (match_length > 0) ? match_length - min_match : 0;
+    const std::uint8_t command = std::uint8_t(((literal_length < 15) ? literal_length : 15) << 4)
+        | std::uint8_t((match_code < 15) ? match_code : 15);
+    output.push_back(command);
+    if (literal_length >= 15)
+        write_length(output, literal_length - 15);
+    output.insert(output.end(), literals, literals + literal_length);
+    if (match_length > 0)
+    {
+        output.push_back(std::uint8_t(offset));
+        output.push_back(std::uint8_t(offset >> 8));
+        if (match_code >= 15)
+            write_length(output, match_code - 15);
+    }
+}
+
+//! @brief Appends the compressed input to output.
+inline void compress(const std::uint8_t *input,
+                     std::size_t length,
+                     std::vector<std::uint8_t>& output)
+{
+    // Positions are stored with an offset of one so that zero means empty
+    std::vector<std::uint32_t> table(std::size_t(1) << hash_bits, 0);
+
+    std::size_t anchor = 0;
+    std::size_t position = 0;
+    while (position + min_match <= length)
+    {
+        const std::uint32_t sequence = load32(input + position);
+        std::uint32_t& entry = table[hash(sequence)];
+        const std::size_t candidate = entry;
+        entry = std::uint32_t(position + 1);
+
+        if ((candidate > 0) &&
+            (position - (candidate - 1) <= max_offset) &&
+            (load32(input + candidate - 1) == sequence))
+        {
+            const std::size_t reference = candidate - 1;
+            std::size_t match_length = min_match;
+            while ((position + match_length < length) &&
+                   (input[reference + match_length] == input[position + match_length]))
+            {
+                ++match_length;
+            }
+            write_command(output,
+                          input + anchor,
+                          position - anchor,
+                          position - reference,
+                          match_length);
+            position += match_length;
+            anchor = position;
+        }
+        else
+        {
+            ++position;
+        }
+    }
+    write_command(output, input + anchor, length - anchor, 0, 0);
+}
+
+inline bool read_length(const std::uint8_t *& input,
+                        const std::uint8_t *tail,
+                        std::size_t& length)
+{
+    std::uint8_t extension;
+    do
+    {
+        if (input == tail)
+            return false;
+        extension = *input++;
+        length += extension;
+    } while (extension == 0xFF);
+    return true;
+}
+
+//! @brief Decompresses input into output, which must have room for the
+//!        entire decompressed data.
+//!
+//! @returns Number of decompressed bytes, or zero if input is malformed.
+inline std::size_t decompress(const std::uint8_t *input,
+                              std::size_t length,
+                              std::uint8_t *output,
+                              std::size_t output_length)
+{
+    const std::uint8_t *tail = input + length;
+    std::size_t size = 0;
+    while (input != tail)
+    {
+        const std::uint8_t command = *input++;
+
+        std::size_t literal_length = command >> 4;
+        if ((literal_length == 15) && !read_length(input, tail, literal_length))
+            return 0;
+        if ((std::size_t(tail - input) < literal_length) ||
+            (output_length - size < literal_length))
+            return 0;
+        std::memcpy(output + size, input, literal_length);
+        input += literal_length;
+        size += literal_length;
+
+        if (input == tail)
+            break; // Last command
+
+        if (tail - input < 2)
+            return 0;
+        const std::size_t offset = std::size_t(input[0]) | (std::size_t(input[1]) << 8);
+        input += 2;
+        std::size_t match_length = command & 0x0F;
+        if ((match_length == 15) && !read_length(input, tail, match_length))
+            return 0;
+        match_length += min_match;
+        if ((offset == 0) || (offset > size) || (output_length - size < match_length))
+            return 0;
+
+        // Byte by byte because the match may overlap its own output
+        const std::uint8_t *reference = output + size - offset;
+        for (std::size_t i = 0; i < match_length; ++i)
+        {
+            output[size + i] = reference[i];
+        }
+        size += match_length;
+    }
+    return size;
+}
+
+} // namespace lz
+} // namespace detail
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_DETAIL_LZ_HPP
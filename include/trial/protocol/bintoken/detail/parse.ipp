@@ -13,6 +13,7 @@
 
 #include <trial/protocol/bintoken/error.hpp>
 #include <trial/protocol/bintoken/reader.hpp>
+#include <trial/dynamic/string_pool.hpp>
 
 namespace trial
 {
@@ -28,9 +29,11 @@ class basic_parser
 {
 public:
     using variable_type = dynamic::basic_variable<Allocator>;
+    using pool_type = dynamic::basic_string_pool<Allocator>;
 
-    basic_parser(bintoken::reader& reader)
-        : reader(reader)
+    basic_parser(bintoken::reader& reader, pool_type *pool = nullptr)
+        : reader(reader),
+          pool(pool)
     {}
 
     // Parse outer scope
@@ -51,6 +54,7 @@ public:
 
         case token::symbol::array:
             outer = parse_compact_array();
+            reader.next();
             break;
 
         case token::symbol::begin_array:
@@ -186,7 +190,7 @@ private:
         while (reader.next())
         {
             // Key
-            dynamic::variable key;
+            variable_type key;
             switch (reader.symbol())
             {
             case token::symbol::end_assoc_array:
@@ -195,10 +199,13 @@ private:
             case token::symbol::boolean:
             case token::symbol::integer:
             case token::symbol::real:
-            case token::symbol::string:
                 key = parse_value();
                 break;
 
+            case token::symbol::string:
+                key = parse_key();
+                break;
+
             default:
                 throw bintoken::error(make_error_code(bintoken::incompatible_type));
             }
@@ -216,6 +223,10 @@ private:
             case token::symbol::end_record:
                 throw bintoken::error(make_error_code(bintoken::unexpected_token));
 
+            case token::symbol::array:
+                scope.insert({ std::move(key), parse_compact_array() });
+                break;
+
             case token::symbol::begin_array:
                 scope.insert({ std::move(key), parse_array() });
                 break;
@@ -259,7 +270,6 @@ private:
             {
                 std::vector<std::int8_t> input(reader.length());
                 reader.array<std::int8_t>(input.data(), input.size());
-                reader.next();
                 return dynamic::basic_array<Allocator>::make(input.begin(), input.end());
             }
 
@@ -270,7 +280,6 @@ private:
             {
                 std::vector<std::int16_t> input(reader.length());
                 reader.array<std::int16_t>(input.data(), input.size());
-                reader.next();
                 return dynamic::basic_array<Allocator>::make(input.begin(), input.end());
             }
 
@@ -281,7 +290,6 @@ private:
             {
                 std::vector<std::int32_t> input(reader.length());
                 reader.array<std::int32_t>(input.data(), input.size());
-                reader.next();
                 return dynamic::basic_array<Allocator>::make(input.begin(), input.end());
             }
 
@@ -289,10 +297,30 @@ private:
         case token::code::array16_int64:
         case token::code::array32_int64:
         case token::code::array64_int64:
+        case token::code::delta_array:
             {
                 std::vector<std::int64_t> input(reader.length());
                 reader.array<std::int64_t>(input.data(), input.size());
-                reader.next();
+                return dynamic::basic_array<Allocator>::make(input.begin(), input.end());
+            }
+
+        case token::code::array8_float32:
+        case token::code::array16_float32:
+        case token::code::array32_float32:
+        case token::code::array64_float32:
+            {
+                std::vector<float> input(reader.length());
+                reader.array<float>(input.data(), input.size());
+                return dynamic::basic_array<Allocator>::make(input.begin(), input.end());
+            }
+
+        case token::code::array8_float64:
+        case token::code::array16_float64:
+        case token::code::array32_float64:
+        case token::code::array64_float64:
+            {
+                std::vector<double> input(reader.length());
+                reader.array<double>(input.data(), input.size());
                 return dynamic::basic_array<Allocator>::make(input.begin(), input.end());
             }
 
@@ -301,6 +329,19 @@ private:
         }
     }
 
+    variable_type parse_key()
+    {
+        assert(reader.symbol() == token::symbol::string);
+
+        if (pool)
+        {
+            const auto& literal = reader.literal();
+            return pool->intern(reinterpret_cast<const char *>(literal.data()),
+                                literal.size());
+        }
+        return parse_value();
+    }
+
     variable_type parse_value()
     {
         switch (reader.code())
@@ -324,6 +365,7 @@ private:
             return reader.template value<std::int32_t>();
 
         case token::code::int64:
+        case token::code::varint:
             return reader.template value<std::int64_t>();
 
         case token::code::float32:
@@ -344,6 +386,7 @@ private:
     }
 
     bintoken::reader& reader;
+    pool_type *pool;
 };
 
 } // namespace detail
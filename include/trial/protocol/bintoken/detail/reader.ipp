@@ -13,8 +13,10 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <vector>
+#include <boost/predef/other/endian.h>
 #include <trial/protocol/core/detail/type_traits.hpp>
 #include <trial/protocol/bintoken/token.hpp>
 
@@ -141,6 +143,15 @@ struct reader::overloader<
                 return ReturnType(result);
             }
 
+        case token::varint::code:
+            {
+                token::varint::type result = self.decoder.value<token::varint>();
+                using widest_type = typename std::common_type<ReturnType, token::varint::type>::type;
+                if (widest_type(result) > widest_type(std::numeric_limits<ReturnType>::max()))
+                    throw bintoken::error(overflow);
+                return ReturnType(result);
+            }
+
         case token::float32::code:
             {
                 token::float32::type result = self.decoder.value<token::float32>();
@@ -176,7 +187,8 @@ struct reader::overloader<
         case token::code::float64:
             if (self.length() > output_length)
                 throw bintoken::error(overflow);
-            return self.decoder.array(output, output_length);
+            return self.decoder.array(reinterpret_cast<typename token::compact<ReturnType>::type *>(output),
+                                      output_length);
 
         case token::code::array8_int8:
         case token::code::array16_int8:
@@ -185,7 +197,8 @@ struct reader::overloader<
             assert(sizeof(ReturnType) == token::int8::size);
             if (self.length() > output_length)
                 throw bintoken::error(overflow);
-            return self.decoder.array(output, output_length);
+            return self.decoder.array(reinterpret_cast<typename token::compact<ReturnType>::type *>(output),
+                                      output_length);
 
         case token::code::array8_int16:
         case token::code::array16_int16:
@@ -194,7 +207,8 @@ struct reader::overloader<
             assert(sizeof(ReturnType) == token::int16::size);
             if (self.length() > output_length)
                 throw bintoken::error(overflow);
-            return self.decoder.array(output, output_length);
+            return self.decoder.array(reinterpret_cast<typename token::compact<ReturnType>::type *>(output),
+                                      output_length);
 
         case token::code::array8_int32:
         case token::code::array16_int32:
@@ -203,7 +217,8 @@ struct reader::overloader<
             assert(sizeof(ReturnType) == token::int32::size);
             if (self.length() > output_length)
                 throw bintoken::error(overflow);
-            return self.decoder.array(output, output_length);
+            return self.decoder.array(reinterpret_cast<typename token::compact<ReturnType>::type *>(output),
+                                      output_length);
 
         case token::code::array8_int64:
         case token::code::array16_int64:
@@ -212,7 +227,8 @@ struct reader::overloader<
             assert(sizeof(ReturnType) == token::int64::size);
             if (self.length() > output_length)
                 throw bintoken::error(overflow);
-            return self.decoder.array(output, output_length);
+            return self.decoder.array(reinterpret_cast<typename token::compact<ReturnType>::type *>(output),
+                                      output_length);
 
         case token::code::array8_float32:
         case token::code::array16_float32:
@@ -221,7 +237,8 @@ struct reader::overloader<
             assert(sizeof(ReturnType) == token::float32::size);
             if (self.length() > output_length)
                 throw bintoken::error(overflow);
-            return self.decoder.array(output, output_length);
+            return self.decoder.array(reinterpret_cast<typename token::compact<ReturnType>::type *>(output),
+                                      output_length);
 
         case token::code::array8_float64:
         case token::code::array16_float64:
@@ -230,7 +247,13 @@ struct reader::overloader<
             assert(sizeof(ReturnType) == token::float64::size);
             if (self.length() > output_length)
                 throw bintoken::error(overflow);
-            return self.decoder.array(output, output_length);
+            return self.decoder.array(reinterpret_cast<typename token::compact<ReturnType>::type *>(output),
+                                      output_length);
+
+        case token::code::delta_array:
+            if (self.length() > output_length)
+                throw bintoken::error(overflow);
+            return self.decoder.delta_array(output, output_length);
 
         default:
             throw bintoken::error(incompatible_type);
@@ -293,6 +316,17 @@ struct reader::overloader<
                 return ReturnType(wide);
             }
 
+        case token::varint::code:
+            {
+                token::varint::type result = self.decoder.value<token::varint>();
+                using unsigned_type = typename std::make_unsigned<token::varint::type>::type;
+                using widest_type = typename std::common_type<ReturnType, unsigned_type>::type;
+                const widest_type wide = widest_type(result) & std::numeric_limits<unsigned_type>::max();
+                if (wide > widest_type(std::numeric_limits<ReturnType>::max()))
+                    throw bintoken::error(overflow);
+                return ReturnType(wide);
+            }
+
         default:
             throw bintoken::error(invalid_value);
         }
@@ -311,7 +345,7 @@ struct reader::overloader<
             assert(sizeof(ReturnType) == token::int8::size);
             if (self.length() > output_length)
                 throw bintoken::error(overflow);
-            return self.decoder.array(reinterpret_cast<typename std::make_signed<ReturnType>::type *>(output),
+            return self.decoder.array(reinterpret_cast<typename token::compact<ReturnType>::type *>(output),
                                       output_length);
 
         case token::code::array8_int16:
@@ -321,7 +355,7 @@ struct reader::overloader<
             assert(sizeof(ReturnType) == token::int16::size);
             if (self.length() > output_length)
                 throw bintoken::error(overflow);
-            return self.decoder.array(reinterpret_cast<typename std::make_signed<ReturnType>::type *>(output),
+            return self.decoder.array(reinterpret_cast<typename token::compact<ReturnType>::type *>(output),
                                       output_length);
 
         case token::code::array8_int32:
@@ -331,7 +365,7 @@ struct reader::overloader<
             assert(sizeof(ReturnType) == token::int32::size);
             if (self.length() > output_length)
                 throw bintoken::error(overflow);
-            return self.decoder.array(reinterpret_cast<typename std::make_signed<ReturnType>::type *>(output),
+            return self.decoder.array(reinterpret_cast<typename token::compact<ReturnType>::type *>(output),
                                       output_length);
 
         case token::code::array8_int64:
@@ -341,9 +375,14 @@ struct reader::overloader<
             assert(sizeof(ReturnType) == token::int64::size);
             if (self.length() > output_length)
                 throw bintoken::error(overflow);
-            return self.decoder.array(reinterpret_cast<typename std::make_signed<ReturnType>::type *>(output),
+            return self.decoder.array(reinterpret_cast<typename token::compact<ReturnType>::type *>(output),
                                       output_length);
 
+        case token::code::delta_array:
+            if (self.length() > output_length)
+                throw bintoken::error(overflow);
+            return self.decoder.delta_array(output, output_length);
+
         default:
             throw bintoken::error(incompatible_type);
         }
@@ -391,6 +430,17 @@ reader::reader(const T& input)
     stack.push(token::code::end);
 }
 
+inline reader::reader(view_type view, size_type ordinal)
+    : reader(record_index(std::move(view)).seek(ordinal))
+{
+}
+
+template <typename T>
+reader::reader(const T& input, size_type ordinal)
+    : reader(buffer::traits<T>::view_cast(input), ordinal)
+{
+}
+
 inline token::code::value reader::code() const BOOST_NOEXCEPT
 {
     return decoder.code();
@@ -425,6 +475,7 @@ inline auto reader::length() const -> size_type
     case token::code::int16:
     case token::code::int32:
     case token::code::int64:
+    case token::code::varint:
     case token::code::float32:
     case token::code::float64:
         return 1;
@@ -465,6 +516,9 @@ inline auto reader::length() const -> size_type
     case token::code::array64_float64:
         return decoder.literal().size() / token::float64::size;
 
+    case token::code::delta_array:
+        return decoder.delta_length();
+
     case token::code::string8:
     case token::code::string16:
     case token::code::string32:
@@ -552,6 +606,32 @@ inline bool reader::next(token::code::value expect) BOOST_NOEXCEPT
     return next();
 }
 
+inline bool reader::next_sibling() BOOST_NOEXCEPT
+{
+    switch (symbol())
+    {
+    case token::symbol::begin_record:
+    case token::symbol::begin_array:
+    case token::symbol::begin_assoc_array:
+        if (!literal().empty())
+        {
+            // Length-prefixed container
+            decoder.skip();
+            return (category() != token::category::status);
+        }
+        else
+        {
+            const size_type current_level = level();
+            while (next() && (level() > current_level))
+                continue;
+            return (category() != token::category::status);
+        }
+
+    default:
+        return next();
+    }
+}
+
 template <typename ReturnType>
 typename token::type_cast<ReturnType>::type reader::value() const
 {
@@ -567,6 +647,24 @@ auto reader::array(T* output,
     return overloader<type>::convert(*this, output, output_length);
 }
 
+template <typename T>
+auto reader::array_view() const -> core::detail::span<T>
+{
+    static_assert(token::compact<T>::value, "Cannot view type as compact array");
+
+    if (!token::compact<T>::same(code()))
+        throw bintoken::error(incompatible_type);
+
+#if BOOST_ENDIAN_LITTLE_BYTE
+    const auto& view = literal();
+    if (reinterpret_cast<std::uintptr_t>(view.data()) % alignof(T) == 0)
+    {
+        return { reinterpret_cast<const T *>(view.data()), view.size() / sizeof(T) };
+    }
+#endif
+    return {};
+}
+
 inline const reader::view_type& reader::literal() const BOOST_NOEXCEPT
 {
     return decoder.literal();
@@ -0,0 +1,115 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_DETAIL_RECORD_INDEX_IPP
+#define TRIAL_PROTOCOL_BINTOKEN_DETAIL_RECORD_INDEX_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <trial/protocol/bintoken/token.hpp>
+#include <trial/protocol/bintoken/detail/endian.hpp>
+#include <trial/protocol/bintoken/detail/index.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+
+inline record_index::record_index(view_type view)
+    : input(std::move(view))
+{
+    using namespace detail;
+
+    if (input.size() < index::trailer_size + 1)
+        throw bintoken::error(invalid_length);
+    const value_type *trailer = input.data() + input.size() - index::trailer_size;
+    if (endian::load<std::uint32_t>(trailer + 20) != index::magic)
+        throw bintoken::error(invalid_value);
+
+    const std::uint64_t offset = endian::load<std::uint64_t>(trailer);
+    const std::uint64_t entries = endian::load<std::uint64_t>(trailer + 8);
+    keyed = (endian::load<std::uint32_t>(trailer + 16) & index::flags::keys) != 0;
+    entry_size = index::offset_size + (keyed ? index::key_size : 0);
+
+    // The footer starts with the index token followed by the entries
+    const std::uint64_t available = input.size() - index::trailer_size;
+    if ((offset >= available) ||
+        (input[offset] != token::code::index) ||
+        (entries > available / entry_size) ||
+        (available - offset - 1 != entries * entry_size))
+        throw bintoken::error(invalid_length);
+
+    count = size_type(entries);
+    footer_offset = size_type(offset);
+}
+
+template <typename T>
+record_index::record_index(const T& input)
+    : record_index(buffer::traits<T>::view_cast(input))
+{
+}
+
+inline auto record_index::size() const BOOST_NOEXCEPT -> size_type
+{
+    return count;
+}
+
+inline bool record_index::has_keys() const BOOST_NOEXCEPT
+{
+    return keyed;
+}
+
+inline auto record_index::offset(size_type ordinal) const -> size_type
+{
+    const std::uint64_t result = detail::endian::load<std::uint64_t>(entry(ordinal));
+    if (result >= footer_offset)
+        throw bintoken::error(invalid_length);
+    return size_type(result);
+}
+
+inline std::int64_t record_index::key(size_type ordinal) const
+{
+    if (!keyed)
+        throw bintoken::error(incompatible_type);
+    return detail::endian::load<std::int64_t>(entry(ordinal) + detail::index::offset_size);
+}
+
+inline auto record_index::find(std::int64_t key) const BOOST_NOEXCEPT -> size_type
+{
+    if (keyed)
+    {
+        for (size_type ordinal = 0; ordinal < count; ++ordinal)
+        {
+            const value_type *position = input.data() + footer_offset + 1 + ordinal * entry_size;
+            if (detail::endian::load<std::int64_t>(position + detail::index::offset_size) == key)
+                return ordinal;
+        }
+    }
+    return count;
+}
+
+inline auto record_index::seek(size_type ordinal) const -> view_type
+{
+    const size_type position = offset(ordinal);
+    return input.substr(position, footer_offset - position);
+}
+
+inline auto record_index::entry(size_type ordinal) const -> const value_type *
+{
+    if (ordinal >= count)
+        throw bintoken::error(invalid_value);
+    return input.data() + footer_offset + 1 + ordinal * entry_size;
+}
+
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_DETAIL_RECORD_INDEX_IPP
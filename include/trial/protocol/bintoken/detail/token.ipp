@@ -55,6 +55,7 @@ inline symbol::value symbol::convert(code::value value)
     case code::int16:
     case code::int32:
     case code::int64:
+    case code::varint:
         return symbol::integer;
 
     case code::float32:
@@ -91,6 +92,7 @@ inline symbol::value symbol::convert(code::value value)
     case code::array16_float64:
     case code::array32_float64:
     case code::array64_float64:
+    case code::delta_array:
         return symbol::array;
 
     case code::begin_record:
@@ -112,6 +114,17 @@ inline symbol::value symbol::convert(code::value value)
     case code::deprecated_end_assoc_array:
     case code::end_assoc_array:
         return symbol::end_assoc_array;
+
+    case code::padding:
+        // Padding is skipped by the decoder
+    case code::length8:
+    case code::length16:
+    case code::length32:
+    case code::length64:
+        // Length prefixes are consumed with the following container
+    case code::index:
+        // The index is reported as end of input
+        break;
     }
     return symbol::error;
 }
@@ -242,6 +255,16 @@ inline bool float64::same(token::code::value v)
     return (v == code);
 }
 
+inline bool varint::same(token::code::value v)
+{
+    return (v == code);
+}
+
+inline bool delta_array::same(token::code::value v)
+{
+    return (v == code);
+}
+
 inline bool string::same(token::code::value v)
 {
     switch (v)
@@ -397,6 +420,12 @@ struct is_tag<token::float64>
     static const bool value = true;
 };
 
+template <>
+struct is_tag<token::varint>
+{
+    static const bool value = true;
+};
+
 template <>
 struct is_tag<token::string>
 {
@@ -412,6 +441,155 @@ struct type_cast<T,
     using type = typename T::type;
 };
 
+// compact specializations
+
+template <typename T>
+struct compact<T,
+               typename std::enable_if<std::is_integral<T>::value &&
+                                       !std::is_same<T, bool>::value &&
+                                       sizeof(T) == int8::size>::type>
+{
+    static const bool value = true;
+    using tag = token::int8;
+    using type = typename tag::type;
+
+    static bool same(token::code::value v)
+    {
+        switch (v)
+        {
+        case token::code::array8_int8:
+        case token::code::array16_int8:
+        case token::code::array32_int8:
+        case token::code::array64_int8:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+};
+
+template <typename T>
+struct compact<T,
+               typename std::enable_if<std::is_integral<T>::value &&
+                                       sizeof(T) == int16::size>::type>
+{
+    static const bool value = true;
+    using tag = token::int16;
+    using type = typename tag::type;
+
+    static bool same(token::code::value v)
+    {
+        switch (v)
+        {
+        case token::code::array8_int16:
+        case token::code::array16_int16:
+        case token::code::array32_int16:
+        case token::code::array64_int16:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+};
+
+template <typename T>
+struct compact<T,
+               typename std::enable_if<std::is_integral<T>::value &&
+                                       sizeof(T) == int32::size>::type>
+{
+    static const bool value = true;
+    using tag = token::int32;
+    using type = typename tag::type;
+
+    static bool same(token::code::value v)
+    {
+        switch (v)
+        {
+        case token::code::array8_int32:
+        case token::code::array16_int32:
+        case token::code::array32_int32:
+        case token::code::array64_int32:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+};
+
+template <typename T>
+struct compact<T,
+               typename std::enable_if<std::is_integral<T>::value &&
+                                       sizeof(T) == int64::size>::type>
+{
+    static const bool value = true;
+    using tag = token::int64;
+    using type = typename tag::type;
+
+    static bool same(token::code::value v)
+    {
+        switch (v)
+        {
+        case token::code::array8_int64:
+        case token::code::array16_int64:
+        case token::code::array32_int64:
+        case token::code::array64_int64:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+};
+
+template <>
+struct compact<token::float32::type>
+{
+    static const bool value = true;
+    using tag = token::float32;
+    using type = typename tag::type;
+
+    static bool same(token::code::value v)
+    {
+        switch (v)
+        {
+        case token::code::array8_float32:
+        case token::code::array16_float32:
+        case token::code::array32_float32:
+        case token::code::array64_float32:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+};
+
+template <>
+struct compact<token::float64::type>
+{
+    static const bool value = true;
+    using tag = token::float64;
+    using type = typename tag::type;
+
+    static bool same(token::code::value v)
+    {
+        switch (v)
+        {
+        case token::code::array8_float64:
+        case token::code::array16_float64:
+        case token::code::array32_float64:
+        case token::code::array64_float64:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+};
+
 } // namespace token
 } // namespace bintoken
 } // namespace protocol
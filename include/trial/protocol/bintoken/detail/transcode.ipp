@@ -0,0 +1,348 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_DETAIL_TRANSCODE_IPP
+#define TRIAL_PROTOCOL_BINTOKEN_DETAIL_TRANSCODE_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <limits>
+#include <stack>
+#include <string>
+#include <trial/protocol/json/error.hpp>
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/writer.hpp>
+#include <trial/protocol/bintoken/error.hpp>
+#include <trial/protocol/bintoken/reader.hpp>
+#include <trial/protocol/bintoken/writer.hpp>
+#include <trial/protocol/bintoken/detail/endian.hpp>
+#include <trial/protocol/bintoken/detail/varint.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// JSON to BinToken
+//-----------------------------------------------------------------------------
+
+class json_transcoder
+{
+public:
+    json_transcoder(json::reader& reader, bintoken::writer& writer)
+        : reader(reader),
+          writer(writer)
+    {}
+
+    void run()
+    {
+        do
+        {
+            write();
+            if (!reader.next() && (reader.symbol() == json::token::symbol::error))
+                throw json::error(reader.error());
+        } while (depth > 0);
+    }
+
+private:
+    void write()
+    {
+        switch (reader.symbol())
+        {
+        case json::token::symbol::end:
+            throw json::error(json::insufficient_tokens);
+
+        case json::token::symbol::error:
+            throw json::error(reader.error());
+
+        case json::token::symbol::null:
+            writer.value<bintoken::token::null>();
+            break;
+
+        case json::token::symbol::boolean:
+            writer.value(reader.value<bool>());
+            break;
+
+        case json::token::symbol::integer:
+            writer.value(reader.value<std::int64_t>());
+            break;
+
+        case json::token::symbol::real:
+            writer.value(reader.value<double>());
+            break;
+
+        case json::token::symbol::string:
+            {
+                // The buffer is reused to avoid an allocation per string
+                buffer.clear();
+                const auto ec = reader.string(buffer);
+                if (ec != json::no_error)
+                    throw json::error(ec);
+                writer.value(buffer);
+            }
+            break;
+
+        case json::token::symbol::begin_array:
+            writer.value<bintoken::token::begin_array>();
+            ++depth;
+            break;
+
+        case json::token::symbol::end_array:
+            if (depth == 0)
+                throw json::error(json::insufficient_tokens);
+            writer.value<bintoken::token::end_array>();
+            --depth;
+            break;
+
+        case json::token::symbol::begin_object:
+            writer.value<bintoken::token::begin_assoc_array>();
+            ++depth;
+            break;
+
+        case json::token::symbol::end_object:
+            if (depth == 0)
+                throw json::error(json::insufficient_tokens);
+            writer.value<bintoken::token::end_assoc_array>();
+            --depth;
+            break;
+        }
+    }
+
+private:
+    json::reader& reader;
+    bintoken::writer& writer;
+    std::string buffer;
+    std::size_t depth = 0;
+};
+
+//-----------------------------------------------------------------------------
+// BinToken to JSON
+//-----------------------------------------------------------------------------
+
+class bintoken_transcoder
+{
+    using view_type = bintoken::reader::view_type;
+
+public:
+    bintoken_transcoder(bintoken::reader& reader, json::writer& writer)
+        : reader(reader),
+          writer(writer)
+    {}
+
+    void run()
+    {
+        do
+        {
+            validate_key();
+            write();
+            reader.next();
+        } while (!scopes.empty());
+    }
+
+private:
+    static std::size_t unkeyed() { return std::numeric_limits<std::size_t>::max(); }
+
+    void validate_key()
+    {
+        if (scopes.empty() || (scopes.top() == unkeyed()))
+            return;
+
+        const bool is_key = (scopes.top()++ % 2 == 0);
+        switch (reader.symbol())
+        {
+        case token::symbol::string:
+            break;
+
+        case token::symbol::end_assoc_array:
+            if (!is_key)
+                throw bintoken::error(invalid_value);
+            break;
+
+        default:
+            if (is_key)
+                throw bintoken::error(incompatible_type);
+            break;
+        }
+    }
+
+    void write()
+    {
+        switch (reader.symbol())
+        {
+        case token::symbol::end:
+            throw bintoken::error(insufficient_tokens);
+
+        case token::symbol::error:
+            throw bintoken::error(reader.error());
+
+        case token::symbol::null:
+            writer.value<json::token::null>();
+            break;
+
+        case token::symbol::boolean:
+            writer.value(reader.value<bool>());
+            break;
+
+        case token::symbol::integer:
+            writer.value(reader.value<std::int64_t>());
+            break;
+
+        case token::symbol::real:
+            writer.value(reader.value<double>());
+            break;
+
+        case token::symbol::string:
+            writer.value(json::writer::view_type(reinterpret_cast<const char *>(reader.literal().data()),
+                                                 reader.literal().size()));
+            break;
+
+        case token::symbol::array:
+            write_array();
+            break;
+
+        case token::symbol::begin_record:
+        case token::symbol::begin_array:
+            writer.value<json::token::begin_array>();
+            scopes.push(unkeyed());
+            break;
+
+        case token::symbol::end_record:
+        case token::symbol::end_array:
+            if (scopes.empty())
+                throw bintoken::error(insufficient_tokens);
+            writer.value<json::token::end_array>();
+            scopes.pop();
+            break;
+
+        case token::symbol::begin_assoc_array:
+            writer.value<json::token::begin_object>();
+            scopes.push(0);
+            break;
+
+        case token::symbol::end_assoc_array:
+            if (scopes.empty())
+                throw bintoken::error(insufficient_tokens);
+            writer.value<json::token::end_object>();
+            scopes.pop();
+            break;
+        }
+    }
+
+    // Array elements are decoded directly from the input without
+    // intermediate storage.
+    void write_array()
+    {
+        const view_type& literal = reader.literal();
+        writer.value<json::token::begin_array>();
+        switch (reader.code())
+        {
+        case token::code::array8_int8:
+        case token::code::array16_int8:
+        case token::code::array32_int8:
+        case token::code::array64_int8:
+            for (auto element : literal)
+            {
+                writer.value(std::int64_t(std::int8_t(element)));
+            }
+            break;
+
+        case token::code::array8_int16:
+        case token::code::array16_int16:
+        case token::code::array32_int16:
+        case token::code::array64_int16:
+            write_elements<std::int16_t, std::int64_t>(literal);
+            break;
+
+        case token::code::array8_int32:
+        case token::code::array16_int32:
+        case token::code::array32_int32:
+        case token::code::array64_int32:
+            write_elements<std::int32_t, std::int64_t>(literal);
+            break;
+
+        case token::code::array8_int64:
+        case token::code::array16_int64:
+        case token::code::array32_int64:
+        case token::code::array64_int64:
+            write_elements<std::int64_t, std::int64_t>(literal);
+            break;
+
+        case token::code::array8_float32:
+        case token::code::array16_float32:
+        case token::code::array32_float32:
+        case token::code::array64_float32:
+            write_elements<float, float>(literal);
+            break;
+
+        case token::code::array8_float64:
+        case token::code::array16_float64:
+        case token::code::array32_float64:
+        case token::code::array64_float64:
+            write_elements<double, double>(literal);
+            break;
+
+        case token::code::delta_array:
+            write_deltas(literal);
+            break;
+
+        default:
+            throw bintoken::error(incompatible_type);
+        }
+        writer.value<json::token::end_array>();
+    }
+
+    template <typename T, typename U>
+    void write_elements(const view_type& literal)
+    {
+        const std::size_t count = literal.size() / sizeof(T);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            writer.value(U(endian::load<T>(literal.data() + i * sizeof(T))));
+        }
+    }
+
+    void write_deltas(const view_type& literal)
+    {
+        const std::uint8_t *cursor = literal.data();
+        const std::uint8_t * const tail = cursor + literal.size();
+        std::uint64_t count = 0;
+        cursor += varint::read(cursor, tail - cursor, count);
+        std::uint64_t current = 0;
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            std::uint64_t delta = 0;
+            const auto length = varint::read(cursor, tail - cursor, delta);
+            if (length == 0)
+                throw bintoken::error(invalid_value);
+            cursor += length;
+            current += std::uint64_t(varint::unzigzag(delta));
+            writer.value(std::int64_t(current));
+        }
+    }
+
+private:
+    bintoken::reader& reader;
+    json::writer& writer;
+    // Number of tokens in each associative array to distinguish keys from
+    // values. Other containers are unkeyed.
+    std::stack<std::size_t> scopes;
+};
+
+} // namespace detail
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_DETAIL_TRANSCODE_IPP
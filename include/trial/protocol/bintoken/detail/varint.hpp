@@ -0,0 +1,137 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_DETAIL_VARINT_HPP
+#define TRIAL_PROTOCOL_BINTOKEN_DETAIL_VARINT_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// Variable-length integers are stored as LEB128, that is, seven bits per
+// byte starting with the least significant bits, where the high bit of each
+// byte indicates whether more bytes follow. Signed integers are zig-zag
+// encoded first so that small negative numbers are short as well.
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+namespace detail
+{
+namespace varint
+{
+
+const std::size_t max_size = 10;
+
+inline std::uint64_t zigzag(std::int64_t value)
+{
+    const std::uint64_t shifted = std::uint64_t(value) << 1;
+    return (value < 0) ? ~shifted : shifted;
+}
+
+inline std::int64_t unzigzag(std::uint64_t value)
+{
+    const std::uint64_t shifted = value >> 1;
+    return std::int64_t((value & 1) ? ~shifted : shifted);
+}
+
+//! @brief Returns the number of bytes needed to encode value.
+inline std::size_t size(std::uint64_t value)
+{
+    std::size_t result = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        ++result;
+    }
+    return result;
+}
+
+//! @brief Encodes value into output, which must hold max_size bytes.
+//!
+//! @returns Number of bytes written.
+inline std::size_t write(std::uint64_t value, std::uint8_t *output)
+{
+    std::size_t result = 0;
+    while (value >= 0x80)
+    {
+        output[result++] = std::uint8_t(value | 0x80);
+        value >>= 7;
+    }
+    output[result++] = std::uint8_t(value);
+    return result;
+}
+
+//! @brief Decodes a value from input.
+//!
+//! @returns Number of bytes read, or zero if input is truncated or the
+//!          encoding is too long.
+inline std::size_t read(const std::uint8_t *input,
+                        std::size_t length,
+                        std::uint64_t& value)
+{
+    std::uint64_t result = 0;
+    const std::size_t limit = (length < max_size) ? length : max_size;
+    for (std::size_t i = 0; i < limit; ++i)
+    {
+        result |= std::uint64_t(input[i] & 0x7F) << (7 * i);
+        if ((input[i] & 0x80) == 0)
+        {
+            value = result;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+//! @brief Converts a delta-decoded value into T.
+//!
+//! @returns false if value is out of range for T.
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, bool>::type
+convert(std::uint64_t value, T& output)
+{
+    const std::int64_t result = std::int64_t(value);
+    if ((result > std::numeric_limits<T>::max()) ||
+        (result < std::numeric_limits<T>::min()))
+        return false;
+    output = T(result);
+    return true;
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value, bool>::type
+convert(std::uint64_t value, T& output)
+{
+    if (value > std::numeric_limits<T>::max())
+        return false;
+    output = T(value);
+    return true;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+convert(std::uint64_t value, T& output)
+{
+    output = T(std::int64_t(value));
+    return true;
+}
+
+} // namespace varint
+} // namespace detail
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_DETAIL_VARINT_HPP
@@ -15,6 +15,8 @@
 #include <limits>
 #include <trial/protocol/core/detail/type_traits.hpp>
 #include <trial/protocol/buffer/base.hpp>
+#include <trial/protocol/bintoken/detail/endian.hpp>
+#include <trial/protocol/bintoken/detail/index.hpp>
 
 namespace trial
 {
@@ -48,7 +50,7 @@ struct basic_writer<N>::overloader<
 
     static size_type value(basic_writer<N>& self, T data)
     {
-        return self.encoder.value(data);
+        return self.output().value(data);
     }
 };
 
@@ -64,30 +66,57 @@ struct basic_writer<N>::overloader<
 
     static size_type value(basic_writer<N>& self, T data)
     {
+        if (self.variable &&
+            ((data > std::numeric_limits<std::int16_t>::max()) ||
+             (data < std::numeric_limits<std::int16_t>::min())))
+        {
+            // Only the five and nine byte encodings can be beaten
+            const size_type fixed = ((data <= std::numeric_limits<std::int32_t>::max()) &&
+                                     (data >= std::numeric_limits<std::int32_t>::min()))
+                ? sizeof(std::uint8_t) + sizeof(std::int32_t)
+                : sizeof(std::uint8_t) + sizeof(std::int64_t);
+            if (self.encoder.varint_size(data) < fixed)
+                return self.output().varint_value(data);
+        }
+
         if ((data <= std::numeric_limits<std::int8_t>::max()) &&
             (data >= std::numeric_limits<std::int8_t>::min()))
         {
-            return self.encoder.value(static_cast<std::int8_t>(data));
+            return self.output().value(static_cast<std::int8_t>(data));
         }
         else if ((data <= std::numeric_limits<std::int16_t>::max()) &&
                  (data >= std::numeric_limits<std::int16_t>::min()))
         {
-            return self.encoder.value(static_cast<std::int16_t>(data));
+            return self.output().value(static_cast<std::int16_t>(data));
         }
         else if ((data <= std::numeric_limits<std::int32_t>::max()) &&
                  (data >= std::numeric_limits<std::int32_t>::min()))
         {
-            return self.encoder.value(static_cast<std::int32_t>(data));
+            return self.output().value(static_cast<std::int32_t>(data));
         }
         else
         {
-            return self.encoder.value(static_cast<std::int64_t>(data));
+            return self.output().value(static_cast<std::int64_t>(data));
         }
     }
 
     static size_type array(basic_writer<N>& self, const T *data, size_type size)
     {
-        return self.encoder.array(data, size);
+        using compact_type = typename token::compact<T>::type;
+
+        return self.output().array(reinterpret_cast<const compact_type *>(data),
+                                  size);
+    }
+
+    static size_type delta_array(basic_writer<N>& self, const T *data, size_type size)
+    {
+        // Compact arrays of single bytes are never longer
+        if (sizeof(T) == 1)
+            return 0;
+        const size_type compact_size = self.encoder.array_header_size(size * sizeof(T)) + size * sizeof(T);
+        if (self.encoder.delta_array_size(data, size) >= compact_size)
+            return 0;
+        return self.output().delta_array(data, size);
     }
 };
 
@@ -103,31 +132,54 @@ struct basic_writer<N>::overloader<
 
     static size_type value(basic_writer<N>& self, T data)
     {
+        if (self.variable &&
+            (data > std::numeric_limits<std::uint16_t>::max()) &&
+            (data <= std::uint64_t(std::numeric_limits<std::int64_t>::max())))
+        {
+            // Only the five and nine byte encodings can be beaten
+            const size_type fixed = (data <= std::numeric_limits<std::uint32_t>::max())
+                ? sizeof(std::uint8_t) + sizeof(std::int32_t)
+                : sizeof(std::uint8_t) + sizeof(std::int64_t);
+            if (self.encoder.varint_size(std::int64_t(data)) < fixed)
+                return self.output().varint_value(std::int64_t(data));
+        }
+
         if (data <= std::numeric_limits<std::uint8_t>::max())
         {
-            return self.encoder.value(std::int8_t(data));
+            return self.output().value(std::int8_t(data));
         }
         else if (data <= std::numeric_limits<std::uint16_t>::max())
         {
-            return self.encoder.value(std::int16_t(data));
+            return self.output().value(std::int16_t(data));
         }
         else if (data <= std::numeric_limits<std::uint32_t>::max())
         {
-            return self.encoder.value(std::int32_t(data));
+            return self.output().value(std::int32_t(data));
         }
         else
         {
-            return self.encoder.value(std::int64_t(data));
+            return self.output().value(std::int64_t(data));
         }
     }
 
     static size_type array(basic_writer<N>& self, const T *data, size_type size)
     {
-        using signed_type = typename std::make_signed<T>::type;
+        using compact_type = typename token::compact<T>::type;
 
-        return self.encoder.array(reinterpret_cast<const signed_type *>(data),
+        return self.output().array(reinterpret_cast<const compact_type *>(data),
                                   size);
     }
+
+    static size_type delta_array(basic_writer<N>& self, const T *data, size_type size)
+    {
+        // Compact arrays of single bytes are never longer
+        if (sizeof(T) == 1)
+            return 0;
+        const size_type compact_size = self.encoder.array_header_size(size * sizeof(T)) + size * sizeof(T);
+        if (self.encoder.delta_array_size(data, size) >= compact_size)
+            return 0;
+        return self.output().delta_array(data, size);
+    }
 };
 
 template <std::size_t N>
@@ -140,12 +192,17 @@ struct basic_writer<N>::overloader<
 
     static size_type value(basic_writer<N>& self, T data)
     {
-        return self.encoder.value(data);
+        return self.output().value(data);
     }
 
     static size_type array(basic_writer<N>& self, const T *data, size_type size)
     {
-        return self.encoder.array(data, size);
+        return self.output().array(data, size);
+    }
+
+    static size_type delta_array(basic_writer<N>&, const T *, size_type)
+    {
+        return 0;
     }
 };
 
@@ -159,7 +216,7 @@ struct basic_writer<N>::overloader<CharT[M]>
 
     static size_type value(basic_writer<N>& self, const type& data)
     {
-        return self.encoder.value(data, M - 1); // Drop terminating zero
+        return self.output().value(data, M - 1); // Drop terminating zero
     }
 };
 
@@ -173,7 +230,7 @@ struct basic_writer<N>::overloader<
 
     static size_type value(basic_writer<N>& self, const T& data)
     {
-        return self.encoder.value(data);
+        return self.output().value(data);
     }
 };
 
@@ -187,7 +244,7 @@ struct basic_writer<N>::overloader<
 
     static size_type value(basic_writer<N>& self, const T& data)
     {
-        return self.encoder.value(data);
+        return self.output().value(data);
     }
 };
 
@@ -201,7 +258,7 @@ struct basic_writer<N>::overloader<
 
     static size_type value(basic_writer<N>& self)
     {
-        return self.encoder.template value<token::null>();
+        return self.output().template value<token::null>();
     }
 };
 
@@ -216,7 +273,8 @@ struct basic_writer<N>::overloader<
     static size_type value(basic_writer<N>& self)
     {
         self.stack.push(token::code::end_record);
-        return self.encoder.template value<T>();
+        self.open_scope();
+        return self.output().template value<T>();
     }
 };
 
@@ -231,8 +289,9 @@ struct basic_writer<N>::overloader<
     static size_type value(basic_writer<N>& self)
     {
         self.validate_scope(token::code::end_record, unexpected_token);
-        size_type result = self.encoder.template value<T>();
+        size_type result = self.output().template value<T>();
         self.stack.pop();
+        result += self.close_scope();
         return result;
     }
 };
@@ -248,7 +307,8 @@ struct basic_writer<N>::overloader<
     static size_type value(basic_writer<N>& self)
     {
         self.stack.push(token::code::end_array);
-        return self.encoder.template value<T>();
+        self.open_scope();
+        return self.output().template value<T>();
     }
 };
 
@@ -263,8 +323,9 @@ struct basic_writer<N>::overloader<
     static size_type value(basic_writer<N>& self)
     {
         self.validate_scope(token::code::end_array, unexpected_token);
-        size_type result = self.encoder.template value<T>();
+        size_type result = self.output().template value<T>();
         self.stack.pop();
+        result += self.close_scope();
         return result;
     }
 };
@@ -280,7 +341,8 @@ struct basic_writer<N>::overloader<
     static size_type value(basic_writer<N>& self)
     {
         self.stack.push(token::code::end_assoc_array);
-        return self.encoder.template value<T>();
+        self.open_scope();
+        return self.output().template value<T>();
     }
 };
 
@@ -295,8 +357,9 @@ struct basic_writer<N>::overloader<
     static size_type value(basic_writer<N>& self)
     {
         self.validate_scope(token::code::end_assoc_array, unexpected_token);
-        size_type result = self.encoder.template value<T>();
+        size_type result = self.output().template value<T>();
         self.stack.pop();
+        result += self.close_scope();
         return result;
     }
 };
@@ -305,10 +368,14 @@ struct basic_writer<N>::overloader<
 // writer
 //-----------------------------------------------------------------------------
 
+template <std::size_t N>
+const typename basic_writer<N>::size_type basic_writer<N>::unprefixed;
+
 template <std::size_t N>
 template <typename T>
 basic_writer<N>::basic_writer(T& buffer)
-    : encoder(buffer)
+    : encoder(buffer),
+      pending_encoder(pending)
 {
     stack.push(token::code::end_array);
 }
@@ -317,21 +384,126 @@ template <std::size_t N>
 template <typename T>
 auto basic_writer<N>::value(const T& data) -> size_type
 {
-    return overloader<T>::value(*this, data);
+    const size_type start = offset;
+    const size_type depth = stack.size();
+    const size_type result = overloader<T>::value(*this, data);
+    offset += result;
+    index_value(start, depth);
+    return result;
 }
 
 template <std::size_t N>
 template <typename T>
 auto basic_writer<N>::value() -> size_type
 {
-    return overloader<T>::value(*this);
+    const size_type start = offset;
+    const size_type depth = stack.size();
+    const size_type result = overloader<T>::value(*this);
+    offset += result;
+    index_value(start, depth);
+    return result;
 }
 
 template <std::size_t N>
 template <typename T>
 auto basic_writer<N>::array(const T *data, size_type size) -> size_type
 {
-    return overloader<T>::array(*this, data, size);
+    index_value(offset, stack.size());
+    size_type result = 0;
+    if (variable)
+    {
+        result = overloader<T>::delta_array(*this, data, size);
+        if (result > 0)
+        {
+            offset += result;
+            return result;
+        }
+    }
+    // The length prefixes of pending containers are inserted later, so the
+    // final position of the payload is not known yet
+    if (aligned && (pending_scopes == 0))
+    {
+        const size_type header = output().array_header_size(size * sizeof(T));
+        const size_type misalignment = (offset + header) % sizeof(T);
+        if (misalignment != 0)
+        {
+            result += output().padding(sizeof(T) - misalignment);
+        }
+    }
+    result += overloader<T>::array(*this, data, size);
+    offset += result;
+    return result;
+}
+
+template <std::size_t N>
+void basic_writer<N>::align_arrays(bool enable) BOOST_NOEXCEPT
+{
+    aligned = enable;
+}
+
+template <std::size_t N>
+void basic_writer<N>::variable_integers(bool enable) BOOST_NOEXCEPT
+{
+    variable = enable;
+}
+
+template <std::size_t N>
+void basic_writer<N>::prefix_containers(bool enable) BOOST_NOEXCEPT
+{
+    prefixed = enable;
+}
+
+template <std::size_t N>
+void basic_writer<N>::index_values(bool enable) BOOST_NOEXCEPT
+{
+    indexed = enable;
+}
+
+template <std::size_t N>
+void basic_writer<N>::index_key(std::int64_t key)
+{
+    if (records.empty())
+        throw bintoken::error(bintoken::make_error_code(invalid_value));
+    keys.resize(records.size(), 0);
+    keys.back() = key;
+}
+
+template <std::size_t N>
+auto basic_writer<N>::write_index() -> size_type
+{
+    if (stack.size() != 1)
+        throw bintoken::error(bintoken::make_error_code(unexpected_token));
+
+    const bool keyed = !keys.empty();
+    keys.resize(records.size(), 0);
+
+    const size_type entry_size = detail::index::offset_size + (keyed ? detail::index::key_size : 0);
+    std::vector<std::uint8_t> footer(1 + records.size() * entry_size + detail::index::trailer_size);
+    footer[0] = token::code::index;
+    std::uint8_t *position = footer.data() + 1;
+    for (size_type i = 0; i < records.size(); ++i)
+    {
+        detail::endian::store(position, records[i]);
+        if (keyed)
+        {
+            detail::endian::store(position + detail::index::offset_size, std::uint64_t(keys[i]));
+        }
+        position += entry_size;
+    }
+    detail::endian::store(position, std::uint64_t(offset));
+    detail::endian::store(position + 8, std::uint64_t(records.size()));
+    detail::endian::store(position + 16, keyed ? std::uint32_t(detail::index::flags::keys) : std::uint32_t(0));
+    detail::endian::store(position + 20, detail::index::magic);
+
+    const size_type result = encoder.literal(view_type(footer.data(), footer.size()));
+    offset += result;
+    return result;
+}
+
+template <std::size_t N>
+auto basic_writer<N>::size() const BOOST_NOEXCEPT -> size_type
+{
+    return offset;
 }
 
 template <std::size_t N>
@@ -344,6 +516,58 @@ void basic_writer<N>::validate_scope(token::code::value code,
     }
 }
 
+template <std::size_t N>
+void basic_writer<N>::index_value(size_type start, size_type depth)
+{
+    // Only values that are written at the outermost level
+    if (indexed && (depth == 1))
+    {
+        records.push_back(start);
+    }
+}
+
+template <std::size_t N>
+auto basic_writer<N>::output() BOOST_NOEXCEPT -> detail::basic_encoder<N>&
+{
+    return (pending_scopes > 0) ? pending_encoder : encoder;
+}
+
+template <std::size_t N>
+void basic_writer<N>::open_scope()
+{
+    if (prefixed)
+    {
+        scopes.push(pending.size());
+        ++pending_scopes;
+    }
+    else
+    {
+        scopes.push(unprefixed);
+    }
+}
+
+template <std::size_t N>
+auto basic_writer<N>::close_scope() -> size_type
+{
+    const size_type start = scopes.top();
+    scopes.pop();
+    if (start == unprefixed)
+        return 0;
+
+    // Insert the length in front of the begin token
+    std::vector<std::uint8_t> prefix;
+    detail::basic_encoder<N> prefix_encoder(prefix);
+    const size_type result = prefix_encoder.length(pending.size() - start);
+    pending.insert(pending.begin() + start, prefix.begin(), prefix.end());
+
+    if (--pending_scopes == 0)
+    {
+        encoder.literal(view_type(pending.data(), pending.size()));
+        pending.clear();
+    }
+    return result;
+}
+
 } // namespace bintoken
 } // namespace protocol
 } // namespace trial
@@ -35,7 +35,10 @@ enum errc
     incompatible_type,
     expected_end_record,
     expected_end_array,
-    expected_end_assoc_array
+    expected_end_assoc_array,
+    invalid_length,
+    insufficient_tokens,
+    invalid_checksum
 };
 
 inline enum errc to_errc(token::code::value value)
@@ -48,6 +51,9 @@ inline enum errc to_errc(token::code::value value)
     case token::code::error_unexpected_token:
         return unexpected_token;
 
+    case token::code::error_invalid_length:
+        return invalid_length;
+
     case token::code::error_negative_length:
         return negative_length;
 
@@ -12,6 +12,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <trial/dynamic/variable.hpp>
+#include <trial/dynamic/string_pool.hpp>
 #include <trial/protocol/bintoken/reader.hpp>
 #include <trial/protocol/bintoken/detail/parse.ipp>
 
@@ -31,6 +32,9 @@ namespace partial
 //! value or a container. The @c reader will point to the remainder of the
 //! encoded data after this function.
 //!
+//! Values that are not needed can be passed over with partial::skip(),
+//! which also returns a view of the encoded value.
+//!
 //! @param reader Reader pointing to an arbitrary position within a buffer.
 //! @returns Dynamic variable containing the decoded BinToken data.
 
@@ -41,6 +45,24 @@ auto parse(bintoken::reader& reader) -> dynamic::basic_variable<Allocator>
     return parser.parse();
 }
 
+//! @brief Decode BinToken formatted data into dynamic variable with pooled keys.
+//!
+//! Starts decoding at the current position of @c reader. String keys of
+//! associative arrays are interned in @c pool, so that keys can share storage
+//! across associative arrays and documents parsed with the same pool.
+//!
+//! @param reader Reader pointing to an arbitrary position within a buffer.
+//! @param pool Pool of string keys.
+//! @returns Dynamic variable containing the decoded BinToken data.
+
+template <typename Allocator>
+auto parse(bintoken::reader& reader,
+           dynamic::basic_string_pool<Allocator>& pool) -> dynamic::basic_variable<Allocator>
+{
+    detail::basic_parser<Allocator> parser(reader, &pool);
+    return parser.parse();
+}
+
 } // namespace partial
 
 //! @brief Decode BinToken formatted data into dynamic variable.
@@ -52,7 +74,24 @@ template <typename U, typename Allocator = std::allocator<char>>
 auto parse(const U& input) -> dynamic::basic_variable<Allocator>
 {
     bintoken::reader reader(input);
-    auto result = partial::parse(reader);
+    auto result = partial::parse<Allocator>(reader);
+    if (reader.symbol() != bintoken::token::symbol::end)
+        throw bintoken::error(bintoken::unexpected_token);
+    return result;
+}
+
+//! @brief Decode BinToken formatted data into dynamic variable with pooled keys.
+//!
+//! @param input The BinToken formatted input buffer.
+//! @param pool Pool of string keys.
+//! @returns Dynamic variable containing the decoded BinToken data.
+
+template <typename U, typename Allocator>
+auto parse(const U& input,
+           dynamic::basic_string_pool<Allocator>& pool) -> dynamic::basic_variable<Allocator>
+{
+    bintoken::reader reader(input);
+    auto result = partial::parse(reader, pool);
     if (reader.symbol() != bintoken::token::symbol::end)
         throw bintoken::error(bintoken::unexpected_token);
     return result;
@@ -0,0 +1,116 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_PARTIAL_SKIP_HPP
+#define TRIAL_PROTOCOL_BINTOKEN_PARTIAL_SKIP_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <iterator>
+#include <trial/protocol/bintoken/reader.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+namespace partial
+{
+
+//! @brief Skip the current value.
+//!
+//! Length-prefixed containers are skipped in constant time.
+//!
+//! @returns A view of the skipped value. The view of a container starts
+//!          at its begin token and ends after its end token.
+inline reader::view_type skip(reader& reader, std::error_code& ec)
+{
+    using view_type = reader::view_type;
+    using value_type = reader::value_type;
+    using size_type = reader::size_type;
+
+    switch (reader.symbol())
+    {
+    case token::symbol::end:
+    case token::symbol::error:
+    case token::symbol::end_record:
+    case token::symbol::end_array:
+    case token::symbol::end_assoc_array:
+        ec = insufficient_tokens;
+        break;
+
+    case token::symbol::null:
+    case token::symbol::boolean:
+    case token::symbol::integer:
+    case token::symbol::real:
+    case token::symbol::string:
+    case token::symbol::array:
+        {
+            auto ret = reader.literal();
+            if (!reader.next())
+                ec = reader.error();
+            return ret;
+        }
+
+    case token::symbol::begin_record:
+    case token::symbol::begin_array:
+    case token::symbol::begin_assoc_array:
+        {
+            // The literal starts immediately after the begin token
+            const value_type * const head = reader.literal().data() - 1;
+            if (!reader.literal().empty())
+            {
+                // Length-prefixed container
+                view_type ret(head, reader.literal().size() + 1);
+                if (!reader.next_sibling())
+                    ec = reader.error();
+                return ret;
+            }
+
+            const size_type current_level = reader.level();
+            do
+            {
+                if (!reader.next())
+                {
+                    if (reader.code() == token::code::end)
+                        ec = insufficient_tokens;
+                    else
+                        ec = reader.error();
+                    return view_type(head, std::distance(head, reader.literal().data()));
+                }
+            } while ((reader.level() > current_level + 1) ||
+                     (reader.category() != token::category::structural) ||
+                     (reader.symbol() == token::symbol::begin_record) ||
+                     (reader.symbol() == token::symbol::begin_array) ||
+                     (reader.symbol() == token::symbol::begin_assoc_array));
+            // The literal of an end token is empty and placed after it
+            const value_type * const tail = reader.literal().data();
+            if (!reader.next()) // Skip over end token
+                ec = reader.error();
+            return view_type(head, std::distance(head, tail));
+        }
+    }
+    return {};
+}
+
+inline reader::view_type skip(reader& reader)
+{
+    std::error_code ec;
+    auto ret = skip(reader, ec);
+    if (ec)
+        throw bintoken::error(ec);
+    return ret;
+}
+
+} // namespace partial
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_PARTIAL_SKIP_HPP
@@ -13,7 +13,9 @@
 
 #include <cstddef> // std::size_t
 #include <stack>
+#include <trial/protocol/core/detail/span.hpp>
 #include <trial/protocol/bintoken/error.hpp>
+#include <trial/protocol/bintoken/record_index.hpp>
 #include <trial/protocol/bintoken/detail/decoder.hpp>
 
 namespace trial
@@ -33,10 +35,26 @@ public:
     reader(view_type);
     template <typename T> reader(const T&);
 
+    //! @brief Construct a reader positioned at an indexed top-level value.
+    //!
+    //! The input must end with an index footer, and the reader continues
+    //! with the following top-level values. See writer::write_index().
+    //!
+    //! @throws system_error if the index footer is invalid or ordinal is
+    //!         out of range.
+    reader(view_type, size_type ordinal);
+    template <typename T> reader(const T&, size_type ordinal);
+
     //! @brief Advance to the next token.
     bool next() BOOST_NOEXCEPT;
     bool next(token::code::value) BOOST_NOEXCEPT;
 
+    //! @brief Advance to the token after the current value.
+    //!
+    //! Length-prefixed containers are skipped in constant time without
+    //! decoding their content. Other containers are traversed token by token.
+    bool next_sibling() BOOST_NOEXCEPT;
+
     //! @brief Returns the current token.
     token::code::value code() const BOOST_NOEXCEPT;
 
@@ -72,7 +90,21 @@ public:
     template <typename T>
     size_type array(T* output, size_type output_length) const;
 
+    //! @brief Returns a view of the current compact array without copying.
+    //!
+    //! The view refers directly to the input buffer, so it is only available
+    //! when the host uses the same byte order as the encoding and the payload
+    //! is aligned for T. Otherwise an empty view is returned and array()
+    //! must be used instead. See writer::align_arrays().
+    //!
+    //! @throws system_error if requested type is incompatible with the current token.
+    template <typename T>
+    core::detail::span<T> array_view() const;
+
     //! @brief Return a view of the current value before it is converted into its type.
+    //!
+    //! The view of a length-prefixed container spans its content including
+    //! the end token.
     const view_type& literal() const BOOST_NOEXCEPT;
 
     //! @returns A view of the remaining buffer.
@@ -0,0 +1,85 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_RECORD_INDEX_HPP
+#define TRIAL_PROTOCOL_BINTOKEN_RECORD_INDEX_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <trial/protocol/bintoken/error.hpp>
+#include <trial/protocol/bintoken/detail/decoder.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+
+//! @brief Random access to top-level values via the index footer.
+//!
+//! The index footer is appended by writer::write_index() and contains the
+//! offset, and optionally a key, of every top-level value.
+class record_index
+{
+public:
+    using size_type = std::size_t;
+    using value_type = detail::decoder::value_type;
+    using view_type = detail::decoder::view_type;
+
+    //! @throws system_error if input does not end with a valid index footer.
+    record_index(view_type input);
+    template <typename T> record_index(const T&);
+
+    //! @brief Returns the number of indexed values.
+    size_type size() const BOOST_NOEXCEPT;
+
+    //! @brief Returns true if the index contains keys.
+    bool has_keys() const BOOST_NOEXCEPT;
+
+    //! @brief Returns the offset of an indexed value.
+    //!
+    //! @throws system_error if ordinal is out of range.
+    size_type offset(size_type ordinal) const;
+
+    //! @brief Returns the key of an indexed value.
+    //!
+    //! @throws system_error if ordinal is out of range or the index has no keys.
+    std::int64_t key(size_type ordinal) const;
+
+    //! @brief Returns the ordinal of the first value with a given key.
+    //!
+    //! @returns size() if no value has the key.
+    size_type find(std::int64_t key) const BOOST_NOEXCEPT;
+
+    //! @brief Returns a view that starts at an indexed value and ends at the
+    //!        index footer.
+    //!
+    //! @throws system_error if ordinal is out of range.
+    view_type seek(size_type ordinal) const;
+
+private:
+    const value_type *entry(size_type ordinal) const;
+
+private:
+    view_type input;
+    size_type count = 0;
+    size_type footer_offset = 0;
+    size_type entry_size = 0;
+    bool keyed = false;
+};
+
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/bintoken/detail/record_index.ipp>
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_RECORD_INDEX_HPP
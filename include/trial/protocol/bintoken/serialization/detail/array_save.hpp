@@ -68,9 +68,20 @@ template <typename T, std::size_t N>
 struct save_overloader< bintoken::oarchive,
                         T[N] >
 {
+    using is_compact = std::integral_constant<bool, bintoken::token::compact<T>::value>;
+
     static void save(bintoken::oarchive& ar,
                      const T (&data)[N],
                      const unsigned int protocol_version)
+    {
+        save(ar, data, protocol_version, is_compact());
+    }
+
+private:
+    static void save(bintoken::oarchive& ar,
+                     const T (&data)[N],
+                     const unsigned int protocol_version,
+                     std::false_type)
     {
         ar.save<bintoken::token::begin_array>();
         ar.save<std::size_t>(N);
@@ -80,125 +91,12 @@ struct save_overloader< bintoken::oarchive,
         }
         ar.save<bintoken::token::end_array>();
     }
-};
-
-// Specialization for compact arrays
-
-template <std::size_t N>
-struct save_overloader< bintoken::oarchive,
-                        std::int8_t[N] >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::int8_t (&data)[N],
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data, N);
-    }
-};
-
-template <std::size_t N>
-struct save_overloader< bintoken::oarchive,
-                        std::uint8_t[N] >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::uint8_t (&data)[N],
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data, N);
-    }
-};
-
-template <std::size_t N>
-struct save_overloader< bintoken::oarchive,
-                        std::int16_t[N] >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::int16_t (&data)[N],
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data, N);
-    }
-};
 
-template <std::size_t N>
-struct save_overloader< bintoken::oarchive,
-                        std::uint16_t[N] >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::uint16_t (&data)[N],
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data, N);
-    }
-};
-
-template <std::size_t N>
-struct save_overloader< bintoken::oarchive,
-                        std::int32_t[N] >
-{
+    // Arithmetic types are stored as a compact array
     static void save(bintoken::oarchive& ar,
-                     const std::int32_t (&data)[N],
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data, N);
-    }
-};
-
-template <std::size_t N>
-struct save_overloader< bintoken::oarchive,
-                        std::uint32_t[N] >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::uint32_t (&data)[N],
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data, N);
-    }
-};
-
-template <std::size_t N>
-struct save_overloader< bintoken::oarchive,
-                        std::int64_t[N] >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::int64_t (&data)[N],
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data, N);
-    }
-};
-
-template <std::size_t N>
-struct save_overloader< bintoken::oarchive,
-                        std::uint64_t[N] >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::uint64_t (&data)[N],
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data, N);
-    }
-};
-
-template <std::size_t N>
-struct save_overloader< bintoken::oarchive,
-                        bintoken::token::float32::type[N] >
-{
-    static void save(bintoken::oarchive& ar,
-                     const bintoken::token::float32::type (&data)[N],
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data, N);
-    }
-};
-
-template <std::size_t N>
-struct save_overloader< bintoken::oarchive,
-                        bintoken::token::float64::type[N] >
-{
-    static void save(bintoken::oarchive& ar,
-                     const bintoken::token::float64::type (&data)[N],
-                     const unsigned int /* protocol_version */)
+                     const T (&data)[N],
+                     const unsigned int /* protocol_version */,
+                     std::true_type)
     {
         ar.save_array(data, N);
     }
@@ -26,9 +26,20 @@ template <typename T, typename Allocator>
 struct save_overloader< bintoken::oarchive,
                         typename std::vector<T, Allocator> >
 {
+    using is_compact = std::integral_constant<bool, bintoken::token::compact<T>::value>;
+
     static void save(bintoken::oarchive& ar,
                      const std::vector<T, Allocator>& data,
                      const unsigned int protocol_version)
+    {
+        save(ar, data, protocol_version, is_compact());
+    }
+
+private:
+    static void save(bintoken::oarchive& ar,
+                     const std::vector<T, Allocator>& data,
+                     const unsigned int protocol_version,
+                     std::false_type)
     {
         ar.save<bintoken::token::begin_array>();
         ar.save<std::size_t>(data.size());
@@ -40,15 +51,35 @@ struct save_overloader< bintoken::oarchive,
         }
         ar.save<bintoken::token::end_array>();
     }
+
+    // Arithmetic types are stored as a compact array
+    static void save(bintoken::oarchive& ar,
+                     const std::vector<T, Allocator>& data,
+                     const unsigned int /* protocol_version */,
+                     std::true_type)
+    {
+        ar.save_array(data.data(), data.size());
+    }
 };
 
 template <typename T, typename Allocator>
 struct load_overloader< bintoken::iarchive,
                         typename std::vector<T, Allocator> >
 {
+    using is_compact = std::integral_constant<bool, bintoken::token::compact<T>::value>;
+
     static void load(bintoken::iarchive& ar,
                      std::vector<T, Allocator>& data,
                      const unsigned int protocol_version)
+    {
+        load(ar, data, protocol_version, is_compact());
+    }
+
+private:
+    static void load(bintoken::iarchive& ar,
+                     std::vector<T, Allocator>& data,
+                     const unsigned int protocol_version,
+                     std::false_type)
     {
         ar.load<bintoken::token::begin_array>();
 
@@ -67,371 +98,19 @@ struct load_overloader< bintoken::iarchive,
         }
         ar.load<bintoken::token::end_array>();
     }
-};
-
-// Specialization for compact arrays
-
-template <typename Allocator>
-struct save_overloader< bintoken::oarchive,
-                        typename std::vector<std::int8_t, Allocator> >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::vector<std::int8_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data.data(), data.size());
-    }
-};
-
-template <typename Allocator>
-struct load_overloader< bintoken::iarchive,
-                        typename std::vector<std::int8_t, Allocator> >
-{
-    static void load(bintoken::iarchive& ar,
-                     std::vector<std::int8_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        switch (ar.code())
-        {
-        case bintoken::token::code::array8_int8:
-        case bintoken::token::code::array16_int8:
-        case bintoken::token::code::array32_int8:
-        case bintoken::token::code::array64_int8:
-            data.assign(ar.length(), {});
-            ar.load_array(data.data(), data.size());
-            break;
-
-        default:
-            throw bintoken::error(bintoken::incompatible_type);
-        }
-    }
-};
-
-template <typename Allocator>
-struct save_overloader< bintoken::oarchive,
-                        typename std::vector<std::uint8_t, Allocator> >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::vector<std::uint8_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(reinterpret_cast<const std::int8_t *>(data.data()),
-                      data.size());
-    }
-};
-
-template <typename Allocator>
-struct load_overloader< bintoken::iarchive,
-                        typename std::vector<std::uint8_t, Allocator> >
-{
-    static void load(bintoken::iarchive& ar,
-                     std::vector<std::uint8_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        switch (ar.code())
-        {
-        case bintoken::token::code::array8_int8:
-        case bintoken::token::code::array16_int8:
-        case bintoken::token::code::array32_int8:
-        case bintoken::token::code::array64_int8:
-            data.assign(ar.length(), {});
-            ar.load_array(data.data(), data.size());
-            break;
-
-        default:
-            throw bintoken::error(bintoken::incompatible_type);
-        }
-    }
-};
-
-template <typename Allocator>
-struct save_overloader< bintoken::oarchive,
-                        typename std::vector<std::int16_t, Allocator> >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::vector<std::int16_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data.data(), data.size());
-    }
-};
-
-template <typename Allocator>
-struct load_overloader< bintoken::iarchive,
-                        typename std::vector<std::int16_t, Allocator> >
-{
-    static void load(bintoken::iarchive& ar,
-                     std::vector<std::int16_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        switch (ar.code())
-        {
-        case bintoken::token::code::array8_int16:
-        case bintoken::token::code::array16_int16:
-        case bintoken::token::code::array32_int16:
-        case bintoken::token::code::array64_int16:
-            data.assign(ar.length(), {});
-            ar.load_array(data.data(), data.size());
-            break;
-
-        default:
-            throw bintoken::error(bintoken::incompatible_type);
-        }
-    }
-};
-
-template <typename Allocator>
-struct save_overloader< bintoken::oarchive,
-                        typename std::vector<std::uint16_t, Allocator> >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::vector<std::uint16_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(reinterpret_cast<const std::int16_t *>(data.data()),
-                      data.size());
-    }
-};
-
-template <typename Allocator>
-struct load_overloader< bintoken::iarchive,
-                        typename std::vector<std::uint16_t, Allocator> >
-{
-    static void load(bintoken::iarchive& ar,
-                     std::vector<std::uint16_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        switch (ar.code())
-        {
-        case bintoken::token::code::array8_int16:
-        case bintoken::token::code::array16_int16:
-        case bintoken::token::code::array32_int16:
-        case bintoken::token::code::array64_int16:
-            data.assign(ar.length(), {});
-            ar.load_array(data.data(), data.size());
-            break;
-
-        default:
-            throw bintoken::error(bintoken::incompatible_type);
-        }
-    }
-};
-
-template <typename Allocator>
-struct save_overloader< bintoken::oarchive,
-                        typename std::vector<std::int32_t, Allocator> >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::vector<std::int32_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data.data(), data.size());
-    }
-};
-
-template <typename Allocator>
-struct load_overloader< bintoken::iarchive,
-                        typename std::vector<std::int32_t, Allocator> >
-{
-    static void load(bintoken::iarchive& ar,
-                     std::vector<std::int32_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        switch (ar.code())
-        {
-        case bintoken::token::code::array8_int32:
-        case bintoken::token::code::array16_int32:
-        case bintoken::token::code::array32_int32:
-        case bintoken::token::code::array64_int32:
-            data.assign(ar.length(), {});
-            ar.load_array(data.data(), data.size());
-            break;
-
-        default:
-            throw bintoken::error(bintoken::incompatible_type);
-        }
-    }
-};
-
-template <typename Allocator>
-struct save_overloader< bintoken::oarchive,
-                        typename std::vector<std::uint32_t, Allocator> >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::vector<std::uint32_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(reinterpret_cast<const std::int32_t *>(data.data()),
-                      data.size());
-    }
-};
-
-template <typename Allocator>
-struct load_overloader< bintoken::iarchive,
-                        typename std::vector<std::uint32_t, Allocator> >
-{
-    static void load(bintoken::iarchive& ar,
-                     std::vector<std::uint32_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        switch (ar.code())
-        {
-        case bintoken::token::code::array8_int32:
-        case bintoken::token::code::array16_int32:
-        case bintoken::token::code::array32_int32:
-        case bintoken::token::code::array64_int32:
-            data.assign(ar.length(), {});
-            ar.load_array(data.data(), data.size());
-            break;
-
-        default:
-            throw bintoken::error(bintoken::incompatible_type);
-        }
-    }
-};
-
-template <typename Allocator>
-struct save_overloader< bintoken::oarchive,
-                        typename std::vector<std::int64_t, Allocator> >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::vector<std::int64_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data.data(), data.size());
-    }
-};
-
-template <typename Allocator>
-struct load_overloader< bintoken::iarchive,
-                        typename std::vector<std::int64_t, Allocator> >
-{
-    static void load(bintoken::iarchive& ar,
-                     std::vector<std::int64_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        switch (ar.code())
-        {
-        case bintoken::token::code::array8_int64:
-        case bintoken::token::code::array16_int64:
-        case bintoken::token::code::array32_int64:
-        case bintoken::token::code::array64_int64:
-            data.assign(ar.length(), {});
-            ar.load_array(data.data(), data.size());
-            break;
-
-        default:
-            throw bintoken::error(bintoken::incompatible_type);
-        }
-    }
-};
-
-template <typename Allocator>
-struct save_overloader< bintoken::oarchive,
-                        typename std::vector<std::uint64_t, Allocator> >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::vector<std::uint64_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(reinterpret_cast<const std::int64_t *>(data.data()),
-                      data.size());
-    }
-};
 
-template <typename Allocator>
-struct load_overloader< bintoken::iarchive,
-                        typename std::vector<std::uint64_t, Allocator> >
-{
     static void load(bintoken::iarchive& ar,
-                     std::vector<std::uint64_t, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        switch (ar.code())
-        {
-        case bintoken::token::code::array8_int64:
-        case bintoken::token::code::array16_int64:
-        case bintoken::token::code::array32_int64:
-        case bintoken::token::code::array64_int64:
-            data.assign(ar.length(), {});
-            ar.load_array(data.data(), data.size());
-            break;
-
-        default:
-            throw bintoken::error(bintoken::incompatible_type);
-        }
-    }
-};
-
-template <typename Allocator>
-struct save_overloader< bintoken::oarchive,
-                        typename std::vector<typename bintoken::token::float32::type, Allocator> >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::vector<typename bintoken::token::float32::type, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data.data(), data.size());
-    }
-};
-
-template <typename Allocator>
-struct load_overloader< bintoken::iarchive,
-                        typename std::vector<bintoken::token::float32::type, Allocator> >
-{
-    static void load(bintoken::iarchive& ar,
-                     std::vector<bintoken::token::float32::type, Allocator>& data,
-                     const unsigned int /* protocol_version */)
+                     std::vector<T, Allocator>& data,
+                     const unsigned int /* protocol_version */,
+                     std::true_type)
     {
-        switch (ar.code())
-        {
-        case bintoken::token::code::array8_float32:
-        case bintoken::token::code::array16_float32:
-        case bintoken::token::code::array32_float32:
-        case bintoken::token::code::array64_float32:
-            data.assign(ar.length(), {});
-            ar.load_array(data.data(), data.size());
-            break;
-
-        default:
+        // Integers may also be stored as a delta array
+        if (!bintoken::token::compact<T>::same(ar.code()) &&
+            !(std::is_integral<T>::value && bintoken::token::delta_array::same(ar.code())))
             throw bintoken::error(bintoken::incompatible_type);
-        }
-    }
-};
 
-template <typename Allocator>
-struct save_overloader< bintoken::oarchive,
-                        typename std::vector<typename bintoken::token::float64::type, Allocator> >
-{
-    static void save(bintoken::oarchive& ar,
-                     const std::vector<typename bintoken::token::float64::type, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        ar.save_array(data.data(), data.size());
-    }
-};
-
-template <typename Allocator>
-struct load_overloader< bintoken::iarchive,
-                        typename std::vector<bintoken::token::float64::type, Allocator> >
-{
-    static void load(bintoken::iarchive& ar,
-                     std::vector<bintoken::token::float64::type, Allocator>& data,
-                     const unsigned int /* protocol_version */)
-    {
-        switch (ar.code())
-        {
-        case bintoken::token::code::array8_float64:
-        case bintoken::token::code::array16_float64:
-        case bintoken::token::code::array32_float64:
-        case bintoken::token::code::array64_float64:
-            data.assign(ar.length(), {});
-            ar.load_array(data.data(), data.size());
-            break;
-
-        default:
-            throw bintoken::error(bintoken::incompatible_type);
-        }
+        data.resize(ar.length());
+        ar.load_array(data.data(), data.size());
     }
 };
 
@@ -43,6 +43,9 @@ struct code
         error_expected_end_array,
         error_expected_end_assoc_array,
 
+        // Alignment filler that is skipped by the decoder
+        padding = 0x83,
+
         // Value types
         null = 0x82,
         true_value = 0x81,
@@ -57,6 +60,9 @@ struct code
         float32 = 0xC5,
         float64 = 0xD7,
 
+        // Zig-zag LEB128 integer
+        varint = 0x84,
+
         // Variable-length types
         array8_int8 = 0xA8,
         array16_int8 = 0xB8,
@@ -88,11 +94,26 @@ struct code
         array32_float64 = 0xCF,
         array64_float64 = 0xDF,
 
+        // LEB128 byte length, LEB128 element count, and zig-zag LEB128
+        // differences between consecutive integers
+        delta_array = 0x85,
+
+        // Footer with the offsets of top-level values that ends the token
+        // stream
+        index = 0x86,
+
         string8 = 0xA9,
         string16 = 0xB9,
         string32 = 0xC9,
         string64 = 0xD9,
 
+        // Byte length of the following container from its begin token
+        // through its end token
+        length8 = 0xA1,
+        length16 = 0xB1,
+        length32 = 0xC1,
+        length64 = 0xD1,
+
         // Group types
         begin_record = 0x90,
         end_record = 0x91,
@@ -276,12 +297,25 @@ struct float64
     static bool same(token::code::value);
 };
 
+struct varint
+{
+    using type = std::int64_t;
+    static const token::code::value code = token::code::varint;
+    static bool same(token::code::value);
+};
+
 struct string
 {
     using type = std::string;
     static bool same(token::code::value);
 };
 
+struct delta_array
+{
+    static const token::code::value code = token::code::delta_array;
+    static bool same(token::code::value);
+};
+
 //-----------------------------------------------------------------------------
 // Token traits
 //-----------------------------------------------------------------------------
@@ -304,6 +338,14 @@ struct type_cast
     using type = T;
 };
 
+// Element type of the compact array tokens that can hold T without
+// conversion.
+template <typename T, typename Enable = void>
+struct compact
+{
+    static const bool value = false;
+};
+
 } // namespace token
 } // namespace bintoken
 } // namespace protocol
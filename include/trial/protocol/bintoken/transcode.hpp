@@ -0,0 +1,63 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_TRANSCODE_HPP
+#define TRIAL_PROTOCOL_BINTOKEN_TRANSCODE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/writer.hpp>
+#include <trial/protocol/bintoken/reader.hpp>
+#include <trial/protocol/bintoken/writer.hpp>
+#include <trial/protocol/bintoken/detail/transcode.ipp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+
+//! @brief Transcode the current JSON value into BinToken.
+//!
+//! The value is converted token by token without building an intermediate
+//! tree, so memory usage only depends on the nesting depth. JSON objects
+//! become associative arrays. The reader is advanced past the value.
+//!
+//! @param[in,out] reader JSON reader positioned at the value.
+//! @param[out] writer Writer pointing to arbitrary location within a buffer.
+//! @throw json::error if the input is malformed.
+inline void transcode(json::reader& reader, bintoken::writer& writer)
+{
+    detail::json_transcoder transcoder(reader, writer);
+    transcoder.run();
+}
+
+//! @brief Transcode the current BinToken value into JSON.
+//!
+//! The value is converted token by token without building an intermediate
+//! tree, so memory usage only depends on the nesting depth. Records and
+//! compact arrays become JSON arrays, and associative arrays become JSON
+//! objects. The reader is advanced past the value.
+//!
+//! @param[in,out] reader BinToken reader positioned at the value.
+//! @param[out] writer Writer pointing to arbitrary location within a buffer.
+//! @throw bintoken::error if the input is malformed or an associative array
+//!        has a key that is not a string.
+inline void transcode(bintoken::reader& reader, json::writer& writer)
+{
+    detail::bintoken_transcoder transcoder(reader, writer);
+    transcoder.run();
+}
+
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_TRANSCODE_HPP
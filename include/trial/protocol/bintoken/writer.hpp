@@ -11,7 +11,11 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cstdint>
+#include <limits>
 #include <stack>
+#include <vector>
+#include <trial/protocol/buffer/vector.hpp>
 #include <trial/protocol/bintoken/error.hpp>
 #include <trial/protocol/bintoken/detail/encoder.hpp>
 
@@ -31,6 +35,8 @@ public:
     using string_view_type = typename detail::basic_encoder<N>::string_view_type;
 
     template <typename T> basic_writer(T&);
+    basic_writer(const basic_writer&) = delete;
+    basic_writer& operator=(const basic_writer&) = delete;
 
     template <typename T>
     size_type value();
@@ -41,14 +47,88 @@ public:
     template <typename T>
     size_type array(const T *, size_type);
 
+    //! @brief Align the payload of compact arrays.
+    //!
+    //! When enabled, padding tokens are inserted before each compact array
+    //! so that its payload starts at an offset from the beginning of the
+    //! output that is a multiple of the element size. This allows
+    //! reader::array_view() to access the payload directly if the output
+    //! is placed at a suitably aligned address.
+    void align_arrays(bool enable) BOOST_NOEXCEPT;
+
+    //! @brief Prefix containers with their length.
+    //!
+    //! When enabled, containers that are begun afterwards are preceded by
+    //! their length in bytes, which allows reader::next_sibling() and
+    //! partial::skip() to jump over them in constant time.
+    //!
+    //! The length is only known when the container is ended, so the
+    //! output is retained internally until the outermost length-prefixed
+    //! container has been ended. Compact arrays inside length-prefixed
+    //! containers are not aligned.
+    void prefix_containers(bool enable) BOOST_NOEXCEPT;
+
+    //! @brief Use variable-length integer encodings.
+    //!
+    //! When enabled, integers are written as varint tokens and integer
+    //! arrays as delta arrays whenever that is shorter than the fixed-length
+    //! encoding. Delta arrays cannot be accessed with reader::array_view().
+    void variable_integers(bool enable) BOOST_NOEXCEPT;
+
+    //! @brief Record the offsets of top-level values.
+    //!
+    //! When enabled, the offset of every top-level value that is written
+    //! afterwards is recorded for write_index().
+    void index_values(bool enable) BOOST_NOEXCEPT;
+
+    //! @brief Associate a key with the most recently indexed value.
+    //!
+    //! Keys are optional. If any value has a key, then indexed values without
+    //! a key are given the key zero.
+    //!
+    //! @throws system_error if no value has been indexed.
+    void index_key(std::int64_t key);
+
+    //! @brief Append an index footer with the recorded offsets and keys.
+    //!
+    //! The footer ends the token stream, so nothing should be written
+    //! afterwards. Readers stop at the footer, and record_index uses it to
+    //! locate top-level values in constant time.
+    //!
+    //! @throws system_error if a container is still open.
+    size_type write_index();
+
+    //! @brief Returns the number of bytes written so far.
+    size_type size() const BOOST_NOEXCEPT;
+
 private:
     void validate_scope(token::code::value, enum bintoken::errc);
+    detail::basic_encoder<N>& output() BOOST_NOEXCEPT;
+    void open_scope();
+    size_type close_scope();
+    void index_value(size_type start, size_type depth);
 
 private:
     template <typename T, typename Enable = void> struct overloader;
 
     detail::basic_encoder<N> encoder;
     std::stack<token::code::value> stack;
+    size_type offset = 0;
+    bool aligned = false;
+    bool variable = false;
+
+    // Length-prefixed containers
+    static const size_type unprefixed = std::numeric_limits<size_type>::max();
+    std::vector<std::uint8_t> pending;
+    detail::basic_encoder<N> pending_encoder;
+    std::stack<size_type> scopes;
+    size_type pending_scopes = 0;
+    bool prefixed = false;
+
+    // Index of top-level values
+    std::vector<std::uint64_t> records;
+    std::vector<std::int64_t> keys;
+    bool indexed = false;
 };
 
 using writer = basic_writer<>;
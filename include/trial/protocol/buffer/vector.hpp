@@ -43,7 +43,9 @@ protected:
         {
             if (size > buffer.max_size())
                 return false;
-            buffer.reserve(size);
+            // Grow geometrically as reserve() only allocates the requested size
+            const size_type doubled = 2 * buffer.capacity();
+            buffer.reserve(((doubled > size) && (doubled <= buffer.max_size())) ? doubled : size);
         }
         return true;
     }
@@ -11,11 +11,10 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <type_traits>
 #if __cplusplus >= 201806L
 # define TRIAL_PROTOCOL_HAS_HEADER_BIT 1
 # include <bit>
-#else
-# include <type_traits>
 #endif
 
 namespace trial
@@ -27,9 +26,15 @@ namespace core
 namespace detail
 {
 
+// Number of consecutive zero bits starting from the least significant bit
+
 #if defined(TRIAL_PROTOCOL_HAS_HEADER_BIT)
 
-using std::countl_zero;
+template <typename T>
+constexpr int countr_zero(T x) noexcept
+{
+    return std::countr_zero(typename std::make_unsigned<T>::type(x));
+}
 
 #else
 
@@ -38,27 +43,27 @@ namespace detail
 
 #if defined(__GNUC__) || defined(__clang__)
 
-inline constexpr int countl_zero(unsigned char x) noexcept
+inline constexpr int countr_zero(unsigned char x) noexcept
 {
     return __builtin_ctz(x);
 }
 
-inline constexpr int countl_zero(unsigned short x) noexcept
+inline constexpr int countr_zero(unsigned short x) noexcept
 {
     return __builtin_ctz(x);
 }
 
-inline constexpr int countl_zero(unsigned x) noexcept
+inline constexpr int countr_zero(unsigned x) noexcept
 {
     return __builtin_ctz(x);
 }
 
-inline constexpr int countl_zero(unsigned long x) noexcept
+inline constexpr int countr_zero(unsigned long x) noexcept
 {
         return __builtin_ctzl(x);
 }
 
-inline constexpr int countl_zero(unsigned long long x) noexcept
+inline constexpr int countr_zero(unsigned long long x) noexcept
 {
         return __builtin_ctzll(x);
 }
@@ -68,12 +73,12 @@ inline constexpr int countl_zero(unsigned long long x) noexcept
 } // namespace detail
 
 template <typename T>
-constexpr int countl_zero(T x) noexcept
+constexpr int countr_zero(T x) noexcept
 {
 #if defined(__GNUC__) || defined(__clang__)
-    return detail::countl_zero(typename std::make_unsigned<T>::type(x));
+    return detail::countr_zero(typename std::make_unsigned<T>::type(x));
 #else
-# error "No countl_zero implementation"
+# error "No countr_zero implementation"
 #endif
 }
 
@@ -12,10 +12,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #if !defined(TRIAL_LIKELY)
-# if __cplusplus >= 201803L
-#  define TRIAL_LIKELY(x) [[likely]] (x)
-#  define TRIAL_UNLIKELY(x) [[unlikely]] (x)
-# elif defined(__GNUC__) || defined(__clang__)
+// The C++20 [[likely]] attribute applies to statements rather than
+// expressions, so it cannot be used in conditions.
+# if defined(__GNUC__) || defined(__clang__)
 #  define TRIAL_LIKELY(x) __builtin_expect(bool(x), 1)
 #  define TRIAL_UNLIKELY(x) __builtin_expect(bool(x), 0)
 # else
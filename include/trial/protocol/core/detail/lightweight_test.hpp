@@ -231,16 +231,18 @@ void test_all_with_impl(FormattedOutputFunction& output,
 #define TRIAL_PROTOCOL_TEST_THROW_EQUAL(EXPR, EXCEP, MSG)               \
     try {                                                               \
         EXPR;                                                           \
-        ::boost::detail::throw_failed_impl                              \
-              (#EXCEP, __FILE__, __LINE__, BOOST_CURRENT_FUNCTION);     \
+        ::boost::detail::error_impl                                     \
+              ("Exception '" #EXCEP "' not thrown",                     \
+               __FILE__, __LINE__, BOOST_CURRENT_FUNCTION);             \
     }                                                                   \
     catch(EXCEP const& ex) {                                            \
         ::trial::protocol::core::detail::test_eq_impl                   \
             (#EXPR, #EXPR, __FILE__, __LINE__, BOOST_CURRENT_FUNCTION, std::string(ex.what()), MSG); \
     }                                                                   \
     catch(...) {                                                        \
-        ::boost::detail::throw_failed_impl                              \
-            (#EXCEP, __FILE__, __LINE__, BOOST_CURRENT_FUNCTION);       \
+        ::boost::detail::error_impl                                     \
+            ("Unexpected exception type instead of '" #EXCEP "'",       \
+             __FILE__, __LINE__, BOOST_CURRENT_FUNCTION);               \
     }
 
 #define TRIAL_PROTOCOL_TEST_NO_THROW(EXPR)                              \
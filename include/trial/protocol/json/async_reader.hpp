@@ -0,0 +1,191 @@
+#ifndef TRIAL_PROTOCOL_JSON_ASYNC_READER_HPP
+#define TRIAL_PROTOCOL_JSON_ASYNC_READER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#if !defined(__cpp_impl_coroutine)
+# error "trial/protocol/json/async_reader.hpp requires C++20 coroutines"
+#endif
+
+#include <coroutine>
+#include <cstddef> // std::size_t
+#include <exception>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <trial/protocol/json/error.hpp>
+#include <trial/protocol/json/token.hpp>
+#include <trial/protocol/json/reader.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace detail
+{
+
+// Coroutine that reads more input for an asynchronous reader and resumes the
+// awaiting coroutine when the next token is available.
+
+class async_refill
+{
+public:
+    struct promise_type;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    async_refill() noexcept = default;
+    async_refill(async_refill&&) noexcept;
+    async_refill& operator=(async_refill&&) noexcept;
+    ~async_refill();
+
+    handle_type handle() const noexcept;
+    void rethrow() const;
+
+private:
+    explicit async_refill(handle_type) noexcept;
+
+    handle_type coroutine;
+};
+
+} // namespace detail
+
+//! @brief Incremental JSON reader with asynchronous input.
+//!
+//! Parses JSON formatted input that is read from an asynchronous source.
+//! The reader awaits more input from the source when the next token is not
+//! in its buffer, so the input can arrive in arbitrary pieces.
+//!
+//! The Source must implement the following function:
+//! -# read_some(value_type *data, size_type size)
+//!
+//! read_some() must return an awaitable whose result is the number of
+//! characters that were stored in data, or zero at the end of the input.
+//! The reader does not depend on how the source suspends and resumes, so it
+//! can be used with any executor.
+//!
+//! The token accessors behave as with basic_reader. Views returned by
+//! literal() are invalidated by the next call to next().
+template <typename CharT, typename Source>
+class basic_async_reader
+{
+public:
+    using reader_type = basic_reader<CharT>;
+    using value_type = typename reader_type::value_type;
+    using size_type = typename reader_type::size_type;
+    using view_type = typename reader_type::view_type;
+
+    class next_awaitable;
+
+    //! @brief Construct an asynchronous JSON reader.
+    //!
+    //! No input is read until next() is awaited.
+    //!
+    //! @param[in] source The source of the input. It must outlive the reader.
+    //! @param[in] read_size The number of characters requested per read.
+    explicit basic_async_reader(Source& source, size_type read_size = 4096);
+
+    basic_async_reader(const basic_async_reader&) = delete;
+    basic_async_reader& operator=(const basic_async_reader&) = delete;
+
+    //! @brief Parse the next token.
+    //!
+    //! The first call parses the first token of the input.
+    //!
+    //! The returned awaitable completes without suspending if the buffered
+    //! input contains the next token. Otherwise input is read from the source
+    //! until the token is complete or the input ends.
+    //!
+    //! @returns Awaitable whose result is false if an error occurred or
+    //!          end-of-input was reached, true otherwise.
+    next_awaitable next();
+
+    //! @returns The current nesting level.
+    size_type level() const noexcept;
+
+    //! @returns The code of the current token.
+    token::code::value code() const noexcept;
+
+    //! @returns The symbol of the current token.
+    token::symbol::value symbol() const noexcept;
+
+    //! @returns The category of the current token.
+    token::category::value category() const noexcept;
+
+    //! @returns The current error code.
+    std::error_code error() const noexcept;
+
+    //! @brief Converts the current value into ReturnType.
+    //!
+    //! @throws json::error if requested type is incompatible with the current token.
+    template <typename ReturnType> ReturnType value() const;
+
+    //! @brief Converts the current value into T.
+    //!
+    //! @returns json::errc if requested type is incompatible with the current token.
+    template <typename T> json::errc value(T& output) const noexcept;
+
+    //! @brief Collects a converted string.
+    //!
+    //! @returns json::errc if requested type is incompatible with the current token.
+    template <typename Collector> json::errc string(Collector& collector) const noexcept;
+
+    //! @returns A view of the current value before it is converted into its type.
+    view_type literal() const noexcept;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    bool try_next();
+    bool incomplete(const value_type *mark) const noexcept;
+    detail::async_refill refill();
+
+private:
+    Source& source;
+    const size_type read_size;
+    // Unconsumed input
+    std::basic_string<value_type> buffer;
+    // Engaged when the first token has been parsed
+    std::optional<reader_type> reader;
+    bool exhausted = false;
+#endif
+};
+
+//! @brief Awaitable returned by basic_async_reader::next().
+template <typename CharT, typename Source>
+class basic_async_reader<CharT, Source>::next_awaitable
+{
+public:
+    bool await_ready();
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation);
+    bool await_resume() const;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    friend class basic_async_reader<CharT, Source>;
+
+    explicit next_awaitable(basic_async_reader& self) noexcept;
+
+    basic_async_reader& self;
+    detail::async_refill refill;
+#endif
+};
+
+template <typename Source>
+using async_reader = basic_async_reader<char, Source>;
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/json/detail/async_reader.ipp>
+
+#endif // TRIAL_PROTOCOL_JSON_ASYNC_READER_HPP
@@ -0,0 +1,296 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_ASYNC_READER_IPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_ASYNC_READER_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <functional> // std::less
+#include <iterator>
+#include <utility>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// async_refill
+//-----------------------------------------------------------------------------
+
+struct async_refill::promise_type
+{
+    // Resumes the awaiting coroutine by symmetric transfer
+    struct final_awaiter
+    {
+        bool await_ready() noexcept { return false; }
+        std::coroutine_handle<> await_suspend(handle_type self) noexcept
+        {
+            return self.promise().continuation;
+        }
+        void await_resume() noexcept {}
+    };
+
+    async_refill get_return_object() noexcept
+    {
+        return async_refill(handle_type::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    final_awaiter final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+};
+
+inline async_refill::async_refill(handle_type coroutine) noexcept
+    : coroutine(coroutine)
+{
+}
+
+inline async_refill::async_refill(async_refill&& other) noexcept
+    : coroutine(std::exchange(other.coroutine, nullptr))
+{
+}
+
+inline async_refill& async_refill::operator=(async_refill&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (coroutine)
+        {
+            coroutine.destroy();
+        }
+        coroutine = std::exchange(other.coroutine, nullptr);
+    }
+    return *this;
+}
+
+inline async_refill::~async_refill()
+{
+    if (coroutine)
+    {
+        coroutine.destroy();
+    }
+}
+
+inline auto async_refill::handle() const noexcept -> handle_type
+{
+    return coroutine;
+}
+
+inline void async_refill::rethrow() const
+{
+    if (coroutine && coroutine.promise().exception)
+    {
+        std::rethrow_exception(coroutine.promise().exception);
+    }
+}
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+// basic_async_reader::next_awaitable
+//-----------------------------------------------------------------------------
+
+template <typename CharT, typename Source>
+basic_async_reader<CharT, Source>::next_awaitable::next_awaitable(basic_async_reader& self) noexcept
+    : self(self)
+{
+}
+
+template <typename CharT, typename Source>
+bool basic_async_reader<CharT, Source>::next_awaitable::await_ready()
+{
+    // Completes without suspending if the buffer contains the next token
+    return self.try_next();
+}
+
+template <typename CharT, typename Source>
+std::coroutine_handle<> basic_async_reader<CharT, Source>::next_awaitable::await_suspend(std::coroutine_handle<> continuation)
+{
+    refill = self.refill();
+    refill.handle().promise().continuation = continuation;
+    return refill.handle();
+}
+
+template <typename CharT, typename Source>
+bool basic_async_reader<CharT, Source>::next_awaitable::await_resume() const
+{
+    refill.rethrow();
+    return self.code() >= token::code::null;
+}
+
+//-----------------------------------------------------------------------------
+// basic_async_reader
+//-----------------------------------------------------------------------------
+
+template <typename CharT, typename Source>
+basic_async_reader<CharT, Source>::basic_async_reader(Source& source,
+                                                      size_type read_size)
+    : source(source),
+      read_size(read_size)
+{
+}
+
+template <typename CharT, typename Source>
+auto basic_async_reader<CharT, Source>::next() -> next_awaitable
+{
+    return next_awaitable(*this);
+}
+
+template <typename CharT, typename Source>
+auto basic_async_reader<CharT, Source>::level() const noexcept -> size_type
+{
+    return reader ? reader->level() : 0;
+}
+
+template <typename CharT, typename Source>
+token::code::value basic_async_reader<CharT, Source>::code() const noexcept
+{
+    return reader ? reader->code() : token::code::uninitialized;
+}
+
+template <typename CharT, typename Source>
+token::symbol::value basic_async_reader<CharT, Source>::symbol() const noexcept
+{
+    return token::symbol::convert(code());
+}
+
+template <typename CharT, typename Source>
+token::category::value basic_async_reader<CharT, Source>::category() const noexcept
+{
+    return token::category::convert(code());
+}
+
+template <typename CharT, typename Source>
+std::error_code basic_async_reader<CharT, Source>::error() const noexcept
+{
+    return reader ? reader->error() : json::make_error_code(json::no_error);
+}
+
+template <typename CharT, typename Source>
+template <typename ReturnType>
+ReturnType basic_async_reader<CharT, Source>::value() const
+{
+    if (!reader)
+        throw json::error(json::incompatible_type);
+    return reader->template value<ReturnType>();
+}
+
+template <typename CharT, typename Source>
+template <typename T>
+auto basic_async_reader<CharT, Source>::value(T& output) const noexcept -> json::errc
+{
+    return reader ? reader->value(output) : json::incompatible_type;
+}
+
+template <typename CharT, typename Source>
+template <typename Collector>
+auto basic_async_reader<CharT, Source>::string(Collector& collector) const noexcept -> json::errc
+{
+    return reader ? reader->string(collector) : json::incompatible_type;
+}
+
+template <typename CharT, typename Source>
+auto basic_async_reader<CharT, Source>::literal() const noexcept -> view_type
+{
+    return reader ? reader->literal() : view_type();
+}
+
+// Parses the next token from the buffer. Returns false, with the reader
+// restored to its previous state, if the token may continue in input that
+// has not been read yet.
+
+template <typename CharT, typename Source>
+bool basic_async_reader<CharT, Source>::try_next()
+{
+    if (!reader)
+    {
+        reader.emplace(view_type(buffer.data(), buffer.size()));
+        if (!exhausted && incomplete(buffer.data()))
+        {
+            reader.reset();
+            return false;
+        }
+        return true;
+    }
+
+    auto& decoder = reader->decoder;
+    const value_type *mark = decoder.tail().data();
+    const auto frame = reader->stack.top();
+    const auto current = decoder.code();
+    reader->next();
+    if (!exhausted && incomplete(mark))
+    {
+        // Incomplete tokens are never containers, so the nesting is unchanged
+        reader->stack.top() = frame;
+        decoder.code(current);
+        decoder.tail(mark, decoder.tail().end());
+        return false;
+    }
+    return true;
+}
+
+template <typename CharT, typename Source>
+bool basic_async_reader<CharT, Source>::incomplete(const value_type *mark) const noexcept
+{
+    const auto& decoder = reader->decoder;
+    switch (decoder.code())
+    {
+    case token::code::end:
+        return true;
+
+    default:
+        if ((decoder.code() < 0) || decoder.tail().empty())
+        {
+            // The reader reports the end of the buffer as a grammar error
+            // without moving the view past the previous token
+            if (decoder.tail().empty() &&
+                std::less<const value_type *>()(decoder.literal().data(), mark))
+                return true;
+            return decoder.partial(mark);
+        }
+        return false;
+    }
+}
+
+template <typename CharT, typename Source>
+detail::async_refill basic_async_reader<CharT, Source>::refill()
+{
+    do
+    {
+        // Discard consumed input and append the read input
+        const value_type *first = reader ? reader->decoder.tail().data() : buffer.data();
+        buffer.erase(0, std::distance<const value_type *>(buffer.data(), first));
+        const size_type size = buffer.size();
+        buffer.resize(size + read_size);
+        const size_type count = co_await source.read_some(&buffer[size], read_size);
+        buffer.resize(size + count);
+        if (count == 0)
+        {
+            exhausted = true;
+        }
+        if (reader)
+        {
+            reader->decoder.tail(buffer.data(), buffer.data() + buffer.size());
+        }
+    } while (!try_next());
+}
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_ASYNC_READER_IPP
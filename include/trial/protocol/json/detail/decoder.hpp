@@ -18,6 +18,7 @@
 #include <trial/protocol/core/char_traits.hpp>
 #include <trial/protocol/json/token.hpp>
 #include <trial/protocol/json/error.hpp>
+#include <trial/protocol/json/validation.hpp>
 
 namespace trial
 {
@@ -28,7 +29,7 @@ namespace json
 namespace detail
 {
 
-template <typename CharT>
+template <typename CharT, json::validation Mode = json::validation::strict>
 class basic_decoder
 {
 public:
@@ -45,15 +46,24 @@ public:
 
     void next() noexcept;
     inline void assume_next() noexcept;
+    // Move the input to the end bracket of the current container
+    bool skip_container() noexcept;
 
     void code(token::code::value) noexcept;
     token::code::value code() const noexcept;
     std::error_code error() const noexcept;
     const view_type& literal() const noexcept;
     const view_type& tail() const noexcept;
+    // Replace the remaining input without parsing it
+    void tail(const_pointer first, const_pointer last) noexcept;
+    // Check if the current token may continue after the end of the input.
+    // The mark is where the search for the current token started.
+    bool partial(const_pointer mark) const noexcept;
     template <typename T> json::errc signed_value(T&) const noexcept;
     template <typename T> json::errc unsigned_value(T&) const noexcept;
     template <typename Collector> void string_value(Collector&) const noexcept;
+    // Check if the current string contains escape sequences
+    bool has_escape() const noexcept;
     template <typename T> json::errc value(T&) const noexcept;
     template <typename T> void real_value(T&) const noexcept;
 
@@ -76,6 +86,9 @@ private:
     void next_t_keyword() noexcept;
     void next_number() noexcept;
     void next_string() noexcept;
+    // Only recognize the extent of tokens from trusted input
+    void next_trusted_number() noexcept;
+    void next_trusted_string() noexcept;
 
     void skip_whitespaces() noexcept;
     bool at_keyword_end() const noexcept;
@@ -13,6 +13,7 @@
 
 #include <cassert>
 #include <cstdlib> // std::atof
+#include <functional> // std::less
 #include <iterator>
 #include <limits>
 #include <type_traits>
@@ -36,8 +37,8 @@ namespace json
 namespace detail
 {
 
-template <typename CharT>
-basic_decoder<CharT>::basic_decoder(const_pointer first,
+template <typename CharT, json::validation Mode>
+basic_decoder<CharT, Mode>::basic_decoder(const_pointer first,
                                     const_pointer last)
     : input(first, last),
       current{token::code::uninitialized, {}, {}}
@@ -45,40 +46,40 @@ basic_decoder<CharT>::basic_decoder(const_pointer first,
     next();
 }
 
-template <typename CharT>
-basic_decoder<CharT>::basic_decoder(const_pointer first,
+template <typename CharT, json::validation Mode>
+basic_decoder<CharT, Mode>::basic_decoder(const_pointer first,
                                     size_type length)
     : basic_decoder(first, first + length)
 {
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <std::size_t M>
-basic_decoder<CharT>::basic_decoder(const value_type (&array)[M])
+basic_decoder<CharT, Mode>::basic_decoder(const value_type (&array)[M])
     : basic_decoder(array, array + M - 1) // Skip terminating zero
 {
 }
 
-template <typename CharT>
-void basic_decoder<CharT>::code(token::code::value code) noexcept
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::code(token::code::value code) noexcept
 {
     current.code = code;
 }
 
-template <typename CharT>
-token::code::value basic_decoder<CharT>::code() const noexcept
+template <typename CharT, json::validation Mode>
+token::code::value basic_decoder<CharT, Mode>::code() const noexcept
 {
     return current.code;
 }
 
-template <typename CharT>
-std::error_code basic_decoder<CharT>::error() const noexcept
+template <typename CharT, json::validation Mode>
+std::error_code basic_decoder<CharT, Mode>::error() const noexcept
 {
     return json::make_error_code(to_errc(code()));
 }
 
-template <typename CharT>
-void basic_decoder<CharT>::next() noexcept
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::next() noexcept
 {
     if (current.code < 0)
         return; // Already marked as error
@@ -90,8 +91,8 @@ void basic_decoder<CharT>::next() noexcept
     assume_next();
 }
 
-template <typename CharT>
-void basic_decoder<CharT>::assume_next() noexcept
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::assume_next() noexcept
 {
     skip_whitespaces();
 
@@ -123,9 +124,13 @@ void basic_decoder<CharT>::assume_next() noexcept
     case traits::alphabet<CharT>::digit_7:
     case traits::alphabet<CharT>::digit_8:
     case traits::alphabet<CharT>::digit_9:
+        if (Mode == json::validation::trusted)
+            return next_trusted_number();
         return next_number();
 
     case traits::alphabet<CharT>::quote:
+        if (Mode == json::validation::trusted)
+            return next_trusted_string();
         return next_string();
 
     case traits::alphabet<CharT>::brace_open:
@@ -152,9 +157,9 @@ void basic_decoder<CharT>::assume_next() noexcept
     }
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename T>
-auto basic_decoder<CharT>::signed_value(T& output) const noexcept -> json::errc
+auto basic_decoder<CharT, Mode>::signed_value(T& output) const noexcept -> json::errc
 {
     static_assert(std::is_signed<T>::value, "T must be signed integer");
 
@@ -195,9 +200,9 @@ auto basic_decoder<CharT>::signed_value(T& output) const noexcept -> json::errc
     }
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename T>
-auto basic_decoder<CharT>::unsigned_value(const_pointer head,
+auto basic_decoder<CharT, Mode>::unsigned_value(const_pointer head,
                                           const_pointer tail,
                                           T& output) const noexcept -> json::errc
 {
@@ -211,8 +216,8 @@ auto basic_decoder<CharT>::unsigned_value(const_pointer head,
     return errc;
 }
 
-template <typename CharT>
-auto basic_decoder<CharT>::unsigned_value(const_pointer marker,
+template <typename CharT, json::validation Mode>
+auto basic_decoder<CharT, Mode>::unsigned_value(const_pointer marker,
                                           const_pointer tail,
                                           std::uint8_t& output) const noexcept -> json::errc
 {
@@ -270,8 +275,8 @@ error:
     return json::invalid_value;
 }
 
-template <typename CharT>
-auto basic_decoder<CharT>::unsigned_value(const_pointer marker,
+template <typename CharT, json::validation Mode>
+auto basic_decoder<CharT, Mode>::unsigned_value(const_pointer marker,
                                           const_pointer tail,
                                           std::uint16_t& output) const noexcept -> json::errc
 {
@@ -363,8 +368,8 @@ error:
     return json::invalid_value;
 }
 
-template <typename CharT>
-auto basic_decoder<CharT>::unsigned_value(const_pointer marker,
+template <typename CharT, json::validation Mode>
+auto basic_decoder<CharT, Mode>::unsigned_value(const_pointer marker,
                                           const_pointer tail,
                                           std::uint32_t& output) const noexcept -> json::errc
 {
@@ -548,8 +553,8 @@ error:
     return json::invalid_value;
 }
 
-template <typename CharT>
-auto basic_decoder<CharT>::unsigned_value(const_pointer marker,
+template <typename CharT, json::validation Mode>
+auto basic_decoder<CharT, Mode>::unsigned_value(const_pointer marker,
                                           const_pointer tail,
                                           std::uint64_t& output) const noexcept -> json::errc
 {
@@ -993,9 +998,9 @@ error:
     return json::invalid_value;
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename T>
-T basic_decoder<CharT>::signed_value() const
+T basic_decoder<CharT, Mode>::signed_value() const
 {
     if (current.code != token::code::integer)
         throw_on_error(errc::incompatible_type);
@@ -1005,9 +1010,9 @@ T basic_decoder<CharT>::signed_value() const
     return result;
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename T>
-T basic_decoder<CharT>::unsigned_value() const
+T basic_decoder<CharT, Mode>::unsigned_value() const
 {
     if (current.code != token::code::integer)
         throw_on_error(errc::incompatible_type);
@@ -1017,9 +1022,9 @@ T basic_decoder<CharT>::unsigned_value() const
     return result;
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename T>
-auto basic_decoder<CharT>::unsigned_value(T& output) const noexcept -> json::errc
+auto basic_decoder<CharT, Mode>::unsigned_value(T& output) const noexcept -> json::errc
 {
     if (current.code != token::code::integer)
         return errc::incompatible_type;
@@ -1029,13 +1034,13 @@ auto basic_decoder<CharT>::unsigned_value(T& output) const noexcept -> json::err
     return unsigned_value(literal().begin(), literal().end(), output);
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename T>
-void basic_decoder<CharT>::real_value(T& output) const noexcept
+void basic_decoder<CharT, Mode>::real_value(T& output) const noexcept
 {
     static_assert(std::is_floating_point<T>::value, "T must be floating-point");
 
-    assert(current.code == token::code::real);
+    assert((current.code == token::code::real) || (current.code == token::code::integer));
 
     static constexpr T zero = T(0.0);
     static constexpr T one = T(1.0);
@@ -1047,6 +1052,24 @@ void basic_decoder<CharT>::real_value(T& output) const noexcept
     {
         ++marker;
     }
+    if (current.code == token::code::integer)
+    {
+        // Integers that do not fit into an integral type. The leading digits
+        // are converted exactly to limit the rounding error.
+        const auto tail = current.scan.number.integer_tail;
+        const auto head_tail = (std::distance(marker, tail) > 19) ? marker + 19 : tail;
+        std::uint64_t head = 0;
+        unsigned_value(marker, head_tail, head);
+        T result = T(head);
+        for (marker = head_tail; marker != tail; ++marker)
+        {
+            result *= base;
+            result += unsigned(*marker - traits::alphabet<CharT>::digit_0);
+        }
+        output = is_negative ? -result : result;
+        return;
+    }
+
     T result = unsigned(*marker++ - traits::alphabet<CharT>::digit_0);
     while (marker != current.scan.number.integer_tail)
     {
@@ -1296,9 +1319,9 @@ void basic_decoder<CharT>::real_value(T& output) const noexcept
     output = is_negative ? -result : result;
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename T>
-T basic_decoder<CharT>::real_value() const
+T basic_decoder<CharT, Mode>::real_value() const
 {
     if (current.code != token::code::real)
         throw_on_error(errc::incompatible_type);
@@ -1308,9 +1331,9 @@ T basic_decoder<CharT>::real_value() const
     return result;
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename Collector>
-void basic_decoder<CharT>::string_value(Collector& collector) const noexcept
+void basic_decoder<CharT, Mode>::string_value(Collector& collector) const noexcept
 {
     // FIXME: Validate string [ http://www.w3.org/International/questions/qa-forms-utf-8 ]
     assert(current.code == token::code::string);
@@ -1508,9 +1531,9 @@ void basic_decoder<CharT>::string_value(Collector& collector) const noexcept
     }
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename T>
-T basic_decoder<CharT>::string_value() const
+T basic_decoder<CharT, Mode>::string_value() const
 {
     if (current.code != token::code::string)
         throw_on_error(errc::incompatible_type);
@@ -1520,28 +1543,97 @@ T basic_decoder<CharT>::string_value() const
     return result;
 }
 
-template <typename CharT>
-auto basic_decoder<CharT>::literal() const noexcept -> const view_type&
+template <typename CharT, json::validation Mode>
+bool basic_decoder<CharT, Mode>::has_escape() const noexcept
+{
+    assert(current.code == token::code::string);
+
+    // Escape sequences terminate segments, so an unescaped string is either
+    // empty or a single segment from the initial to the terminating quote
+    switch (current.scan.string.length)
+    {
+    case 0:
+        return current.view.size() > 2;
+
+    case 1:
+        return (current.scan.string.segment_tail[0] != current.view.end() - 1) ||
+            (current.view[1] == traits::alphabet<CharT>::reverse_solidus);
+
+    default:
+        return true;
+    }
+}
+
+template <typename CharT, json::validation Mode>
+auto basic_decoder<CharT, Mode>::literal() const noexcept -> const view_type&
 {
     return current.view;
 }
 
-template <typename CharT>
-auto basic_decoder<CharT>::tail() const noexcept -> const view_type&
+template <typename CharT, json::validation Mode>
+bool basic_decoder<CharT, Mode>::skip_container() noexcept
+{
+    const auto position = scan_container(input.begin(), input.end());
+    if (position == input.end())
+        return false;
+    input.remove_front(position - input.begin());
+    return true;
+}
+
+template <typename CharT, json::validation Mode>
+auto basic_decoder<CharT, Mode>::tail() const noexcept -> const view_type&
 {
     return input;
 }
 
-template <typename CharT>
-void basic_decoder<CharT>::next_token(token::code::value type) noexcept
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::tail(const_pointer first, const_pointer last) noexcept
+{
+    input = view_type(first, last);
+}
+
+template <typename CharT, json::validation Mode>
+bool basic_decoder<CharT, Mode>::partial(const_pointer mark) const noexcept
+{
+    // The view belongs to the previous token if only whitespaces or an
+    // illegal character were found after mark
+    if (std::less<const_pointer>()(current.view.data(), mark))
+        return false;
+
+    const const_pointer view_end = current.view.end();
+    switch (current.code)
+    {
+    case token::code::end:
+        // Number without digits after sign, dot, or exponent
+    case token::code::null:
+    case token::code::true_value:
+    case token::code::false_value:
+    case token::code::integer:
+    case token::code::real:
+        return view_end == input.end();
+
+    default:
+        if (current.code < 0)
+        {
+            // Unterminated string or truncated keyword. Truncated keywords
+            // are shorter than the longest keyword.
+            return (view_end == input.end()) ||
+                (std::distance(current.view.data(), input.end()) < 5);
+        }
+        return false;
+    }
+}
+
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::next_token(token::code::value type) noexcept
 {
     current.view = view_type(input.begin(), 1);
     input.remove_front();
     current.code = type;
 }
 
-template <typename CharT>
-void basic_decoder<CharT>::next_f_keyword() noexcept
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::next_f_keyword() noexcept
 {
     token::code::value type = token::code::false_value;
     auto marker = input.begin();
@@ -1578,8 +1670,8 @@ void basic_decoder<CharT>::next_f_keyword() noexcept
     current.code = type;
 }
 
-template <typename CharT>
-void basic_decoder<CharT>::next_n_keyword() noexcept
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::next_n_keyword() noexcept
 {
     token::code::value type = token::code::null;
     auto marker = input.begin();
@@ -1616,8 +1708,8 @@ void basic_decoder<CharT>::next_n_keyword() noexcept
     current.code = type;
 }
 
-template <typename CharT>
-void basic_decoder<CharT>::next_t_keyword() noexcept
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::next_t_keyword() noexcept
 {
     token::code::value type = token::code::true_value;
     auto marker = input.begin();
@@ -1654,8 +1746,8 @@ void basic_decoder<CharT>::next_t_keyword() noexcept
     current.code = type;
 }
 
-template <typename CharT>
-void basic_decoder<CharT>::next_number() noexcept
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::next_number() noexcept
 {
     // RFC 8259, section 6
     //
@@ -1772,8 +1864,8 @@ void basic_decoder<CharT>::next_number() noexcept
     current.code = type;
 }
 
-template <typename CharT>
-void basic_decoder<CharT>::next_string() noexcept
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::next_string() noexcept
 {
     // RFC 8259, section 7
     //
@@ -1953,15 +2045,135 @@ void basic_decoder<CharT>::next_string() noexcept
     current.code = token::code::error_unexpected_token;
 }
 
-template <typename CharT>
-void basic_decoder<CharT>::skip_whitespaces() noexcept
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::next_trusted_number() noexcept
+{
+    // Same as next_number() without the grammar checks
+
+    auto begin = input.begin();
+    token::code::value type = token::code::integer;
+
+    if (*begin == traits::alphabet<CharT>::minus)
+    {
+        input.remove_front();
+    }
+    auto marker = scan_digit(input.begin(), input.end());
+    input.remove_front(std::distance(input.begin(), marker));
+    current.scan.number.integer_tail = input.begin();
+    if (!input.empty() && (input.front() == traits::alphabet<CharT>::dot))
+    {
+        type = token::code::real;
+        input.remove_front();
+        marker = scan_digit(input.begin(), input.end());
+        current.scan.number.fraction_tail = marker;
+        input.remove_front(std::distance(input.begin(), marker));
+    }
+    if (!input.empty() && ((input.front() == traits::alphabet<CharT>::letter_E) ||
+                           (input.front() == traits::alphabet<CharT>::letter_e)))
+    {
+        type = token::code::real;
+        input.remove_front();
+        if (!input.empty() && ((input.front() == traits::alphabet<CharT>::plus) ||
+                               (input.front() == traits::alphabet<CharT>::minus)))
+        {
+            input.remove_front();
+        }
+        marker = scan_digit(input.begin(), input.end());
+        input.remove_front(std::distance(input.begin(), marker));
+    }
+    current.view = view_type(begin, input.begin());
+    current.code = type;
+}
+
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::next_trusted_string() noexcept
+{
+    // Same as next_string() without validation of escape sequences and
+    // UTF-8 continuation bytes. The segments must still be recorded
+    // as string_value() depends on them.
+
+    assert(input.front() == traits::alphabet<CharT>::quote);
+
+    current.scan.string.length = 0;
+    auto marker = input.begin();
+    const auto end = input.end();
+    bool in_segment = false;
+    ++marker; // Skip initial '"'
+    while (marker != end)
+    {
+        const auto category = traits::to_category(*marker++);
+        switch (category)
+        {
+        case traits::category::escape:
+            {
+                // Skip escaped character, including the hex digits of
+                // unicode escapes
+                if (marker == end)
+                    goto error;
+                const auto length = (*marker == traits::alphabet<CharT>::letter_u) ? 5 : 1;
+                if (std::distance(marker, end) < length)
+                    goto error;
+                marker += length;
+                in_segment = false;
+            }
+            break;
+
+        case traits::category::quote:
+            current.view = view_type(input.begin(), marker); // Includes terminating '"'
+            input.remove_front(std::distance(input.begin(), marker));
+            current.code = token::code::string;
+            return;
+
+        case traits::category::narrow:
+        case traits::category::extra_1:
+        case traits::category::extra_2:
+        case traits::category::extra_3:
+        case traits::category::extra_4:
+        case traits::category::extra_5:
+            {
+                if (category == traits::category::narrow)
+                {
+                    marker = scan_narrow(marker, end);
+                }
+                else
+                {
+                    // Skip UTF-8 continuation bytes
+                    const auto length = int(category) - int(traits::category::narrow);
+                    if (std::distance(marker, end) < length)
+                        goto error;
+                    marker += length;
+                }
+                if (in_segment)
+                {
+                    current.scan.string.segment_tail[current.scan.string.length - 1] = marker;
+                }
+                else if (current.scan.string.length < segment_max)
+                {
+                    current.scan.string.segment_tail[current.scan.string.length] = marker;
+                    ++current.scan.string.length;
+                    in_segment = true;
+                }
+            }
+            break;
+
+        case traits::category::illegal:
+            goto error;
+        }
+    }
+ error:
+    current.view = view_type(input.begin(), marker);
+    current.code = token::code::error_unexpected_token;
+}
+
+template <typename CharT, json::validation Mode>
+void basic_decoder<CharT, Mode>::skip_whitespaces() noexcept
 {
     const auto it = scan_whitespace(input.begin(), input.end());
     input.remove_front(std::distance(input.begin(), it));
 }
 
-template <typename CharT>
-bool basic_decoder<CharT>::at_keyword_end() const noexcept
+template <typename CharT, json::validation Mode>
+bool basic_decoder<CharT, Mode>::at_keyword_end() const noexcept
 {
     if (input.empty())
     {
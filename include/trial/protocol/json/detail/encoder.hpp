@@ -11,6 +11,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <array>
 #include <cstdint>
 #include <string>
 #include <type_traits>
@@ -53,12 +54,38 @@ public:
     //! @brief Write string literal
     size_type value(const value_type *);
 
+    //! @brief Write array of values
+    //!
+    //! Type U must be an arithmetic type.
+    template <typename U> size_type values(const U *, size_type);
+
     size_type literal(const view_type&);
 
 private:
     template <typename T, typename Enable = void>
     struct overloader;
 
+    struct chunk
+    {
+        static constexpr size_type capacity = 512;
+        // Reserved space for a formatted element and its separator
+        static constexpr size_type reserve = 64;
+
+        std::array<value_type, capacity> data;
+        size_type size = 0;
+        // Number of characters written to the buffer
+        size_type written = 0;
+    };
+
+    bool flush(chunk&);
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value, bool>::type
+    append(chunk&, const T&);
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+    append(chunk&, const T&);
+    bool append(chunk&, bool);
+
     template <typename T> size_type integral_value(const T&);
     template <typename T> size_type floating_value(const T&);
     template <typename T> size_type string_value(const T&);
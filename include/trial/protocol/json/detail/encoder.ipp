@@ -11,6 +11,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <cmath>
 #include <iterator>
 #include <array>
@@ -308,6 +309,37 @@ auto basic_encoder<CharT, N>::literal(const view_type& data) -> size_type
     return write(data);
 }
 
+template <typename CharT, std::size_t N>
+template <typename U>
+auto basic_encoder<CharT, N>::values(const U *data, size_type size) -> size_type
+{
+    static_assert(std::is_arithmetic<U>::value, "values() requires an arithmetic type");
+
+    // Separators and elements are formatted into a chunk that is written to
+    // the buffer when full, rather than growing the buffer per character
+    chunk work;
+    work.data[work.size++] = traits::alphabet<CharT>::bracket_open;
+    for (size_type i = 0; i < size; ++i)
+    {
+        if (work.capacity - work.size < work.reserve + 2)
+        {
+            if (!flush(work))
+                return 0;
+        }
+        if (i != 0)
+        {
+            work.data[work.size++] = traits::alphabet<CharT>::comma;
+        }
+        if (!append(work, data[i]))
+            return 0;
+    }
+    work.data[work.size++] = traits::alphabet<CharT>::bracket_close;
+    if (!flush(work))
+        return 0;
+    return work.written;
+}
+
+
 template <typename CharT, std::size_t N>
 template <typename T>
 auto basic_encoder<CharT, N>::integral_value(const T& data) -> size_type
@@ -550,6 +582,109 @@ auto basic_encoder<CharT, N>::name_separator_value() -> size_type
     return write(traits::alphabet<CharT>::colon);
 }
 
+template <typename CharT, std::size_t N>
+bool basic_encoder<CharT, N>::flush(chunk& work)
+{
+    const size_type size = work.size;
+    work.size = 0;
+    if (write(view_type(work.data.data(), size)) != size)
+        return false;
+    work.written += size;
+    return true;
+}
+
+// The chunk has room for chunk::reserve characters when an element is
+// appended.
+
+template <typename CharT, std::size_t N>
+template <typename T>
+auto basic_encoder<CharT, N>::append(chunk& work, const T& data)
+    -> typename std::enable_if<std::is_integral<T>::value, bool>::type
+{
+    static_assert(std::numeric_limits<T>::digits10 + 2 < chunk::reserve, "chunk reserve is too small");
+
+    // Build number backwards at the end of the reserved space and move it
+    // into place
+    value_type *const head = work.data.data() + work.size;
+    value_type *const tail = head + work.reserve;
+    value_type *where = tail;
+    const bool is_negative = data < 0;
+    using unsigned_type = typename std::make_unsigned<T>::type;
+    auto number = unsigned_type(detail::absolute<T>::value(data));
+    do
+    {
+        *--where = value_type(traits::alphabet<CharT>::digit_0 + (number % 10));
+        number /= 10;
+    } while (number != 0);
+    if (is_negative)
+    {
+        *--where = traits::alphabet<CharT>::minus;
+    }
+    std::copy(where, tail, head);
+    work.size += size_type(tail - where);
+    return true;
+}
+
+template <typename CharT, std::size_t N>
+template <typename T>
+auto basic_encoder<CharT, N>::append(chunk& work, const T& data)
+    -> typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+{
+    switch (std::fpclassify(data))
+    {
+    case FP_INFINITE:
+    case FP_NAN:
+        {
+            // Infinity and NaN must be encoded as null
+            static constexpr CharT null_text[] = {
+                traits::alphabet<CharT>::letter_n,
+                traits::alphabet<CharT>::letter_u,
+                traits::alphabet<CharT>::letter_l,
+                traits::alphabet<CharT>::letter_l
+            };
+            work.size = std::copy(std::begin(null_text), std::end(null_text), work.data.begin() + work.size) - work.data.begin();
+            return true;
+        }
+    default:
+        {
+            const auto text = detail::string_converter<CharT, T>::encode(data);
+            if (text.size() > work.reserve)
+            {
+                // Too large for the chunk
+                if (!flush(work) || (write(text) != text.size()))
+                    return false;
+                work.written += text.size();
+                return true;
+            }
+            work.size = std::copy(text.begin(), text.end(), work.data.begin() + work.size) - work.data.begin();
+            return true;
+        }
+    }
+}
+
+template <typename CharT, std::size_t N>
+bool basic_encoder<CharT, N>::append(chunk& work, bool data)
+{
+    static constexpr CharT true_text[] = {
+        traits::alphabet<CharT>::letter_t,
+        traits::alphabet<CharT>::letter_r,
+        traits::alphabet<CharT>::letter_u,
+        traits::alphabet<CharT>::letter_e
+    };
+    static constexpr CharT false_text[] = {
+        traits::alphabet<CharT>::letter_f,
+        traits::alphabet<CharT>::letter_a,
+        traits::alphabet<CharT>::letter_l,
+        traits::alphabet<CharT>::letter_s,
+        traits::alphabet<CharT>::letter_e
+    };
+    const auto where = work.data.begin() + work.size;
+    work.size = (data
+                 ? std::copy(std::begin(true_text), std::end(true_text), where)
+                 : std::copy(std::begin(false_text), std::end(false_text), where)) - work.data.begin();
+    return true;
+}
+
 template <typename CharT, std::size_t N>
 auto basic_encoder<CharT, N>::write(value_type character) -> size_type
 {
@@ -0,0 +1,232 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_FILTER_IPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_FILTER_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+template <typename CharT>
+basic_filter<CharT>::basic_filter()
+    : rules(1, trie_type::npos)
+{
+}
+
+template <typename CharT>
+auto basic_filter<CharT>::replace(const view_type& path,
+                                  callback_type callback) -> size_type
+{
+    if (!callback)
+        throw json::error(invalid_value);
+    return insert(path, std::move(callback));
+}
+
+template <typename CharT>
+auto basic_filter<CharT>::erase(const view_type& path) -> size_type
+{
+    return insert(path, callback_type());
+}
+
+template <typename CharT>
+void basic_filter<CharT>::relaxed(bool enable) noexcept
+{
+    mode = enable ? partial::skip_mode::relaxed : partial::skip_mode::strict;
+}
+
+template <typename CharT>
+void basic_filter<CharT>::apply(reader_type& reader,
+                                writer_type& writer,
+                                std::error_code& ec) const
+{
+    std::vector<size_type> active;
+    active.push_back(0);
+    visit(reader, writer, active, 0, ec);
+}
+
+template <typename CharT>
+void basic_filter<CharT>::apply(reader_type& reader,
+                                writer_type& writer) const
+{
+    std::error_code ec;
+    apply(reader, writer, ec);
+    if (ec)
+        throw json::error(ec);
+}
+
+template <typename CharT>
+auto basic_filter<CharT>::insert(const view_type& path,
+                                 callback_type callback) -> size_type
+{
+    const size_type node = trie.insert(path);
+    rules.resize(trie.size(), trie_type::npos);
+    const size_type result = callbacks.size();
+    if (rules[node] == trie_type::npos)
+    {
+        rules[node] = result;
+    }
+    callbacks.push_back(std::move(callback));
+    return result;
+}
+
+// Returns the first rule of the active nodes
+template <typename CharT>
+auto basic_filter<CharT>::find(const std::vector<size_type>& active,
+                               size_type first,
+                               size_type last) const noexcept -> size_type
+{
+    size_type result = trie_type::npos;
+    for (size_type i = first; i < last; ++i)
+    {
+        const size_type rule = rules[active[i]];
+        if (rule < result)
+        {
+            result = rule;
+        }
+    }
+    return result;
+}
+
+// The nodes that match the current value are active[first..]. Nodes that
+// match nested values are appended to active while they are visited.
+
+template <typename CharT>
+void basic_filter<CharT>::visit(reader_type& reader,
+                                writer_type& writer,
+                                std::vector<size_type>& active,
+                                size_type first,
+                                std::error_code& ec) const
+{
+    const size_type last = active.size();
+
+    const size_type rule = find(active, first, last);
+    if (rule != trie_type::npos)
+    {
+        const auto literal = partial::skip(reader, mode, ec);
+        if (ec)
+            return;
+        if (callbacks[rule])
+        {
+            callbacks[rule](match{ rule, literal }, writer);
+        }
+        return;
+    }
+
+    const auto symbol = reader.symbol();
+    if (!trie.descend(active, first, last) ||
+        ((symbol != token::symbol::begin_array) && (symbol != token::symbol::begin_object)))
+    {
+        // Pass through unselected values
+        const auto literal = partial::skip(reader, mode, ec);
+        if (ec)
+            return;
+        writer.literal_value(literal);
+        return;
+    }
+
+    if (symbol == token::symbol::begin_array)
+        writer.template value<token::begin_array>();
+    else
+        writer.template value<token::begin_object>();
+
+    std::basic_string<CharT> buffer;
+    size_type index = 0;
+    reader.next();
+    while (true)
+    {
+        switch (reader.symbol())
+        {
+        case token::symbol::end_array:
+        case token::symbol::end_object:
+            break;
+
+        case token::symbol::end:
+            ec = make_error_code(insufficient_tokens);
+            return;
+
+        case token::symbol::error:
+            ec = reader.error();
+            return;
+
+        default:
+            if (symbol == token::symbol::begin_object)
+            {
+                const view_type key = trie_type::key(reader, buffer);
+                for (size_type i = first; i < last; ++i)
+                {
+                    trie.select(active[i], key, trie_type::npos, active);
+                }
+                // Erased members are skipped before their key is written
+                const size_type member_rule = find(active, last, active.size());
+                const bool erased = (member_rule != trie_type::npos) && !callbacks[member_rule];
+                if (!erased)
+                {
+                    writer.literal_value(reader.literal());
+                }
+                if (!reader.next())
+                {
+                    ec = reader.error() ? reader.error() : make_error_code(insufficient_tokens);
+                    return;
+                }
+                if (erased)
+                {
+                    active.resize(last);
+                    partial::skip(reader, mode, ec);
+                    if (ec)
+                        return;
+                    continue;
+                }
+            }
+            else
+            {
+                for (size_type i = first; i < last; ++i)
+                {
+                    trie.select(active[i], view_type(), index, active);
+                }
+                ++index;
+            }
+
+            if (active.size() > last)
+            {
+                visit(reader, writer, active, last, ec);
+                active.resize(last);
+            }
+            else
+            {
+                const auto literal = partial::skip(reader, mode, ec);
+                if (!ec)
+                {
+                    writer.literal_value(literal);
+                }
+            }
+            if (ec)
+                return;
+            continue;
+        }
+        break;
+    }
+
+    if (symbol == token::symbol::begin_array)
+        writer.template value<token::end_array>();
+    else
+        writer.template value<token::end_object>();
+    if (!reader.next())
+        ec = reader.error();
+}
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_FILTER_IPP
@@ -16,6 +16,7 @@
 #include <trial/protocol/json/error.hpp>
 #include <trial/protocol/json/reader.hpp>
 #include <trial/protocol/json/detail/compact.hpp>
+#include <trial/dynamic/string_pool.hpp>
 
 namespace trial
 {
@@ -31,9 +32,11 @@ class basic_parser
 {
 public:
     using variable_type = dynamic::basic_variable<Allocator>;
+    using pool_type = dynamic::basic_string_pool<Allocator>;
 
-    basic_parser(basic_reader<CharT>& reader)
-        : reader(reader)
+    basic_parser(basic_reader<CharT>& reader, pool_type *pool = nullptr)
+        : reader(reader),
+          pool(pool)
     {}
 
     // Parse outer scope
@@ -121,19 +124,14 @@ private:
         while (reader.next())
         {
             // Key
-            std::string key;
-            key.reserve(reader.literal().size());
+            variable_type key;
             switch (reader.symbol())
             {
             case token::symbol::end_object:
                 return scope;
             case token::symbol::string:
-            {
-                const auto err = reader.value(key);
-                if (err != json::no_error)
-                    throw json::error(make_error_code(err));
+                key = parse_key();
                 break;
-            }
             default:
                 throw json::error(make_error_code(json::invalid_key));
             }
@@ -174,6 +172,28 @@ private:
         return scope;
     }
 
+    variable_type parse_key()
+    {
+        assert(reader.symbol() == token::symbol::string);
+
+        if (pool)
+        {
+            // Decode into reusable buffer and share the pooled key
+            buffer.clear();
+            const auto err = reader.value(buffer);
+            if (err != json::no_error)
+                throw json::error(make_error_code(err));
+            return pool->intern(buffer);
+        }
+
+        std::string key;
+        key.reserve(reader.literal().size());
+        const auto err = reader.value(key);
+        if (err != json::no_error)
+            throw json::error(make_error_code(err));
+        return key;
+    }
+
     variable_type parse_value()
     {
         switch (reader.symbol())
@@ -213,6 +233,8 @@ private:
     }
 
     json::basic_reader<CharT>& reader;
+    pool_type *pool;
+    std::string buffer;
 };
 
 } // namespace detail
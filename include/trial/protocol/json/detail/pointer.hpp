@@ -0,0 +1,215 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_POINTER_HPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_POINTER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <string>
+#include <vector>
+#include <trial/protocol/json/error.hpp>
+#include <trial/protocol/json/reader.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace detail
+{
+
+// Trie of JSON Pointer paths.
+//
+// Each node corresponds to a path prefix. A set of active nodes is matched
+// against the current position in the input. Nodes that match nested values
+// are appended to the active set by select().
+
+template <typename CharT>
+class basic_pointer_trie
+{
+public:
+    using size_type = std::size_t;
+    using view_type = typename basic_reader<CharT>::view_type;
+    using string_type = std::basic_string<CharT>;
+
+    static const size_type npos = size_type(-1);
+
+    basic_pointer_trie()
+        : nodes(1)
+    {
+    }
+
+    // Returns the node of the path
+    size_type insert(const view_type& path)
+    {
+        size_type current = 0;
+        if (path.empty())
+            return current;
+
+        if (path.front() != CharT('/'))
+            throw json::error(invalid_key);
+
+        string_type key;
+        for (auto it = path.begin() + 1; ; ++it)
+        {
+            if ((it == path.end()) || (*it == CharT('/')))
+            {
+                if (key.size() == 1 && key.front() == CharT('*'))
+                {
+                    if (nodes[current].wildcard == npos)
+                    {
+                        nodes[current].wildcard = nodes.size();
+                        nodes.emplace_back();
+                    }
+                    current = nodes[current].wildcard;
+                }
+                else
+                {
+                    current = make_child(current, key);
+                }
+                if (it == path.end())
+                    break;
+                key.clear();
+            }
+            else if (*it == CharT('~'))
+            {
+                // Escaped reference token characters
+                if (++it == path.end())
+                    throw json::error(invalid_key);
+                if (*it == CharT('0'))
+                    key += CharT('~');
+                else if (*it == CharT('1'))
+                    key += CharT('/');
+                else
+                    throw json::error(invalid_key);
+            }
+            else
+            {
+                key += *it;
+            }
+        }
+        return current;
+    }
+
+    // Returns the number of nodes
+    size_type size() const noexcept
+    {
+        return nodes.size();
+    }
+
+    // Returns true if any active node has nested paths
+    bool descend(const std::vector<size_type>& active,
+                 size_type first,
+                 size_type last) const noexcept
+    {
+        for (size_type i = first; i < last; ++i)
+        {
+            const node& current = nodes[active[i]];
+            if (!current.children.empty() || (current.wildcard != npos))
+                return true;
+        }
+        return false;
+    }
+
+    // Appends the children of parent that match an object key, or an array
+    // index if key is empty
+    void select(size_type parent,
+                const view_type& key,
+                size_type index,
+                std::vector<size_type>& active) const
+    {
+        const node& current = nodes[parent];
+        for (const auto& entry : current.children)
+        {
+            const bool found = (index == npos)
+                ? (view_type(entry.key.data(), entry.key.size()) == key)
+                : (entry.index == index);
+            if (found)
+            {
+                active.push_back(entry.node);
+            }
+        }
+        if (current.wildcard != npos)
+        {
+            active.push_back(current.wildcard);
+        }
+    }
+
+    // Returns the current object key without conversion unless it is escaped
+    static view_type key(const basic_reader<CharT>& reader, string_type& buffer)
+    {
+        view_type result = reader.literal();
+        result = result.substr(1, result.size() - 2);
+        if (result.find(CharT('\\')) != view_type::npos)
+        {
+            buffer = reader.template value<string_type>();
+            result = view_type(buffer.data(), buffer.size());
+        }
+        return result;
+    }
+
+private:
+    size_type make_child(size_type parent, const string_type& key)
+    {
+        for (const auto& entry : nodes[parent].children)
+        {
+            if (entry.key == key)
+                return entry.node;
+        }
+
+        // Reference tokens without leading zeros are also array indices
+        size_type index = npos;
+        if (!key.empty() && (key.size() < 19) && (key.size() == 1 || key.front() != CharT('0')))
+        {
+            index = 0;
+            for (auto character : key)
+            {
+                if (character < CharT('0') || character > CharT('9'))
+                {
+                    index = npos;
+                    break;
+                }
+                index = index * 10 + (character - CharT('0'));
+            }
+        }
+
+        const size_type result = nodes.size();
+        nodes[parent].children.push_back({ key, index, result });
+        nodes.emplace_back();
+        return result;
+    }
+
+private:
+    struct child
+    {
+        string_type key;
+        size_type index;
+        size_type node;
+    };
+
+    struct node
+    {
+        std::vector<child> children;
+        size_type wildcard = npos;
+    };
+
+    std::vector<node> nodes;
+};
+
+template <typename CharT>
+const typename basic_pointer_trie<CharT>::size_type basic_pointer_trie<CharT>::npos;
+
+} // namespace detail
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_POINTER_HPP
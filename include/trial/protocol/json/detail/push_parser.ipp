@@ -0,0 +1,401 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_PUSH_PARSER_IPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_PUSH_PARSER_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <functional> // std::less
+#include <trial/protocol/core/detail/config.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+template <typename Derived, typename CharT>
+bool basic_push_parser<Derived, CharT>::parse(const view_type& chunk)
+{
+    if (current == state::halt)
+        return false;
+
+    const value_type *first = chunk.data();
+    const value_type *last = first + chunk.size();
+    if (buffer.empty())
+    {
+        // Parse directly from the chunk and only copy the incomplete tail
+        const value_type *rest = consume(first, last, false);
+        if (current != state::halt)
+        {
+            buffer.assign(rest, last);
+        }
+    }
+    else
+    {
+        buffer.append(first, chunk.size());
+        const value_type *rest = consume(buffer.data(), buffer.data() + buffer.size(), false);
+        if (current != state::halt)
+        {
+            buffer.erase(0, std::distance<const value_type *>(buffer.data(), rest));
+        }
+    }
+    return current != state::halt;
+}
+
+template <typename Derived, typename CharT>
+bool basic_push_parser<Derived, CharT>::finish()
+{
+    if (current == state::halt)
+        return false;
+
+    consume(buffer.data(), buffer.data() + buffer.size(), true);
+    buffer.clear();
+    switch (current)
+    {
+    case state::halt:
+        return false;
+
+    case state::done:
+        return true;
+
+    default:
+        return fail(json::insufficient_tokens);
+    }
+}
+
+template <typename Derived, typename CharT>
+void basic_push_parser<Derived, CharT>::reset()
+{
+    current = state::outer;
+    stack.clear();
+    status = json::no_error;
+    buffer.clear();
+}
+
+template <typename Derived, typename CharT>
+bool basic_push_parser<Derived, CharT>::aborted() const noexcept
+{
+    return (current == state::halt) && (status == json::no_error);
+}
+
+template <typename Derived, typename CharT>
+std::error_code basic_push_parser<Derived, CharT>::error() const noexcept
+{
+    return json::make_error_code(status);
+}
+
+template <typename Derived, typename CharT>
+auto basic_push_parser<Derived, CharT>::level() const noexcept -> size_type
+{
+    return stack.size();
+}
+
+template <typename Derived, typename CharT>
+Derived& basic_push_parser<Derived, CharT>::derived() noexcept
+{
+    return *static_cast<Derived *>(this);
+}
+
+template <typename Derived, typename CharT>
+auto basic_push_parser<Derived, CharT>::after_value() const noexcept -> state
+{
+    return stack.empty() ? state::done : stack.back();
+}
+
+// Returns the beginning of the unconsumed input
+
+template <typename Derived, typename CharT>
+auto basic_push_parser<Derived, CharT>::consume(const value_type *first,
+                                                const value_type *last,
+                                                bool final) -> const value_type *
+{
+    if (first == last)
+        return last;
+
+    // Position where the decoder started searching for the current token
+    const value_type *mark = first;
+    decoder_type decoder(first, last);
+    while (true)
+    {
+        const auto code = decoder.code();
+        if (TRIAL_UNLIKELY((code <= token::code::end) || decoder.tail().empty()))
+        {
+            if (!final && decoder.partial(mark))
+                return decoder.literal().data();
+
+            if (code == token::code::end)
+            {
+                // Number without digits after sign, dot, or exponent
+                if (!std::less<const value_type *>()(decoder.literal().data(), mark))
+                {
+                    fail(token::code::error_unexpected_token);
+                }
+                return last;
+            }
+        }
+
+        bool proceed = false;
+        switch (current)
+        {
+        case state::outer:
+        case state::array_value:
+        case state::object_value:
+            proceed = value(decoder);
+            break;
+
+        case state::array_first:
+            switch (code)
+            {
+            case token::code::end_array:
+                proceed = end_array();
+                break;
+
+            case token::code::end_object:
+                proceed = fail(token::code::error_expected_end_array);
+                break;
+
+            default:
+                proceed = value(decoder);
+                break;
+            }
+            break;
+
+        case state::array_next:
+            switch (code)
+            {
+            case token::code::error_value_separator:
+                current = state::array_value;
+                proceed = true;
+                break;
+
+            case token::code::end_array:
+                proceed = end_array();
+                break;
+
+            default:
+                proceed = fail((code < 0) ? code : token::code::error_expected_end_array);
+                break;
+            }
+            break;
+
+        case state::object_first:
+        case state::object_key:
+            switch (code)
+            {
+            case token::code::string:
+                current = state::object_colon;
+                proceed = string(decoder, true);
+                break;
+
+            case token::code::end_object:
+                // Prohibit trailing separator
+                proceed = (current == state::object_first)
+                    ? end_object()
+                    : fail(token::code::error_unexpected_token);
+                break;
+
+            case token::code::end_array:
+                proceed = fail((current == state::object_first)
+                               ? token::code::error_expected_end_object
+                               : token::code::error_unexpected_token);
+                break;
+
+            case token::code::error_value_separator:
+            case token::code::error_name_separator:
+                proceed = fail(token::code::error_unexpected_token);
+                break;
+
+            default:
+                // Key must be string type
+                proceed = fail((code < 0) ? code : token::code::error_invalid_key);
+                break;
+            }
+            break;
+
+        case state::object_colon:
+            if (code == token::code::error_name_separator)
+            {
+                current = state::object_value;
+                proceed = true;
+            }
+            else
+            {
+                proceed = fail((code < 0) ? code : token::code::error_unexpected_token);
+            }
+            break;
+
+        case state::object_next:
+            switch (code)
+            {
+            case token::code::error_value_separator:
+                current = state::object_key;
+                proceed = true;
+                break;
+
+            case token::code::end_object:
+                proceed = end_object();
+                break;
+
+            default:
+                proceed = fail((code < 0) ? code : token::code::error_expected_end_object);
+                break;
+            }
+            break;
+
+        case state::done:
+            // Only accept one value in the outer scope
+            proceed = fail((code < 0) ? code : token::code::error_unexpected_token);
+            break;
+
+        case state::halt:
+            break;
+        }
+        if (!proceed)
+            return last;
+
+        mark = decoder.tail().data();
+        decoder.assume_next();
+    }
+}
+
+template <typename Derived, typename CharT>
+bool basic_push_parser<Derived, CharT>::value(const decoder_type& decoder)
+{
+    const auto code = decoder.code();
+    switch (code)
+    {
+    case token::code::null:
+        current = after_value();
+        return derived().on_null() || abort();
+
+    case token::code::true_value:
+        current = after_value();
+        return derived().on_boolean(true) || abort();
+
+    case token::code::false_value:
+        current = after_value();
+        return derived().on_boolean(false) || abort();
+
+    case token::code::integer:
+        {
+            current = after_value();
+            std::intmax_t number = 0;
+            if (decoder.signed_value(number) == json::no_error)
+                return derived().on_integer(number) || abort();
+
+            // Out of range for signed integers
+            std::uintmax_t unsigned_number = 0;
+            if (decoder.unsigned_value(unsigned_number) == json::no_error)
+                return derived().on_unsigned_integer(unsigned_number) || abort();
+
+            double real_number = 0.0;
+            decoder.real_value(real_number);
+            return derived().on_real(real_number) || abort();
+        }
+
+    case token::code::real:
+        {
+            double number = 0.0;
+            decoder.real_value(number);
+            current = after_value();
+            return derived().on_real(number) || abort();
+        }
+
+    case token::code::string:
+        current = after_value();
+        return string(decoder, false);
+
+    case token::code::begin_array:
+        stack.push_back(state::array_next);
+        current = state::array_first;
+        return derived().on_begin_array() || abort();
+
+    case token::code::begin_object:
+        stack.push_back(state::object_next);
+        current = state::object_first;
+        return derived().on_begin_object() || abort();
+
+    case token::code::end_array:
+        return fail((current == state::outer)
+                    ? token::code::error_unbalanced_end_array
+                    : token::code::error_unexpected_token);
+
+    case token::code::end_object:
+        return fail((current == state::outer)
+                    ? token::code::error_unbalanced_end_object
+                    : token::code::error_unexpected_token);
+
+    default:
+        return fail((code < 0) ? code : token::code::error_unexpected_token);
+    }
+}
+
+template <typename Derived, typename CharT>
+bool basic_push_parser<Derived, CharT>::string(const decoder_type& decoder,
+                                               bool is_key)
+{
+    // Strings without escapes are passed directly from the input
+    const auto& literal = decoder.literal();
+    view_type result(literal.data() + 1, literal.size() - 2);
+    if (decoder.has_escape())
+    {
+        scratch.clear();
+        decoder.string_value(scratch);
+        result = view_type(scratch.data(), scratch.size());
+    }
+    const bool proceed = is_key
+        ? derived().on_key(result)
+        : derived().on_string(result);
+    return proceed || abort();
+}
+
+template <typename Derived, typename CharT>
+bool basic_push_parser<Derived, CharT>::end_array()
+{
+    stack.pop_back();
+    current = after_value();
+    return derived().on_end_array() || abort();
+}
+
+template <typename Derived, typename CharT>
+bool basic_push_parser<Derived, CharT>::end_object()
+{
+    stack.pop_back();
+    current = after_value();
+    return derived().on_end_object() || abort();
+}
+
+template <typename Derived, typename CharT>
+bool basic_push_parser<Derived, CharT>::fail(token::code::value code)
+{
+    return fail(to_errc(code));
+}
+
+template <typename Derived, typename CharT>
+bool basic_push_parser<Derived, CharT>::fail(json::errc errc)
+{
+    status = errc;
+    current = state::halt;
+    return false;
+}
+
+template <typename Derived, typename CharT>
+bool basic_push_parser<Derived, CharT>::abort()
+{
+    current = state::halt;
+    return false;
+}
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_PUSH_PARSER_IPP
@@ -0,0 +1,206 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_QUERY_IPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_QUERY_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+//-----------------------------------------------------------------------------
+// basic_query::match
+//-----------------------------------------------------------------------------
+
+template <typename CharT>
+template <typename ReturnType>
+ReturnType basic_query<CharT>::match::value() const
+{
+    reader_type reader(literal);
+    return reader.template value<ReturnType>();
+}
+
+//-----------------------------------------------------------------------------
+// basic_query
+//-----------------------------------------------------------------------------
+
+template <typename CharT>
+basic_query<CharT>::basic_query()
+    : paths(1)
+{
+}
+
+template <typename CharT>
+basic_query<CharT>::basic_query(std::initializer_list<view_type> paths)
+    : basic_query()
+{
+    for (const auto& path : paths)
+    {
+        insert(path);
+    }
+}
+
+template <typename CharT>
+auto basic_query<CharT>::insert(const view_type& path) -> size_type
+{
+    const size_type node = trie.insert(path);
+    paths.resize(trie.size());
+    paths[node].push_back(count);
+    return count++;
+}
+
+template <typename CharT>
+void basic_query<CharT>::relaxed(bool enable) noexcept
+{
+    mode = enable ? partial::skip_mode::relaxed : partial::skip_mode::strict;
+}
+
+template <typename CharT>
+auto basic_query<CharT>::size() const noexcept -> size_type
+{
+    return count;
+}
+
+template <typename CharT>
+template <typename Callback>
+void basic_query<CharT>::evaluate(reader_type& reader,
+                                  Callback&& callback,
+                                  std::error_code& ec) const
+{
+    std::vector<size_type> active;
+    active.push_back(0);
+    visit(reader, active, 0, callback, ec);
+}
+
+template <typename CharT>
+template <typename Callback>
+void basic_query<CharT>::evaluate(reader_type& reader,
+                                  Callback&& callback) const
+{
+    std::error_code ec;
+    evaluate(reader, std::forward<Callback>(callback), ec);
+    if (ec)
+        throw json::error(ec);
+}
+
+template <typename CharT>
+auto basic_query<CharT>::evaluate(const view_type& input) const -> std::vector<match>
+{
+    std::vector<match> result;
+    reader_type reader(input);
+    evaluate(reader, [&result] (const match& entry) { result.push_back(entry); });
+    return result;
+}
+
+// The nodes that match the current value are active[first..]. Nodes that
+// match nested values are appended to active while they are visited.
+
+template <typename CharT>
+template <typename Callback>
+void basic_query<CharT>::visit(reader_type& reader,
+                               std::vector<size_type>& active,
+                               size_type first,
+                               Callback& callback,
+                               std::error_code& ec) const
+{
+    const size_type last = active.size();
+
+    const bool descend = trie.descend(active, first, last);
+    const auto symbol = reader.symbol();
+    view_type literal;
+    if (descend &&
+        ((symbol == token::symbol::begin_array) || (symbol == token::symbol::begin_object)))
+    {
+        const CharT * const head = reader.literal().data();
+        std::basic_string<CharT> buffer;
+        size_type index = 0;
+        reader.next();
+        while (true)
+        {
+            switch (reader.symbol())
+            {
+            case token::symbol::end_array:
+            case token::symbol::end_object:
+                break;
+
+            case token::symbol::end:
+                ec = make_error_code(insufficient_tokens);
+                return;
+
+            case token::symbol::error:
+                ec = reader.error();
+                return;
+
+            default:
+                if (symbol == token::symbol::begin_object)
+                {
+                    const view_type key = trie_type::key(reader, buffer);
+                    for (size_type i = first; i < last; ++i)
+                    {
+                        trie.select(active[i], key, trie_type::npos, active);
+                    }
+                    if (!reader.next())
+                    {
+                        ec = reader.error() ? reader.error() : make_error_code(insufficient_tokens);
+                        return;
+                    }
+                }
+                else
+                {
+                    for (size_type i = first; i < last; ++i)
+                    {
+                        trie.select(active[i], view_type(), index, active);
+                    }
+                    ++index;
+                }
+
+                if (active.size() > last)
+                {
+                    visit(reader, active, last, callback, ec);
+                    active.resize(last);
+                }
+                else
+                {
+                    partial::skip(reader, mode, ec);
+                }
+                if (ec)
+                    return;
+                continue;
+            }
+            break;
+        }
+        literal = view_type(head, std::distance(head, reader.literal().end()));
+        if (!reader.next())
+            ec = reader.error();
+    }
+    else
+    {
+        literal = partial::skip(reader, mode, ec);
+    }
+    if (ec)
+        return;
+
+    for (size_type i = first; i < last; ++i)
+    {
+        for (auto path : paths[active[i]])
+        {
+            callback(match{ path, literal });
+        }
+    }
+}
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_QUERY_IPP
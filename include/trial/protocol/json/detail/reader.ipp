@@ -12,6 +12,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <cmath>
+#include <iterator>
 #include <type_traits>
 #include <trial/protocol/core/detail/config.hpp>
 #include <trial/protocol/core/detail/type_traits.hpp>
@@ -27,28 +28,28 @@ namespace json
 // reader::overloader
 //-----------------------------------------------------------------------------
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename ReturnType, typename Enable>
-struct basic_reader<CharT>::overloader
+struct basic_reader<CharT, Mode>::overloader
 {
 };
 
 // Booleans
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename ReturnType>
-struct basic_reader<CharT>::overloader<
+struct basic_reader<CharT, Mode>::overloader<
     ReturnType,
     typename std::enable_if<core::detail::is_bool<ReturnType>::value>::type>
 {
-    inline static ReturnType value(const basic_reader<CharT>& self)
+    inline static ReturnType value(const basic_reader<CharT, Mode>& self)
     {
         ReturnType result;
         throw_on_error(value(self, result));
         return result;
     }
 
-    inline static json::errc value(const basic_reader<CharT>& self,
+    inline static json::errc value(const basic_reader<CharT, Mode>& self,
                                    ReturnType& output) noexcept
     {
         switch (self.decoder.code())
@@ -69,22 +70,22 @@ struct basic_reader<CharT>::overloader<
 
 // Signed integers
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename ReturnType>
-struct basic_reader<CharT>::overloader<
+struct basic_reader<CharT, Mode>::overloader<
     ReturnType,
     typename std::enable_if<std::is_integral<ReturnType>::value &&
                             std::is_signed<ReturnType>::value &&
                             !core::detail::is_bool<ReturnType>::value>::type>
 {
-    inline static ReturnType value(const basic_reader<CharT>& self)
+    inline static ReturnType value(const basic_reader<CharT, Mode>& self)
     {
         ReturnType result;
         throw_on_error(value(self, result));
         return result;
     }
 
-    inline static json::errc value(const basic_reader<CharT>& self,
+    inline static json::errc value(const basic_reader<CharT, Mode>& self,
                                    ReturnType& output) noexcept
     {
         switch (self.decoder.code())
@@ -109,22 +110,22 @@ struct basic_reader<CharT>::overloader<
 
 // Unsigned integers
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename ReturnType>
-struct basic_reader<CharT>::overloader<
+struct basic_reader<CharT, Mode>::overloader<
     ReturnType,
     typename std::enable_if<std::is_integral<ReturnType>::value &&
                             std::is_unsigned<ReturnType>::value &&
                             !core::detail::is_bool<ReturnType>::value>::type>
 {
-    inline static ReturnType value(const basic_reader<CharT>& self)
+    inline static ReturnType value(const basic_reader<CharT, Mode>& self)
     {
         ReturnType result;
         throw_on_error(value(self, result));
         return result;
     }
 
-    inline static json::errc value(const basic_reader<CharT>& self,
+    inline static json::errc value(const basic_reader<CharT, Mode>& self,
                                    ReturnType& output) noexcept
     {
         switch (self.decoder.code())
@@ -149,20 +150,20 @@ struct basic_reader<CharT>::overloader<
 
 // Floating-point numbers
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename ReturnType>
-struct basic_reader<CharT>::overloader<
+struct basic_reader<CharT, Mode>::overloader<
     ReturnType,
     typename std::enable_if<std::is_floating_point<ReturnType>::value>::type>
 {
-    inline static ReturnType value(const basic_reader<CharT>& self)
+    inline static ReturnType value(const basic_reader<CharT, Mode>& self)
     {
         ReturnType result;
         throw_on_error(value(self, result));
         return result;
     }
 
-    inline static json::errc value(const basic_reader<CharT>& self,
+    inline static json::errc value(const basic_reader<CharT, Mode>& self,
                                    ReturnType& output) noexcept
     {
         switch (self.decoder.code())
@@ -190,21 +191,21 @@ struct basic_reader<CharT>::overloader<
 
 // Strings
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename CharTraits, typename Allocator>
-struct basic_reader<CharT>::overloader<
+struct basic_reader<CharT, Mode>::overloader<
     std::basic_string<CharT, CharTraits, Allocator>>
 {
     using return_type = std::basic_string<CharT, CharTraits, Allocator>;
 
-    inline static return_type value(const basic_reader<CharT>& self)
+    inline static return_type value(const basic_reader<CharT, Mode>& self)
     {
         return_type result;
         throw_on_error(value(self, result));
         return result;
     }
 
-    inline static json::errc value(const basic_reader<CharT>& self,
+    inline static json::errc value(const basic_reader<CharT, Mode>& self,
                                    return_type& output) noexcept
     {
         if (self.decoder.code() == token::code::string)
@@ -220,14 +221,14 @@ struct basic_reader<CharT>::overloader<
 // basic_reader
 //-----------------------------------------------------------------------------
 
-template <typename CharT>
-basic_reader<CharT>::basic_reader()
+template <typename CharT, json::validation Mode>
+basic_reader<CharT, Mode>::basic_reader()
 {
     stack.push(token::null{});
 }
 
-template <typename CharT>
-basic_reader<CharT>::basic_reader(const view_type& input)
+template <typename CharT, json::validation Mode>
+basic_reader<CharT, Mode>::basic_reader(const view_type& input)
     : decoder(input.begin(), input.end())
 {
     stack.push(token::null{});
@@ -254,39 +255,39 @@ basic_reader<CharT>::basic_reader(const view_type& input)
     }
 }
 
-template <typename CharT>
-auto basic_reader<CharT>::level() const noexcept -> size_type
+template <typename CharT, json::validation Mode>
+auto basic_reader<CharT, Mode>::level() const noexcept -> size_type
 {
     assert(stack.size() > 0);
     return stack.size() - 1;
 }
 
-template <typename CharT>
-token::code::value basic_reader<CharT>::code() const noexcept
+template <typename CharT, json::validation Mode>
+token::code::value basic_reader<CharT, Mode>::code() const noexcept
 {
     return decoder.code();
 }
 
-template <typename CharT>
-token::symbol::value basic_reader<CharT>::symbol() const noexcept
+template <typename CharT, json::validation Mode>
+token::symbol::value basic_reader<CharT, Mode>::symbol() const noexcept
 {
     return token::symbol::convert(code());
 }
 
-template <typename CharT>
-token::category::value basic_reader<CharT>::category() const noexcept
+template <typename CharT, json::validation Mode>
+token::category::value basic_reader<CharT, Mode>::category() const noexcept
 {
     return token::category::convert(code());
 }
 
-template <typename CharT>
-std::error_code basic_reader<CharT>::error() const noexcept
+template <typename CharT, json::validation Mode>
+std::error_code basic_reader<CharT, Mode>::error() const noexcept
 {
     return decoder.error();
 }
 
-template <typename CharT>
-bool basic_reader<CharT>::next()
+template <typename CharT, json::validation Mode>
+bool basic_reader<CharT, Mode>::next()
 {
     auto& frame = stack.top();
     const auto ret = (frame.*frame.next)(decoder);
@@ -315,8 +316,8 @@ bool basic_reader<CharT>::next()
     return code() >= token::code::null;
 }
 
-template <typename CharT>
-bool basic_reader<CharT>::next(token::code::value expect)
+template <typename CharT, json::validation Mode>
+bool basic_reader<CharT, Mode>::next(token::code::value expect)
 {
     const token::code::value current = code();
     if (current != expect)
@@ -327,32 +328,167 @@ bool basic_reader<CharT>::next(token::code::value expect)
     return next();
 }
 
-template <typename CharT>
-bool basic_reader<CharT>::next(const view_type& view)
+template <typename CharT, json::validation Mode>
+bool basic_reader<CharT, Mode>::next_end()
+{
+    const token::code::value current = code();
+    switch (current)
+    {
+    case token::code::begin_array:
+    case token::code::begin_object:
+        break;
+
+    default:
+        decoder.code(token::code::error_unexpected_token);
+        return false;
+    }
+
+    if (!decoder.skip_container())
+    {
+        decoder.code((current == token::code::begin_array)
+                     ? token::code::error_expected_end_array
+                     : token::code::error_expected_end_object);
+        return false;
+    }
+    // The frame of the container parses the end bracket
+    return next();
+}
+
+template <typename CharT, json::validation Mode>
+bool basic_reader<CharT, Mode>::next_sibling()
+{
+    switch (code())
+    {
+    case token::code::begin_array:
+    case token::code::begin_object:
+        if (!next_end())
+            return false;
+        return next();
+
+    default:
+        return next();
+    }
+}
+
+template <typename CharT, json::validation Mode>
+bool basic_reader<CharT, Mode>::next(const view_type& view)
 {
     decoder = decoder_type(view.data(), view.size());
     return (category() != token::category::status);
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename T>
-T basic_reader<CharT>::value() const
+T basic_reader<CharT, Mode>::value() const
 {
     using return_type = typename std::remove_cv<typename std::decay<T>::type>::type;
-    return basic_reader<CharT>::overloader<return_type>::value(*this);
+    return basic_reader<CharT, Mode>::overloader<return_type>::value(*this);
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
 template <typename T>
-auto basic_reader<CharT>::value(T& output) const noexcept -> json::errc
+auto basic_reader<CharT, Mode>::value(T& output) const noexcept -> json::errc
 {
     using return_type = typename std::remove_cv<typename std::decay<T>::type>::type;
-    return basic_reader<CharT>::overloader<return_type>::value(*this, output);
+    return basic_reader<CharT, Mode>::overloader<return_type>::value(*this, output);
+}
+
+template <typename CharT, json::validation Mode>
+template <typename T, typename OutputIterator>
+auto basic_reader<CharT, Mode>::values(OutputIterator output) -> json::errc
+{
+    using value_type = typename std::remove_cv<typename std::decay<T>::type>::type;
+
+    if (decoder.code() != token::code::begin_array)
+        return json::incompatible_type;
+
+    // Elements are parsed directly with the decoder until the end of the
+    // array. The frame of the array is updated on errors, so the reader can
+    // resume from the current element.
+    decoder.next();
+    if (decoder.code() != token::code::end_array)
+    {
+        while (true)
+        {
+            switch (decoder.code())
+            {
+            case token::code::end:
+                decoder.code(token::code::error_expected_end_array);
+                return to_errc(decoder.code());
+
+            case token::code::end_object:
+                decoder.code(token::code::error_expected_end_array);
+                return to_errc(decoder.code());
+
+            default:
+                if (decoder.code() < 0)
+                    return to_errc(decoder.code());
+                break;
+            }
+
+            value_type element;
+            const auto result = basic_reader<CharT, Mode>::overloader<value_type>::value(*this, element);
+            if (result != json::no_error)
+            {
+                stack.top().resume_array();
+                switch (decoder.code())
+                {
+                case token::code::begin_array:
+                    stack.push(token::begin_array{});
+                    break;
+
+                case token::code::begin_object:
+                    stack.push(token::begin_object{});
+                    break;
+
+                default:
+                    break;
+                }
+                return result;
+            }
+            *output++ = std::move(element);
+
+            decoder.next();
+            if (TRIAL_LIKELY(decoder.code() == token::code::error_value_separator))
+            {
+                decoder.assume_next();
+                // Prohibit trailing separator
+                if (decoder.code() == token::code::end_array)
+                {
+                    decoder.code(token::code::error_unexpected_token);
+                    return to_errc(decoder.code());
+                }
+            }
+            else if (decoder.code() == token::code::end_array)
+            {
+                break;
+            }
+            else
+            {
+                if (decoder.code() >= 0)
+                {
+                    decoder.code(token::code::error_expected_end_array);
+                }
+                return to_errc(decoder.code());
+            }
+        }
+    }
+    // Skip over end_array
+    stack.pop();
+    next();
+    return json::no_error;
 }
 
-template <typename CharT>
+template <typename CharT, json::validation Mode>
+template <typename T, typename Allocator>
+auto basic_reader<CharT, Mode>::values(std::vector<T, Allocator>& output) -> json::errc
+{
+    return values<T>(std::back_inserter(output));
+}
+
+template <typename CharT, json::validation Mode>
 template <typename Collector>
-auto basic_reader<CharT>::string(Collector& collector) const noexcept -> json::errc
+auto basic_reader<CharT, Mode>::string(Collector& collector) const noexcept -> json::errc
 {
     if (decoder.code() == token::code::string)
     {
@@ -362,14 +498,14 @@ auto basic_reader<CharT>::string(Collector& collector) const noexcept -> json::e
     return errc::incompatible_type;
 }
 
-template <typename CharT>
-auto basic_reader<CharT>::literal() const noexcept -> view_type
+template <typename CharT, json::validation Mode>
+auto basic_reader<CharT, Mode>::literal() const noexcept -> view_type
 {
     return view_type(decoder.literal().data(), decoder.literal().size());
 }
 
-template <typename CharT>
-auto basic_reader<CharT>::tail() const noexcept -> view_type
+template <typename CharT, json::validation Mode>
+auto basic_reader<CharT, Mode>::tail() const noexcept -> view_type
 {
     return view_type(decoder.tail().data(), decoder.tail().size());
 }
@@ -378,26 +514,32 @@ auto basic_reader<CharT>::tail() const noexcept -> view_type
 // reader::frame
 //-----------------------------------------------------------------------------
 
-template <typename CharT>
-basic_reader<CharT>::frame::frame(token::null) noexcept
+template <typename CharT, json::validation Mode>
+basic_reader<CharT, Mode>::frame::frame(token::null) noexcept
     : next(&frame::next_outer)
 {
 }
 
-template <typename CharT>
-basic_reader<CharT>::frame::frame(token::begin_array) noexcept
+template <typename CharT, json::validation Mode>
+basic_reader<CharT, Mode>::frame::frame(token::begin_array) noexcept
     : next(&frame::next_array)
 {
 }
 
-template <typename CharT>
-basic_reader<CharT>::frame::frame(token::begin_object) noexcept
+template <typename CharT, json::validation Mode>
+basic_reader<CharT, Mode>::frame::frame(token::begin_object) noexcept
     : next(&frame::next_object)
 {
 }
 
-template <typename CharT>
-token::code::value basic_reader<CharT>::frame::next_outer(decoder_type& decoder) noexcept
+template <typename CharT, json::validation Mode>
+void basic_reader<CharT, Mode>::frame::resume_array() noexcept
+{
+    next = &frame::next_array_value;
+}
+
+template <typename CharT, json::validation Mode>
+token::code::value basic_reader<CharT, Mode>::frame::next_outer(decoder_type& decoder) noexcept
 {
     // RFC 8259, section 2
     //
@@ -423,8 +565,8 @@ token::code::value basic_reader<CharT>::frame::next_outer(decoder_type& decoder)
     }
 }
 
-template <typename CharT>
-token::code::value basic_reader<CharT>::frame::next_array(decoder_type& decoder) noexcept
+template <typename CharT, json::validation Mode>
+token::code::value basic_reader<CharT, Mode>::frame::next_array(decoder_type& decoder) noexcept
 {
     // RFC 8259, section 5
     //
@@ -446,8 +588,8 @@ token::code::value basic_reader<CharT>::frame::next_array(decoder_type& decoder)
     }
 }
 
-template <typename CharT>
-token::code::value basic_reader<CharT>::frame::next_array_value(decoder_type& decoder) noexcept
+template <typename CharT, json::validation Mode>
+token::code::value basic_reader<CharT, Mode>::frame::next_array_value(decoder_type& decoder) noexcept
 {
     decoder.next();
     const token::code::value current = decoder.code();
@@ -467,8 +609,8 @@ token::code::value basic_reader<CharT>::frame::next_array_value(decoder_type& de
     return token::code::error_expected_end_array;
 }
 
-template <typename CharT>
-token::code::value basic_reader<CharT>::frame::next_object(decoder_type& decoder) noexcept
+template <typename CharT, json::validation Mode>
+token::code::value basic_reader<CharT, Mode>::frame::next_object(decoder_type& decoder) noexcept
 {
     // RFC 8259, section 4
     //
@@ -500,8 +642,8 @@ token::code::value basic_reader<CharT>::frame::next_object(decoder_type& decoder
     }
 }
 
-template <typename CharT>
-token::code::value basic_reader<CharT>::frame::next_object_key(decoder_type& decoder) noexcept
+template <typename CharT, json::validation Mode>
+token::code::value basic_reader<CharT, Mode>::frame::next_object_key(decoder_type& decoder) noexcept
 {
     decoder.next();
     if (decoder.code() == token::code::error_name_separator)
@@ -521,8 +663,8 @@ token::code::value basic_reader<CharT>::frame::next_object_key(decoder_type& dec
     return token::code::error_unexpected_token;
 }
 
-template <typename CharT>
-token::code::value basic_reader<CharT>::frame::next_object_value(decoder_type& decoder) noexcept
+template <typename CharT, json::validation Mode>
+token::code::value basic_reader<CharT, Mode>::frame::next_object_value(decoder_type& decoder) noexcept
 {
     decoder.next();
     const auto current = decoder.code();
@@ -11,6 +11,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cstddef> // std::size_t
 #include <trial/protocol/core/detail/config.hpp>
 #include <trial/protocol/core/detail/bit.hpp>
 #include <trial/protocol/core/detail/simd.hpp>
@@ -43,7 +44,7 @@ auto scan_narrow(const CharT *marker,
                                         _mm_cmplt_epi8(data, lower));
         const auto mask = _mm_movemask_epi8(avoid);
         if (mask != 0)
-            return marker + core::detail::countl_zero(mask);
+            return marker + core::detail::countr_zero(mask);
         marker += 16;
     }
 #endif
@@ -71,7 +72,7 @@ auto scan_digit(const CharT *marker,
         data = _mm_cmplt_epi8(data, legal);
         const auto mask = _mm_movemask_epi8(data);
         if (mask != 0)
-            return marker + core::detail::countl_zero(mask);
+            return marker + core::detail::countr_zero(mask);
         marker += 16;
     }
 #endif
@@ -105,6 +106,125 @@ auto scan_whitespace(const CharT *marker,
     return marker;
 }
 
+// Returns the first quote or bracket
+template <typename CharT>
+auto scan_structural(const CharT *marker,
+                     const CharT * const tail) noexcept -> const CharT *
+{
+#if defined(TRIAL_PROTOCOL_USE_SSE2)
+    // Folds square brackets onto curly brackets
+    const auto folder = _mm_set1_epi8(0x20);
+    const auto quote = _mm_set1_epi8('"');
+    const auto open = _mm_set1_epi8('{');
+    const auto close = _mm_set1_epi8('}');
+    while (tail - marker > 16)
+    {
+        const auto data = _mm_loadu_si128((const __m128i *)marker);
+        const auto folded = _mm_or_si128(data, folder);
+        const auto found = _mm_or_si128(_mm_cmpeq_epi8(data, quote),
+                                        _mm_or_si128(_mm_cmpeq_epi8(folded, open),
+                                                     _mm_cmpeq_epi8(folded, close)));
+        const auto mask = _mm_movemask_epi8(found);
+        if (mask != 0)
+            return marker + core::detail::countr_zero(mask);
+        marker += 16;
+    }
+#endif
+
+    while (marker < tail)
+    {
+        switch (*marker)
+        {
+        case '"':
+        case '[':
+        case ']':
+        case '{':
+        case '}':
+            return marker;
+        default:
+            ++marker;
+            break;
+        }
+    }
+    return marker;
+}
+
+// Returns the first quote or escape character
+template <typename CharT>
+auto scan_quote(const CharT *marker,
+                const CharT * const tail) noexcept -> const CharT *
+{
+#if defined(TRIAL_PROTOCOL_USE_SSE2)
+    const auto quote = _mm_set1_epi8('"');
+    const auto escape = _mm_set1_epi8('\\');
+    while (tail - marker > 16)
+    {
+        const auto data = _mm_loadu_si128((const __m128i *)marker);
+        const auto found = _mm_or_si128(_mm_cmpeq_epi8(data, quote),
+                                        _mm_cmpeq_epi8(data, escape));
+        const auto mask = _mm_movemask_epi8(found);
+        if (mask != 0)
+            return marker + core::detail::countr_zero(mask);
+        marker += 16;
+    }
+#endif
+
+    while ((marker < tail) && (*marker != '"') && (*marker != '\\'))
+    {
+        ++marker;
+    }
+    return marker;
+}
+
+// Returns the end bracket of the container whose begin bracket precedes
+// marker, or tail if not found.
+//
+// Brackets are counted outside strings without distinguishing between array
+// and object brackets, so the content of the container is not validated.
+template <typename CharT>
+auto scan_container(const CharT *marker,
+                    const CharT * const tail) noexcept -> const CharT *
+{
+    std::size_t depth = 1;
+    while (true)
+    {
+        marker = scan_structural(marker, tail);
+        if (marker == tail)
+            return tail;
+
+        switch (*marker)
+        {
+        case '"':
+            // Skip string
+            ++marker;
+            while (true)
+            {
+                marker = scan_quote(marker, tail);
+                if (marker == tail)
+                    return tail;
+                if (*marker == '"')
+                    break;
+                // Skip escaped character
+                if (tail - marker < 2)
+                    return tail;
+                marker += 2;
+            }
+            break;
+
+        case '[':
+        case '{':
+            ++depth;
+            break;
+
+        default:
+            if (--depth == 0)
+                return marker;
+            break;
+        }
+        ++marker;
+    }
+}
+
 } // namespace detail
 } // namespace json
 } // namespace protocol
@@ -0,0 +1,455 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_SCHEMA_IPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_SCHEMA_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/json/partial/skip.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// Member decoding
+//-----------------------------------------------------------------------------
+
+// Scalars and strings
+
+template <typename CharT, typename M, typename Schema>
+struct schema_member
+{
+    static void read(basic_reader<CharT>& reader,
+                     M& member,
+                     const Schema&,
+                     std::error_code& ec)
+    {
+        switch (reader.symbol())
+        {
+        case token::symbol::end:
+        case token::symbol::end_array:
+        case token::symbol::end_object:
+            ec = make_error_code(insufficient_tokens);
+            return;
+
+        case token::symbol::error:
+            ec = reader.error();
+            return;
+
+        default:
+            break;
+        }
+        const auto errc = reader.value(member);
+        if (errc != no_error)
+        {
+            ec = make_error_code(errc);
+            return;
+        }
+        if (!reader.next())
+            ec = reader.error();
+    }
+
+    static void write(basic_writer<CharT>& writer,
+                      const M& member,
+                      const Schema&)
+    {
+        writer.bare_value(member);
+    }
+};
+
+// Nested objects
+
+template <typename CharT, typename M, typename... Fields>
+struct schema_member<CharT, M, basic_schema<M, CharT, Fields...>>
+{
+    static void read(basic_reader<CharT>& reader,
+                     M& member,
+                     const basic_schema<M, CharT, Fields...>& nested,
+                     std::error_code& ec)
+    {
+        nested.read(reader, member, ec);
+    }
+
+    static void write(basic_writer<CharT>& writer,
+                      const M& member,
+                      const basic_schema<M, CharT, Fields...>& nested)
+    {
+        writer.literal(nested.fragment(0));
+        nested.write_members(writer, member, std::integral_constant<std::size_t, 0>());
+    }
+};
+
+// Arrays
+
+template <typename CharT, typename U, typename Allocator, typename Schema>
+struct schema_member<CharT, std::vector<U, Allocator>, Schema>
+{
+    static void read(basic_reader<CharT>& reader,
+                     std::vector<U, Allocator>& member,
+                     const Schema& nested,
+                     std::error_code& ec)
+    {
+        switch (reader.symbol())
+        {
+        case token::symbol::begin_array:
+            break;
+
+        case token::symbol::end:
+        case token::symbol::end_array:
+        case token::symbol::end_object:
+            ec = make_error_code(insufficient_tokens);
+            return;
+
+        case token::symbol::error:
+            ec = reader.error();
+            return;
+
+        default:
+            ec = make_error_code(incompatible_type);
+            return;
+        }
+        member.clear();
+        reader.next();
+        while (true)
+        {
+            switch (reader.symbol())
+            {
+            case token::symbol::end_array:
+                if (!reader.next())
+                    ec = reader.error();
+                return;
+
+            case token::symbol::end:
+                ec = make_error_code(insufficient_tokens);
+                return;
+
+            case token::symbol::error:
+                ec = reader.error();
+                return;
+
+            default:
+                member.emplace_back();
+                schema_member<CharT, U, Schema>::read(reader, member.back(), nested, ec);
+                if (ec)
+                    return;
+                break;
+            }
+        }
+    }
+
+    static void write(basic_writer<CharT>& writer,
+                      const std::vector<U, Allocator>& member,
+                      const Schema& nested)
+    {
+        using view_type = typename basic_writer<CharT>::view_type;
+        const CharT begin_array = CharT('[');
+        const CharT value_separator = CharT(',');
+        const CharT end_array = CharT(']');
+
+        writer.literal(view_type(&begin_array, 1));
+        for (auto it = member.begin(); it != member.end(); ++it)
+        {
+            if (it != member.begin())
+            {
+                writer.literal(view_type(&value_separator, 1));
+            }
+            schema_member<CharT, U, Schema>::write(writer, *it, nested);
+        }
+        writer.literal(view_type(&end_array, 1));
+    }
+};
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+// basic_schema
+//-----------------------------------------------------------------------------
+
+template <typename T, typename CharT, typename... Fields>
+basic_schema<T, CharT, Fields...>::basic_schema(Fields... list)
+    : fields(list...),
+      names{{ list.name... }},
+      seed(0)
+{
+    for (size_type i = 0; i < names.size(); ++i)
+    {
+        for (size_type j = i + 1; j < names.size(); ++j)
+        {
+            if (names[i] == names[j])
+                throw json::error(invalid_key);
+        }
+    }
+
+    // Render the object keys with the surrounding punctuation
+    for (size_type i = 0; i < names.size(); ++i)
+    {
+        auto& fragment = fragments[i];
+        fragment += (i == 0) ? CharT('{') : CharT(',');
+        basic_writer<CharT> key_writer(fragment);
+        key_writer.value(std::basic_string<CharT>(names[i].data(), names[i].size()));
+        fragment += CharT(':');
+    }
+    fragments.back() = CharT('}');
+
+    // Search for a seed without collisions, and grow the table if too many
+    // seeds have been tried
+    size_type capacity = 1;
+    while (capacity < 2 * names.size())
+    {
+        capacity *= 2;
+    }
+    while (true)
+    {
+        for (std::uint32_t candidate = 0; candidate < 64; ++candidate)
+        {
+            table.assign(capacity, size_type(-1));
+            size_type i = 0;
+            for (; i < names.size(); ++i)
+            {
+                auto& slot = table[hash(names[i], candidate) & (capacity - 1)];
+                if (slot != size_type(-1))
+                    break;
+                slot = i;
+            }
+            if (i == names.size())
+            {
+                seed = candidate;
+                return;
+            }
+        }
+        capacity *= 2;
+    }
+}
+
+template <typename T, typename CharT, typename... Fields>
+void basic_schema<T, CharT, Fields...>::read(reader_type& reader,
+                                             value_type& output,
+                                             std::error_code& ec) const
+{
+    switch (reader.symbol())
+    {
+    case token::symbol::begin_object:
+        break;
+
+    case token::symbol::end:
+    case token::symbol::end_array:
+    case token::symbol::end_object:
+        ec = make_error_code(insufficient_tokens);
+        return;
+
+    case token::symbol::error:
+        ec = reader.error();
+        return;
+
+    default:
+        ec = make_error_code(incompatible_type);
+        return;
+    }
+
+    std::basic_string<CharT> buffer;
+    reader.next();
+    while (true)
+    {
+        switch (reader.symbol())
+        {
+        case token::symbol::end_object:
+            if (!reader.next())
+                ec = reader.error();
+            return;
+
+        case token::symbol::end:
+            ec = make_error_code(insufficient_tokens);
+            return;
+
+        case token::symbol::error:
+            ec = reader.error();
+            return;
+
+        default:
+            {
+                const size_type index = find(key(reader, buffer));
+                if (!reader.next())
+                {
+                    ec = reader.error() ? reader.error() : make_error_code(insufficient_tokens);
+                    return;
+                }
+                if (index < sizeof...(Fields))
+                {
+                    read_field(index, reader, output, ec, index_constant<0>());
+                }
+                else
+                {
+                    partial::skip(reader, ec);
+                }
+                if (ec)
+                    return;
+            }
+            break;
+        }
+    }
+}
+
+template <typename T, typename CharT, typename... Fields>
+void basic_schema<T, CharT, Fields...>::read(reader_type& reader,
+                                             value_type& output) const
+{
+    std::error_code ec;
+    read(reader, output, ec);
+    if (ec)
+        throw json::error(ec);
+}
+
+template <typename T, typename CharT, typename... Fields>
+void basic_schema<T, CharT, Fields...>::write(writer_type& writer,
+                                              const value_type& input) const
+{
+    writer.literal_value(fragment(0));
+    write_members(writer, input, index_constant<0>());
+}
+
+template <typename T, typename CharT, typename... Fields>
+auto basic_schema<T, CharT, Fields...>::fragment(size_type index) const noexcept -> view_type
+{
+    return view_type(fragments[index].data(), fragments[index].size());
+}
+
+// FNV-1a
+template <typename T, typename CharT, typename... Fields>
+std::uint32_t basic_schema<T, CharT, Fields...>::hash(const view_type& key,
+                                                      std::uint32_t seed) noexcept
+{
+    std::uint32_t result = 2166136261U ^ (seed * 0x9E3779B9U);
+    for (auto character : key)
+    {
+        result ^= std::uint32_t(character);
+        result *= 16777619U;
+    }
+    return result ^ (result >> 15);
+}
+
+// Returns the current object key without conversion unless it is escaped
+template <typename T, typename CharT, typename... Fields>
+auto basic_schema<T, CharT, Fields...>::key(const reader_type& reader,
+                                            std::basic_string<CharT>& buffer) -> view_type
+{
+    view_type result = reader.literal();
+    result = result.substr(1, result.size() - 2);
+    if (result.find(CharT('\\')) != view_type::npos)
+    {
+        buffer = reader.template value<std::basic_string<CharT>>();
+        result = view_type(buffer.data(), buffer.size());
+    }
+    return result;
+}
+
+template <typename T, typename CharT, typename... Fields>
+auto basic_schema<T, CharT, Fields...>::find(const view_type& key) const noexcept -> size_type
+{
+    const size_type index = table[hash(key, seed) & (table.size() - 1)];
+    if ((index < names.size()) && (names[index] == key))
+        return index;
+    return size_type(-1);
+}
+
+template <typename T, typename CharT, typename... Fields>
+template <std::size_t I>
+void basic_schema<T, CharT, Fields...>::read_field(size_type index,
+                                                   reader_type& reader,
+                                                   value_type& output,
+                                                   std::error_code& ec,
+                                                   index_constant<I>) const
+{
+    if (index == I)
+    {
+        const auto& current = std::get<I>(fields);
+        using member_type = typename std::remove_reference<decltype(output.*current.member)>::type;
+        using nested_type = typename std::decay<decltype(current.nested)>::type;
+        detail::schema_member<CharT, member_type, nested_type>::read(reader,
+                                                                     output.*current.member,
+                                                                     current.nested,
+                                                                     ec);
+    }
+    else
+    {
+        read_field(index, reader, output, ec, index_constant<I + 1>());
+    }
+}
+
+template <typename T, typename CharT, typename... Fields>
+void basic_schema<T, CharT, Fields...>::read_field(size_type,
+                                                   reader_type&,
+                                                   value_type&,
+                                                   std::error_code&,
+                                                   index_constant<sizeof...(Fields)>) const
+{
+}
+
+template <typename T, typename CharT, typename... Fields>
+template <std::size_t I>
+void basic_schema<T, CharT, Fields...>::write_members(writer_type& writer,
+                                                      const value_type& input,
+                                                      index_constant<I>) const
+{
+    if (I > 0)
+    {
+        writer.literal(fragment(I));
+    }
+    const auto& current = std::get<I>(fields);
+    using member_type = typename std::remove_reference<decltype(input.*current.member)>::type;
+    using nested_type = typename std::decay<decltype(current.nested)>::type;
+    detail::schema_member<CharT, typename std::remove_const<member_type>::type, nested_type>::
+        write(writer, input.*current.member, current.nested);
+    write_members(writer, input, index_constant<I + 1>());
+}
+
+template <typename T, typename CharT, typename... Fields>
+void basic_schema<T, CharT, Fields...>::write_members(writer_type& writer,
+                                                      const value_type&,
+                                                      index_constant<sizeof...(Fields)>) const
+{
+    writer.literal(fragment(sizeof...(Fields)));
+}
+
+//-----------------------------------------------------------------------------
+// Factories
+//-----------------------------------------------------------------------------
+
+template <typename CharT, typename T, typename M>
+detail::schema_field<CharT, T, M, detail::no_schema>
+field(const CharT *name, M T::* member)
+{
+    return { name, member, {} };
+}
+
+template <typename CharT, typename T, typename M, typename U, typename... Fields>
+detail::schema_field<CharT, T, M, basic_schema<U, CharT, Fields...>>
+field(const CharT *name, M T::* member, const basic_schema<U, CharT, Fields...>& nested)
+{
+    return { name, member, nested };
+}
+
+template <typename T, typename Field, typename... Fields>
+basic_schema<T, typename Field::char_type, Field, Fields...>
+make_schema(Field first, Fields... rest)
+{
+    return { std::move(first), std::move(rest)... };
+}
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_SCHEMA_IPP
@@ -143,12 +143,38 @@ auto basic_writer<CharT, N>::value(T&& data) -> size_type
     return encoder.value(std::forward<T>(data));
 }
 
+template <typename CharT, std::size_t N>
+template <typename T>
+auto basic_writer<CharT, N>::values(const T *data, size_type size) -> size_type
+{
+    validate_scope();
+
+    stack.top().write_separator();
+    return encoder.values(data, size);
+}
+
+template <typename CharT, std::size_t N>
+template <typename T>
+auto basic_writer<CharT, N>::bare_value(T&& data) -> size_type
+{
+    return encoder.value(std::forward<T>(data));
+}
+
 template <typename CharT, std::size_t N>
 auto basic_writer<CharT, N>::literal(const view_type& data) BOOST_NOEXCEPT -> size_type
 {
     return encoder.literal(data);
 }
 
+template <typename CharT, std::size_t N>
+auto basic_writer<CharT, N>::literal_value(const view_type& data) -> size_type
+{
+    validate_scope();
+
+    stack.top().write_separator();
+    return encoder.literal(data);
+}
+
 template <typename CharT, std::size_t N>
 void basic_writer<CharT, N>::validate_scope()
 {
@@ -0,0 +1,123 @@
+#ifndef TRIAL_PROTOCOL_JSON_FILTER_HPP
+#define TRIAL_PROTOCOL_JSON_FILTER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <functional>
+#include <system_error>
+#include <vector>
+#include <trial/protocol/json/error.hpp>
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/partial/skip.hpp>
+#include <trial/protocol/json/writer.hpp>
+#include <trial/protocol/json/query.hpp>
+#include <trial/protocol/json/detail/pointer.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+//! @brief Streaming rewrite of JSON values selected by paths.
+//!
+//! Copies a JSON value from a reader to a writer, while values selected by
+//! JSON Pointer paths are replaced or erased. Paths use the same syntax as
+//! basic_query.
+//!
+//! Values that cannot contain a selected value are copied verbatim as
+//! literals, so their contents are neither converted nor re-encoded.
+//! Containers on the way to a selected value are re-encoded, which removes
+//! their whitespace.
+template <typename CharT>
+class basic_filter
+{
+public:
+    using size_type = std::size_t;
+    using reader_type = basic_reader<CharT>;
+    using writer_type = basic_writer<CharT>;
+    using view_type = typename reader_type::view_type;
+    using match = typename basic_query<CharT>::match;
+
+    //! @brief Function invoked with a selected value.
+    //!
+    //! The callback must write exactly one value to the writer.
+    using callback_type = std::function<void (const match&, writer_type&)>;
+
+    basic_filter();
+
+    //! @brief Replace selected values.
+    //!
+    //! If several paths select the same value, then the path that was added
+    //! first takes effect.
+    //!
+    //! @returns The ordinal of the path.
+    //! @throws json::error if the path is malformed or the callback is empty.
+    size_type replace(const view_type& path, callback_type callback);
+
+    //! @brief Erase selected values.
+    //!
+    //! Object members are erased together with their keys.
+    //!
+    //! @returns The ordinal of the path.
+    //! @throws json::error if the path is malformed.
+    size_type erase(const view_type& path);
+
+    //! @brief Skip unselected containers without validating their content.
+    //!
+    //! See partial::skip_mode::relaxed.
+    void relaxed(bool enable) noexcept;
+
+    //! @brief Copy the current value of the reader to the writer.
+    //!
+    //! The reader is advanced past the current value.
+    //!
+    //! @param[out] ec Error code if the input is malformed.
+    void apply(reader_type& reader, writer_type& writer, std::error_code& ec) const;
+
+    //! @throws json::error if the input is malformed.
+    void apply(reader_type& reader, writer_type& writer) const;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    using trie_type = detail::basic_pointer_trie<CharT>;
+
+    size_type insert(const view_type& path, callback_type callback);
+    size_type find(const std::vector<size_type>& active,
+                   size_type first,
+                   size_type last) const noexcept;
+    void visit(reader_type& reader,
+               writer_type& writer,
+               std::vector<size_type>& active,
+               size_type first,
+               std::error_code& ec) const;
+
+private:
+    trie_type trie;
+    // Rule of each trie node
+    std::vector<size_type> rules;
+    // Callback of each rule, or empty for erase
+    std::vector<callback_type> callbacks;
+    partial::skip_mode mode = partial::skip_mode::strict;
+#endif
+};
+
+using filter = basic_filter<char>;
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/json/detail/filter.ipp>
+
+#endif // TRIAL_PROTOCOL_JSON_FILTER_HPP
@@ -12,6 +12,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <trial/dynamic/variable.hpp>
+#include <trial/dynamic/string_pool.hpp>
 #include <trial/protocol/json/reader.hpp>
 #include <trial/protocol/json/detail/parse.ipp>
 
@@ -41,6 +42,24 @@ auto parse(json::reader& reader) -> dynamic::basic_variable<Allocator>
     return parser.parse();
 }
 
+//! @brief Decode JSON formatted data into dynamic variable with pooled keys.
+//!
+//! Starts decoding at the current position of @c reader. Object keys are
+//! interned in @c pool, so that keys can share storage across objects and
+//! documents parsed with the same pool.
+//!
+//! @param reader Reader pointing to an arbitrary position within a buffer.
+//! @param pool Pool of object keys.
+//! @returns Dynamic variable containing the decoded JSON data.
+
+template <typename Allocator>
+auto parse(json::reader& reader,
+           dynamic::basic_string_pool<Allocator>& pool) -> dynamic::basic_variable<Allocator>
+{
+    detail::basic_parser<char, Allocator> parser(reader, &pool);
+    return parser.parse();
+}
+
 } // namespace partial
 
 //! @brief Decode JSON formatted data into dynamic variable.
@@ -52,7 +71,24 @@ template <typename U, typename Allocator = std::allocator<char>>
 auto parse(const U& input) -> dynamic::basic_variable<Allocator>
 {
     json::reader reader(input);
-    auto result = partial::parse(reader);
+    auto result = partial::parse<Allocator>(reader);
+    if (reader.symbol() != json::token::symbol::end)
+        throw json::error(json::unexpected_token);
+    return result;
+}
+
+//! @brief Decode JSON formatted data into dynamic variable with pooled keys.
+//!
+//! @param input The JSON formatted input buffer.
+//! @param pool Pool of object keys.
+//! @returns Dynamic variable containing the decoded JSON data.
+
+template <typename U, typename Allocator>
+auto parse(const U& input,
+           dynamic::basic_string_pool<Allocator>& pool) -> dynamic::basic_variable<Allocator>
+{
+    json::reader reader(input);
+    auto result = partial::parse(reader, pool);
     if (reader.symbol() != json::token::symbol::end)
         throw json::error(json::unexpected_token);
     return result;
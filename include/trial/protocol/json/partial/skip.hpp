@@ -22,13 +22,53 @@ namespace json
 namespace partial
 {
 
+//! @brief Validation of skipped containers.
+enum class skip_mode
+{
+    //! Every nested token is parsed and validated.
+    strict,
+    //! The end bracket is found by counting brackets outside strings, so
+    //! nested tokens are neither converted nor validated.
+    relaxed
+};
+
 template<class CharT>
 typename basic_reader<CharT>::view_type
-skip(basic_reader<CharT> &reader, std::error_code &ec)
+skip(basic_reader<CharT> &reader, skip_mode mode, std::error_code &ec)
 {
     using view_type = typename basic_reader<CharT>::view_type;
     using size_type = typename view_type::size_type;
 
+    if (mode == skip_mode::relaxed) {
+        switch (reader.symbol()) {
+        case token::symbol::begin_array:
+        case token::symbol::begin_object:
+            {
+                const CharT * const head = reader.literal().data();
+                if (!reader.next_end())
+                {
+                    switch (reader.code())
+                    {
+                    case token::code::error_expected_end_array:
+                    case token::code::error_expected_end_object:
+                        ec = errc::insufficient_tokens;
+                        break;
+                    default:
+                        ec = reader.error();
+                        break;
+                    }
+                    return view_type(head, std::distance(head, reader.literal().begin()));
+                }
+                const CharT * const tail = reader.literal().end();
+                if (!reader.next()) // Skip over end bracket
+                    ec = reader.error();
+                return view_type(head, std::distance(head, tail));
+            }
+        default:
+            break;
+        }
+    }
+
     switch (reader.symbol()) {
     case token::symbol::end:
     case token::symbol::error:
@@ -93,15 +133,29 @@ skip(basic_reader<CharT> &reader, std::error_code &ec)
 
 template<class CharT>
 typename basic_reader<CharT>::view_type
-skip(basic_reader<CharT> &reader)
+skip(basic_reader<CharT> &reader, std::error_code &ec)
+{
+    return skip(reader, skip_mode::strict, ec);
+}
+
+template<class CharT>
+typename basic_reader<CharT>::view_type
+skip(basic_reader<CharT> &reader, skip_mode mode)
 {
     std::error_code ec;
-    auto ret = skip(reader, ec);
+    auto ret = skip(reader, mode, ec);
     if (ec)
         throw json::error(ec);
     return ret;
 }
 
+template<class CharT>
+typename basic_reader<CharT>::view_type
+skip(basic_reader<CharT> &reader)
+{
+    return skip(reader, skip_mode::strict);
+}
+
 } // namespace partial
 } // namespace json
 } // namespace protocol
@@ -0,0 +1,176 @@
+#ifndef TRIAL_PROTOCOL_JSON_PUSH_PARSER_HPP
+#define TRIAL_PROTOCOL_JSON_PUSH_PARSER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <trial/protocol/json/error.hpp>
+#include <trial/protocol/json/token.hpp>
+#include <trial/protocol/json/detail/decoder.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+//! @brief Callback-based JSON parser.
+//!
+//! Parses JSON formatted input and invokes an event handler for each token.
+//! The handlers are member functions of Derived, which must inherit from
+//! basic_push_parser (curiously recurring template pattern.) Handlers are
+//! resolved at compile-time, so they can be inlined into the parsing loop.
+//!
+//! Derived may define any of the following handlers. The handlers that are
+//! not defined by Derived are inherited from basic_push_parser and ignore the
+//! event.
+//! -# bool on_null()
+//! -# bool on_boolean(bool)
+//! -# bool on_integer(std::intmax_t)
+//! -# bool on_unsigned_integer(std::uintmax_t)
+//! -# bool on_real(double)
+//! -# bool on_string(const view_type&)
+//! -# bool on_key(const view_type&)
+//! -# bool on_begin_array()
+//! -# bool on_end_array()
+//! -# bool on_begin_object()
+//! -# bool on_end_object()
+//!
+//! Integers that are too large for std::intmax_t are passed to
+//! on_unsigned_integer(), which by default forwards the value to on_real().
+//! Integers that are too large for std::uintmax_t as well are passed to
+//! on_real().
+//!
+//! A handler returns false to abort parsing. Strings and keys are passed
+//! unescaped without the surrounding quotes. The views passed to on_string()
+//! and on_key() are only valid during the invocation of the handler.
+//!
+//! The input can be passed in chunks. Tokens that may continue in the next
+//! chunk are retained by the parser and completed when more input arrives.
+template <typename Derived, typename CharT>
+class basic_push_parser
+{
+public:
+    using value_type = typename detail::basic_decoder<CharT>::value_type;
+    using size_type = typename detail::basic_decoder<CharT>::size_type;
+    using view_type = core::detail::basic_string_view<CharT, core::char_traits<CharT>>;
+
+    basic_push_parser() = default;
+
+    //! @brief Parse a chunk of the input.
+    //!
+    //! Handlers are invoked for all complete tokens in the chunk. The
+    //! parser does not retain the view, but it copies incomplete tokens at
+    //! the end of the chunk.
+    //!
+    //! @param[in] chunk A string view of a JSON formatted buffer.
+    //! @returns false if an error occurred or a handler aborted parsing, true otherwise.
+    bool parse(const view_type& chunk);
+
+    //! @brief Signal the end of the input.
+    //!
+    //! Handlers are invoked for retained tokens.
+    //!
+    //! @returns false if an error occurred, a handler aborted parsing, or the
+    //!          input does not contain a complete JSON value, true otherwise.
+    bool finish();
+
+    //! @brief Prepare the parser for a new input.
+    void reset();
+
+    //! @returns true if a handler aborted parsing.
+    bool aborted() const noexcept;
+
+    //! @brief Get the current error.
+    //!
+    //! @returns The current error code, or json::no_error if parsing has not
+    //!          failed. Aborting is not an error.
+    std::error_code error() const noexcept;
+
+    //! @brief Get the current nesting level.
+    //!
+    //! @returns The number of open containers.
+    size_type level() const noexcept;
+
+protected:
+#ifndef BOOST_DOXYGEN_INVOKED
+    bool on_null() { return true; }
+    bool on_boolean(bool) { return true; }
+    bool on_integer(std::intmax_t) { return true; }
+    bool on_unsigned_integer(std::uintmax_t value) { return derived().on_real(double(value)); }
+    bool on_real(double) { return true; }
+    bool on_string(const view_type&) { return true; }
+    bool on_key(const view_type&) { return true; }
+    bool on_begin_array() { return true; }
+    bool on_end_array() { return true; }
+    bool on_begin_object() { return true; }
+    bool on_end_object() { return true; }
+
+private:
+    using decoder_type = detail::basic_decoder<value_type>;
+
+    enum class state : unsigned char
+    {
+        outer,
+        array_first,
+        array_value,
+        array_next,
+        object_first,
+        object_key,
+        object_colon,
+        object_value,
+        object_next,
+        done,
+        halt
+    };
+
+    Derived& derived() noexcept;
+    state after_value() const noexcept;
+
+    const value_type *consume(const value_type *first,
+                              const value_type *last,
+                              bool final);
+    bool value(const decoder_type& decoder);
+    bool string(const decoder_type& decoder, bool is_key);
+    bool end_array();
+    bool end_object();
+    bool fail(token::code::value code);
+    bool fail(json::errc errc);
+    bool abort();
+
+private:
+    state current = state::outer;
+    // State to resume after the end of each open container
+    std::vector<state> stack;
+    json::errc status = json::no_error;
+    // Unconsumed input from the previous chunk
+    std::basic_string<value_type> buffer;
+    // Unescaped string
+    std::basic_string<value_type> scratch;
+#endif
+};
+
+//! @brief Callback-based JSON parser for char input.
+template <typename Derived>
+using push_parser = basic_push_parser<Derived, char>;
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/json/detail/push_parser.ipp>
+
+#endif // TRIAL_PROTOCOL_JSON_PUSH_PARSER_HPP
@@ -0,0 +1,136 @@
+#ifndef TRIAL_PROTOCOL_JSON_QUERY_HPP
+#define TRIAL_PROTOCOL_JSON_QUERY_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <initializer_list>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <trial/protocol/json/error.hpp>
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/partial/skip.hpp>
+#include <trial/protocol/json/detail/pointer.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+//! @brief Compiled set of JSON Pointer paths.
+//!
+//! Paths use the JSON Pointer syntax from RFC 6901, such as "/user/id". The
+//! reference token "*" matches any array element or object member, so
+//! "/items/*/price" selects the price of every item.
+//!
+//! All paths are evaluated in a single forward pass over the input. Values
+//! that cannot match any path are skipped without being converted.
+template <typename CharT>
+class basic_query
+{
+public:
+    using size_type = std::size_t;
+    using reader_type = basic_reader<CharT>;
+    using view_type = typename reader_type::view_type;
+
+    //! @brief A value selected by a path.
+    struct match
+    {
+        //! @brief Ordinal of the matching path.
+        size_type path;
+        //! @brief Encoded value, including nested values for containers.
+        view_type literal;
+
+        //! @brief Converts the encoded value into ReturnType.
+        //!
+        //! @throws json::error if the value is incompatible with ReturnType.
+        template <typename ReturnType> ReturnType value() const;
+    };
+
+    basic_query();
+
+    //! @brief Construct a query from a list of paths.
+    //!
+    //! The paths are given ordinals in the order they appear in the list.
+    //!
+    //! @throws json::error if a path is malformed.
+    basic_query(std::initializer_list<view_type> paths);
+
+    //! @brief Add a path to the query.
+    //!
+    //! @returns The ordinal of the path.
+    //! @throws json::error if the path is malformed.
+    size_type insert(const view_type& path);
+
+    //! @returns The number of paths.
+    size_type size() const noexcept;
+
+    //! @brief Skip unselected containers without validating their content.
+    //!
+    //! See partial::skip_mode::relaxed.
+    void relaxed(bool enable) noexcept;
+
+    //! @brief Evaluate the query against the current value of the reader.
+    //!
+    //! The callback is invoked with a match for each path that selects a
+    //! value. The reader is advanced past the current value.
+    //!
+    //! Matches are reported when the end of their value has been reached,
+    //! so a matching container is reported after the matches inside it.
+    //!
+    //! @param reader Reader pointing to an arbitrary position within a buffer.
+    //! @param callback Function object invoked as callback(const match&).
+    //! @param[out] ec Error code if the input is malformed.
+    template <typename Callback>
+    void evaluate(reader_type& reader, Callback&& callback, std::error_code& ec) const;
+
+    //! @throws json::error if the input is malformed.
+    template <typename Callback>
+    void evaluate(reader_type& reader, Callback&& callback) const;
+
+    //! @brief Evaluate the query against an input buffer.
+    //!
+    //! @returns The matches in the order they are reported.
+    //! @throws json::error if the input is malformed.
+    std::vector<match> evaluate(const view_type& input) const;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    using trie_type = detail::basic_pointer_trie<CharT>;
+
+    template <typename Callback>
+    void visit(reader_type& reader,
+               std::vector<size_type>& active,
+               size_type first,
+               Callback& callback,
+               std::error_code& ec) const;
+
+private:
+    trie_type trie;
+    // Path ordinals of each trie node
+    std::vector<std::vector<size_type>> paths;
+    size_type count = 0;
+    partial::skip_mode mode = partial::skip_mode::strict;
+#endif
+};
+
+using query = basic_query<char>;
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/json/detail/query.ipp>
+
+#endif // TRIAL_PROTOCOL_JSON_QUERY_HPP
@@ -13,8 +13,10 @@
 
 #include <string>
 #include <stack>
+#include <vector>
 #include <trial/protocol/json/error.hpp>
 #include <trial/protocol/json/token.hpp>
+#include <trial/protocol/json/validation.hpp>
 #include <trial/protocol/json/detail/decoder.hpp>
 
 namespace trial
@@ -24,18 +26,25 @@ namespace protocol
 namespace json
 {
 
+template <typename CharT, typename Source>
+class basic_async_reader;
+
 //! @brief Incremental JSON reader.
 //!
 //! Parse a JSON formatted input buffer incrementally. Incrementally means that
 //! the reader only parses enough of the input to identify the next token.
 //! The entire input has to be parsed by repeating parsing the next token until
 //! the end of the input.
-template <typename CharT>
+//!
+//! The Mode determines whether the input is validated. With
+//! validation::trusted the grammar of strings and numbers is not checked,
+//! which is faster for input that is known to be well-formed.
+template <typename CharT, json::validation Mode = json::validation::strict>
 class basic_reader
 {
 public:
-    using value_type = typename detail::basic_decoder<CharT>::value_type;
-    using size_type = typename detail::basic_decoder<CharT>::size_type;
+    using value_type = typename detail::basic_decoder<CharT, Mode>::value_type;
+    using size_type = typename detail::basic_decoder<CharT, Mode>::size_type;
     using view_type = core::detail::basic_string_view<CharT, core::char_traits<CharT>>;
 
     basic_reader();
@@ -68,6 +77,22 @@ public:
     //! @returns false if current token does not have the expected value.
     bool next(token::code::value expect);
 
+    //! @brief Parse the end token of the current container.
+    //!
+    //! The content of the container is skipped by counting brackets outside
+    //! strings, so it is neither converted nor validated.
+    //!
+    //! @returns false if the current token does not begin a container, if an
+    //!          error occurred, or if end-of-input was reached, true otherwise.
+    bool next_end();
+
+    //! @brief Parse the token after the current value.
+    //!
+    //! Containers are skipped as with next_end().
+    //!
+    //! @returns false if an error occurred or end-of-input was reached, true otherwise.
+    bool next_sibling();
+
     //! @brief Parse the next token from a new view.
     //!
     //! The reader replaces its internal view with the @c view passed as
@@ -134,6 +159,26 @@ public:
     //! @returns json::errc if requested type is incompatible with the current token.
     template <typename T> json::errc value(T& output) const noexcept;
 
+    //! @brief Converts the current array into values of type T.
+    //!
+    //! The elements are converted as with value(T&) in a loop that bypasses
+    //! the token dispatch of next(), so this is faster than iterating over
+    //! a homogeneous array token by token.
+    //!
+    //! On success the reader is advanced past the array. If an element cannot
+    //! be converted, then the reader is left at that element, and the
+    //! elements before it have been written to the output.
+    //!
+    //! @param[out] output Output iterator that receives the converted values.
+    //! @returns json::errc if the current token is not an array, if an
+    //!          element is incompatible with T, or if the array is malformed.
+    template <typename T, typename OutputIterator>
+    json::errc values(OutputIterator output);
+
+    //! @brief Appends the converted values of the current array to output.
+    template <typename T, typename Allocator>
+    json::errc values(std::vector<T, Allocator>& output);
+
     //! @brief Collects a converted string.
     //!
     //! The Collector must implement the following functions:
@@ -152,11 +197,13 @@ public:
 
 #ifndef BOOST_DOXYGEN_INVOKED
 private:
+    template <typename, typename> friend class basic_async_reader;
+
     template <typename ReturnType, typename Enable = void>
     struct overloader;
 
 private:
-    using decoder_type = detail::basic_decoder<value_type>;
+    using decoder_type = detail::basic_decoder<value_type, Mode>;
     decoder_type decoder;
 
     struct frame
@@ -167,6 +214,9 @@ private:
 
         token::code::value (frame::*next)(decoder_type&) noexcept;
 
+        // Continue after an array element parsed outside the frame
+        void resume_array() noexcept;
+
     private:
         token::code::value next_outer(decoder_type&) noexcept;
         token::code::value next_array(decoder_type&) noexcept;
@@ -180,6 +230,7 @@ private:
 };
 
 using reader = basic_reader<char>;
+using trusted_reader = basic_reader<char, validation::trusted>;
 
 } // namespace json
 } // namespace protocol
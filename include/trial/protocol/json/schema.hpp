@@ -0,0 +1,198 @@
+#ifndef TRIAL_PROTOCOL_JSON_SCHEMA_HPP
+#define TRIAL_PROTOCOL_JSON_SCHEMA_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <trial/protocol/json/error.hpp>
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/writer.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace detail
+{
+
+struct no_schema {};
+
+template <typename CharT, typename M, typename Schema>
+struct schema_member;
+
+template <typename CharT, typename T, typename M, typename Schema>
+struct schema_field
+{
+    using char_type = CharT;
+    using view_type = typename basic_reader<CharT>::view_type;
+
+    view_type name;
+    M T::* member;
+    Schema nested;
+};
+
+} // namespace detail
+
+//! @brief Compiled description of how JSON object members map onto the
+//! members of a struct.
+//!
+//! A schema decodes a JSON object directly into an instance of T without
+//! going through an archive or a dynamic::variable. Object members may
+//! appear in any order. Member names are located with a perfect hash that is
+//! computed when the schema is constructed, so schemas are intended to be
+//! constructed once and reused.
+//!
+//! Unknown members are skipped. Members that are absent from the input leave
+//! the corresponding struct members unchanged. If a member appears several
+//! times, then the last occurrence takes effect.
+//!
+//! Schemas also encode instances of T. The object keys and the punctuation
+//! between members are rendered once when the schema is constructed, so
+//! only the member values are encoded for each instance.
+//!
+//! Schemas are created with make_schema() and field().
+template <typename T, typename CharT, typename... Fields>
+class basic_schema
+{
+public:
+    using size_type = std::size_t;
+    using value_type = T;
+    using reader_type = basic_reader<CharT>;
+    using writer_type = basic_writer<CharT>;
+    using view_type = typename reader_type::view_type;
+
+    //! @throws json::error if a member name is used by several fields.
+    basic_schema(Fields... list);
+
+    //! @returns The number of fields.
+    static constexpr size_type size() noexcept { return sizeof...(Fields); }
+
+    //! @brief Decode the current object of the reader into output.
+    //!
+    //! The reader is advanced past the object.
+    //!
+    //! @param[out] ec Error code if the input is malformed or a member
+    //!             value is incompatible with its field.
+    void read(reader_type& reader, value_type& output, std::error_code& ec) const;
+
+    //! @throws json::error if the input is malformed or a member value is
+    //!         incompatible with its field.
+    void read(reader_type& reader, value_type& output) const;
+
+    //! @brief Encode input as an object.
+    //!
+    //! Members are written in the order of the fields.
+    void write(writer_type& writer, const value_type& input) const;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    template <typename, typename, typename> friend struct detail::schema_member;
+
+    template <size_type I>
+    using index_constant = std::integral_constant<size_type, I>;
+
+    static std::uint32_t hash(const view_type& key, std::uint32_t seed) noexcept;
+    static view_type key(const reader_type& reader, std::basic_string<CharT>& buffer);
+
+    size_type find(const view_type& key) const noexcept;
+    view_type fragment(size_type index) const noexcept;
+
+    template <size_type I>
+    void read_field(size_type index,
+                    reader_type& reader,
+                    value_type& output,
+                    std::error_code& ec,
+                    index_constant<I>) const;
+    void read_field(size_type,
+                    reader_type&,
+                    value_type&,
+                    std::error_code&,
+                    index_constant<sizeof...(Fields)>) const;
+
+    void write_members(writer_type& writer,
+                       const value_type& input,
+                       index_constant<sizeof...(Fields)>) const;
+    template <size_type I>
+    void write_members(writer_type& writer,
+                       const value_type& input,
+                       index_constant<I>) const;
+
+private:
+    std::tuple<Fields...> fields;
+    std::array<view_type, sizeof...(Fields)> names;
+    // Perfect hash table from member names to field indices
+    std::vector<size_type> table;
+    std::uint32_t seed;
+    // Object keys with surrounding punctuation. Entry I precedes member I,
+    // and the last entry closes the object.
+    std::array<std::basic_string<CharT>, sizeof...(Fields) + 1> fragments;
+#endif
+};
+
+//! @brief Field that decodes a scalar, a string, or a std::vector of these.
+template <typename CharT, typename T, typename M>
+detail::schema_field<CharT, T, M, detail::no_schema>
+field(const CharT *name, M T::* member);
+
+//! @brief Field that decodes a nested object, or a std::vector of nested
+//! objects, with another schema.
+template <typename CharT, typename T, typename M, typename U, typename... Fields>
+detail::schema_field<CharT, T, M, basic_schema<U, CharT, Fields...>>
+field(const CharT *name, M T::* member, const basic_schema<U, CharT, Fields...>& nested);
+
+//! @brief Create a schema for T from a list of fields.
+//!
+//! @throws json::error if a member name is used by several fields.
+template <typename T, typename Field, typename... Fields>
+basic_schema<T, typename Field::char_type, Field, Fields...>
+make_schema(Field first, Fields... rest);
+
+//! @brief Schema used by archives to encode T.
+//!
+//! Specialize with a static get() function that returns a reference to the
+//! schema of T, and json::oarchive will use the schema to encode T.
+template <typename T, typename Enable = void>
+struct schema_traits
+{
+};
+
+namespace detail
+{
+
+template <typename T, typename Enable = void>
+struct has_schema : std::false_type
+{
+};
+
+template <typename T>
+struct has_schema<T, typename std::enable_if<std::is_void<decltype(void(schema_traits<T>::get()))>::value>::type>
+    : std::true_type
+{
+};
+
+} // namespace detail
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/json/detail/schema.ipp>
+
+#endif // TRIAL_PROTOCOL_JSON_SCHEMA_HPP
@@ -20,5 +20,6 @@
 #include <trial/protocol/json/serialization/std/vector.hpp>
 #include <trial/protocol/json/serialization/boost/optional.hpp>
 #include <trial/protocol/json/serialization/dynamic/variable.hpp>
+#include <trial/protocol/json/serialization/schema.hpp>
 
 #endif // TRIAL_PROTOCOL_JSON_SERIALIZATION_HPP
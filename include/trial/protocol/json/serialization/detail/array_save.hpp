@@ -11,6 +11,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <type_traits>
 #include <trial/protocol/json/serialization/serialization.hpp>
 #include <trial/protocol/core/serialization/array.hpp>
 
@@ -74,6 +75,24 @@ struct save_overloader< json::basic_oarchive<CharT>,
     static void save(json::basic_oarchive<CharT>& ar,
                      const T (&data)[N],
                      const unsigned int protocol_version)
+    {
+        save(ar, data, protocol_version, std::is_arithmetic<T>{});
+    }
+
+private:
+    // Arrays of numbers are saved in a single pass
+    static void save(json::basic_oarchive<CharT>& ar,
+                     const T (&data)[N],
+                     const unsigned int,
+                     std::true_type)
+    {
+        ar.save_values(data, N);
+    }
+
+    static void save(json::basic_oarchive<CharT>& ar,
+                     const T (&data)[N],
+                     const unsigned int protocol_version,
+                     std::false_type)
     {
         ar.template save<json::token::begin_array>();
         for (std::size_t i = 0; i < N; ++i)
@@ -70,6 +70,19 @@ void basic_iarchive<CharT>::load(T& value)
     next();
 }
 
+template <typename CharT>
+template <typename T, typename Allocator>
+void basic_iarchive<CharT>::load_values(std::vector<T, Allocator>& data)
+{
+    if (!at<token::begin_array>())
+    {
+        next(token::code::begin_array);
+    }
+    const auto result = member.reader.values(data);
+    if (result != json::no_error)
+        throw json::error(result);
+}
+
 template <typename CharT>
 template <typename Tag>
 bool basic_iarchive<CharT>::at() const
@@ -41,6 +41,21 @@ void basic_oarchive<CharT>::save(const T& data)
     writer.value(data);
 }
 
+template <typename CharT>
+template <typename T>
+void basic_oarchive<CharT>::save_values(const T *data, std::size_t size)
+{
+    writer.values(data, size);
+}
+
+template <typename CharT>
+template <typename T, typename... Fields>
+void basic_oarchive<CharT>::save(const T& data,
+                                 const basic_schema<T, value_type, Fields...>& schema)
+{
+    schema.write(writer, data);
+}
+
 template <typename CharT>
 template<typename T>
 void basic_oarchive<CharT>::save_override(const T& data)
@@ -12,6 +12,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <string>
+#include <vector>
 #include <boost/archive/detail/common_iarchive.hpp>
 #include <boost/archive/detail/register_archive.hpp>
 #include <trial/protocol/json/reader.hpp>
@@ -49,6 +50,10 @@ public:
     template <typename T>
     void load(T&);
 
+    //! @brief Load an array of values into a vector.
+    template <typename T, typename Allocator>
+    void load_values(std::vector<T, Allocator>&);
+
     template <typename Tag>
     bool at() const;
 
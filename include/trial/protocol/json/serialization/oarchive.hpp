@@ -11,6 +11,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cstddef> // std::size_t
 #include <string>
 #include <boost/archive/detail/common_oarchive.hpp>
 #include <boost/archive/detail/register_archive.hpp>
@@ -23,6 +24,9 @@ namespace protocol
 namespace json
 {
 
+template <typename T, typename CharT, typename... Fields>
+class basic_schema;
+
 template <typename CharT>
 class basic_oarchive
     : public boost::archive::detail::common_oarchive< basic_oarchive<CharT> >
@@ -41,6 +45,14 @@ public:
     template <typename T>
     void save(const T& data);
 
+    //! @brief Save a contiguous sequence of arithmetic values as an array.
+    template <typename T>
+    void save_values(const T *data, std::size_t size);
+
+    //! @brief Save data as an object described by a schema.
+    template <typename T, typename... Fields>
+    void save(const T& data, const basic_schema<T, value_type, Fields...>& schema);
+
     template<typename T>
     void save_override(const T& data);
 
@@ -0,0 +1,44 @@
+#ifndef TRIAL_PROTOCOL_JSON_SERIALIZATION_SCHEMA_HPP
+#define TRIAL_PROTOCOL_JSON_SERIALIZATION_SCHEMA_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <type_traits>
+#include <trial/protocol/json/schema.hpp>
+#include <trial/protocol/json/serialization/serialization.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace serialization
+{
+
+// Types with json::schema_traits are saved as objects
+
+template <typename CharT, typename T>
+struct save_overloader< json::basic_oarchive<CharT>,
+                        T,
+                        typename std::enable_if<json::detail::has_schema<T>::value>::type >
+{
+    static void save(json::basic_oarchive<CharT>& archive,
+                     const T& data,
+                     const unsigned int)
+    {
+        archive.save(data, json::schema_traits<T>::get());
+    }
+};
+
+} // namespace serialization
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_SERIALIZATION_SCHEMA_HPP
@@ -11,6 +11,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <type_traits>
 #include <trial/protocol/json/serialization/serialization.hpp>
 #include <trial/protocol/core/serialization/std/vector.hpp>
 
@@ -28,6 +29,24 @@ struct save_overloader< json::basic_oarchive<CharT>,
     static void save(json::basic_oarchive<CharT>& archive,
                      const std::vector<T, Allocator>& data,
                      const unsigned int protocol_version)
+    {
+        save(archive, data, protocol_version, std::is_arithmetic<T>{});
+    }
+
+private:
+    // Arrays of numbers are saved in a single pass
+    static void save(json::basic_oarchive<CharT>& archive,
+                     const std::vector<T, Allocator>& data,
+                     const unsigned int,
+                     std::true_type)
+    {
+        archive.save_values(data.data(), data.size());
+    }
+
+    static void save(json::basic_oarchive<CharT>& archive,
+                     const std::vector<T, Allocator>& data,
+                     const unsigned int protocol_version,
+                     std::false_type)
     {
         archive.template save<json::token::begin_array>();
         for (typename std::vector<T, Allocator>::const_iterator it = data.begin();
@@ -47,6 +66,24 @@ struct load_overloader< json::basic_iarchive<CharT>,
     static void load(json::basic_iarchive<CharT>& archive,
                      std::vector<T, Allocator>& data,
                      const unsigned int protocol_version)
+    {
+        load(archive, data, protocol_version, std::is_arithmetic<T>{});
+    }
+
+private:
+    // Arrays of numbers are loaded in a single pass
+    static void load(json::basic_iarchive<CharT>& archive,
+                     std::vector<T, Allocator>& data,
+                     const unsigned int,
+                     std::true_type)
+    {
+        archive.load_values(data);
+    }
+
+    static void load(json::basic_iarchive<CharT>& archive,
+                     std::vector<T, Allocator>& data,
+                     const unsigned int protocol_version,
+                     std::false_type)
     {
         archive.template load<json::token::begin_array>();
         while (!archive.template at<json::token::end_array>())
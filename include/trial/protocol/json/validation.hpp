@@ -0,0 +1,38 @@
+#ifndef TRIAL_PROTOCOL_JSON_VALIDATION_HPP
+#define TRIAL_PROTOCOL_JSON_VALIDATION_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+//! @brief Validation of the input during parsing.
+enum class validation
+{
+    //! The input is checked against the JSON grammar, and malformed input
+    //! is reported as an error.
+    strict,
+    //! The input is assumed to be well-formed, for instance because it was
+    //! generated by json::writer. String content and number grammar are not
+    //! validated. Malformed input gives unspecified tokens, but parsing
+    //! never reads outside the input.
+    trusted
+};
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_VALIDATION_HPP
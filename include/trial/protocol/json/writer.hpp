@@ -53,9 +53,33 @@ public:
     template <typename T>
     size_type value(T&& value);
 
+    //! @brief Write an array of values.
+    //!
+    //! The array is written as a single value in the current scope. The
+    //! elements and separators are formatted in bulk.
+    //!
+    //! @param[in] data Pointer to the first element.
+    //! @param[in] size Number of elements.
+    template <typename T>
+    size_type values(const T *data, size_type size);
+
+    //! @brief Write data output without a separator.
+    //!
+    //! The value is not counted in the current scope, so it must be placed
+    //! between raw outputs that contain the surrounding separators, such as
+    //! pre-rendered object keys.
+    template <typename T>
+    size_type bare_value(T&& value);
+
     //! @brief Write raw output.
     size_type literal(const view_type&) BOOST_NOEXCEPT;
 
+    //! @brief Write raw output as a value.
+    //!
+    //! Separators are written as for other values, so the raw output must be
+    //! a single encoded value, such as a view returned by partial::skip().
+    size_type literal_value(const view_type&);
+
 #ifndef BOOST_DOXYGEN_INVOKED
 private:
     void validate_scope();
@@ -0,0 +1,347 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include <trial/protocol/buffer/vector.hpp>
+#include <trial/protocol/bintoken/reader.hpp>
+#include <trial/protocol/bintoken/writer.hpp>
+#include <trial/protocol/bintoken/block_reader.hpp>
+#include <trial/protocol/bintoken/block_writer.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+namespace token = bintoken::token;
+using value_type = bintoken::reader::value_type;
+
+//-----------------------------------------------------------------------------
+// Compression
+//-----------------------------------------------------------------------------
+
+namespace lz_suite
+{
+
+std::vector<value_type> round_trip(const std::vector<value_type>& input)
+{
+    std::vector<value_type> compressed;
+    bintoken::detail::lz::compress(input.data(), input.size(), compressed);
+    std::vector<value_type> output(input.size());
+    const auto size = bintoken::detail::lz::decompress(compressed.data(),
+                                                      compressed.size(),
+                                                      output.data(),
+                                                      output.size());
+    TRIAL_PROTOCOL_TEST_EQUAL(size, input.size());
+    return output;
+}
+
+void test_empty()
+{
+    std::vector<value_type> input;
+    std::vector<value_type> compressed;
+    bintoken::detail::lz::compress(input.data(), input.size(), compressed);
+    TRIAL_PROTOCOL_TEST_EQUAL(compressed.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(compressed[0], 0x00);
+}
+
+void test_literals()
+{
+    std::vector<value_type> input = { 'a', 'b', 'c' };
+    std::vector<value_type> compressed;
+    bintoken::detail::lz::compress(input.data(), input.size(), compressed);
+    std::vector<value_type> expected = { 0x30, 'a', 'b', 'c' };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(compressed.begin(), compressed.end(),
+                                 expected.begin(), expected.end(),
+                                 std::equal_to<value_type>());
+}
+
+void test_overlapping_match()
+{
+    std::vector<value_type> input(1000, 'x');
+    std::vector<value_type> compressed;
+    bintoken::detail::lz::compress(input.data(), input.size(), compressed);
+    TRIAL_PROTOCOL_TEST(compressed.size() < 16);
+    auto output = round_trip(input);
+    TRIAL_PROTOCOL_TEST_ALL_WITH(output.begin(), output.end(),
+                                 input.begin(), input.end(),
+                                 std::equal_to<value_type>());
+}
+
+void test_pseudo_random()
+{
+    std::vector<value_type> input;
+    std::uint32_t state = 1;
+    for (int i = 0; i < 100000; ++i)
+    {
+        state = state * 1103515245 + 12345;
+        // Mixture of short runs and noise
+        input.push_back(value_type((i % 64 < 32) ? (i % 5) : (state >> 16)));
+    }
+    auto output = round_trip(input);
+    TRIAL_PROTOCOL_TEST_ALL_WITH(output.begin(), output.end(),
+                                 input.begin(), input.end(),
+                                 std::equal_to<value_type>());
+}
+
+void fail_bad_offset()
+{
+    // Match refers before the beginning of the output
+    std::vector<value_type> input = { 0x10, 'a', 0x02, 0x00 };
+    std::vector<value_type> output(16);
+    TRIAL_PROTOCOL_TEST_EQUAL(bintoken::detail::lz::decompress(input.data(),
+                                                               input.size(),
+                                                               output.data(),
+                                                               output.size()),
+                              0);
+}
+
+void fail_output_too_small()
+{
+    std::vector<value_type> input = { 0x30, 'a', 'b', 'c' };
+    std::vector<value_type> output(2);
+    TRIAL_PROTOCOL_TEST_EQUAL(bintoken::detail::lz::decompress(input.data(),
+                                                               input.size(),
+                                                               output.data(),
+                                                               output.size()),
+                              0);
+}
+
+void run()
+{
+    test_empty();
+    test_literals();
+    test_overlapping_match();
+    test_pseudo_random();
+    fail_bad_offset();
+    fail_output_too_small();
+}
+
+} // namespace lz_suite
+
+//-----------------------------------------------------------------------------
+// Blocks
+//-----------------------------------------------------------------------------
+
+namespace block_suite
+{
+
+std::vector<value_type> make_block(int first, int count)
+{
+    std::vector<value_type> result;
+    bintoken::writer writer(result);
+    writer.value<token::begin_array>();
+    for (int i = first; i < first + count; ++i)
+    {
+        writer.value<token::begin_record>();
+        writer.value(i);
+        writer.value("alpha bravo charlie");
+        writer.value<token::end_record>();
+    }
+    writer.value<token::end_array>();
+    return result;
+}
+
+void test_empty()
+{
+    std::vector<value_type> output;
+    {
+        bintoken::block_writer writer(output);
+        writer.close();
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(output.size(), 16);
+    bintoken::block_reader reader(output);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.size(), 0);
+}
+
+void test_close_on_destruction()
+{
+    std::vector<value_type> output;
+    {
+        bintoken::block_writer writer(output);
+        writer.write(make_block(0, 1));
+    }
+    bintoken::block_reader reader(output);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.size(), 1);
+}
+
+void test_compressed()
+{
+    const auto input = make_block(0, 100);
+    std::vector<value_type> output;
+    {
+        bintoken::block_writer writer(output);
+        TRIAL_PROTOCOL_TEST_EQUAL(writer.write(input), 0);
+    }
+    TRIAL_PROTOCOL_TEST(output.size() < input.size() / 2);
+
+    bintoken::block_reader reader(output);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.length(0), input.size());
+    std::vector<value_type> block;
+    reader.read(0, block);
+    TRIAL_PROTOCOL_TEST_ALL_WITH(block.begin(), block.end(),
+                                 input.begin(), input.end(),
+                                 std::equal_to<value_type>());
+}
+
+void test_stored()
+{
+    const std::vector<value_type> input = { token::code::true_value };
+    std::vector<value_type> output;
+    {
+        bintoken::block_writer writer(output);
+        writer.write(input);
+    }
+    // Header and payload, index entry, footer
+    TRIAL_PROTOCOL_TEST_EQUAL(output.size(), 13 + 1 + 8 + 16);
+    TRIAL_PROTOCOL_TEST_EQUAL(output[0], 0x00);
+
+    bintoken::block_reader reader(output);
+    std::vector<value_type> block;
+    reader.read(0, block);
+    bintoken::reader tokens(block);
+    TRIAL_PROTOCOL_TEST_EQUAL(tokens.code(), token::code::true_value);
+}
+
+void test_seek()
+{
+    std::vector<value_type> output;
+    {
+        bintoken::block_writer writer(output);
+        for (int i = 0; i < 8; ++i)
+        {
+            writer.write(make_block(i * 10, 10));
+        }
+        TRIAL_PROTOCOL_TEST_EQUAL(writer.size(), 8);
+    }
+
+    bintoken::block_reader reader(output);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.size(), 8);
+    std::vector<value_type> block;
+    for (int i : { 5, 2, 7, 0 })
+    {
+        reader.read(i, block);
+        bintoken::reader tokens(block);
+        TRIAL_PROTOCOL_TEST_EQUAL(tokens.code(), token::code::begin_array);
+        TRIAL_PROTOCOL_TEST(tokens.next());
+        TRIAL_PROTOCOL_TEST_EQUAL(tokens.code(), token::code::begin_record);
+        TRIAL_PROTOCOL_TEST(tokens.next());
+        TRIAL_PROTOCOL_TEST_EQUAL(tokens.value<int>(), i * 10);
+    }
+}
+
+void fail_write_after_close()
+{
+    std::vector<value_type> output;
+    bintoken::block_writer writer(output);
+    writer.close();
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(writer.write(make_block(0, 1)),
+                                    bintoken::error,
+                                    "invalid value");
+}
+
+void fail_checksum()
+{
+    std::vector<value_type> output;
+    {
+        bintoken::block_writer writer(output);
+        writer.write(std::vector<value_type>{ token::code::true_value });
+    }
+    output[13] = token::code::false_value;
+    bintoken::block_reader reader(output);
+    std::vector<value_type> block;
+    std::error_code ec;
+    reader.read(0, block, ec);
+    TRIAL_PROTOCOL_TEST(ec == bintoken::invalid_checksum);
+}
+
+void fail_corrupt_payload()
+{
+    std::vector<value_type> output;
+    {
+        bintoken::block_writer writer(output);
+        writer.write(make_block(0, 100));
+    }
+    output[14] ^= 0xFF;
+    bintoken::block_reader reader(output);
+    std::vector<value_type> block;
+    std::error_code ec;
+    reader.read(0, block, ec);
+    TRIAL_PROTOCOL_TEST(ec);
+}
+
+void fail_magic()
+{
+    std::vector<value_type> output;
+    {
+        bintoken::block_writer writer(output);
+    }
+    output.back() = 0;
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(bintoken::block_reader reader(output),
+                                    bintoken::error,
+                                    "invalid value");
+}
+
+void fail_truncated()
+{
+    std::vector<value_type> output;
+    {
+        bintoken::block_writer writer(output);
+        writer.write(make_block(0, 10));
+    }
+    output.erase(output.begin(), output.begin() + 1);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(bintoken::block_reader reader(output),
+                                    bintoken::error,
+                                    "invalid length");
+}
+
+void fail_index()
+{
+    std::vector<value_type> output;
+    {
+        bintoken::block_writer writer(output);
+        writer.write(make_block(0, 1));
+    }
+    bintoken::block_reader reader(output);
+    std::vector<value_type> block;
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(reader.read(1, block),
+                                    bintoken::error,
+                                    "invalid value");
+}
+
+void run()
+{
+    test_empty();
+    test_close_on_destruction();
+    test_compressed();
+    test_stored();
+    test_seek();
+    fail_write_after_close();
+    fail_checksum();
+    fail_corrupt_payload();
+    fail_magic();
+    fail_truncated();
+    fail_index();
+}
+
+} // namespace block_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    lz_suite::run();
+    block_suite::run();
+
+    return boost::report_errors();
+}
@@ -68,12 +68,24 @@ void test_true()
     TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::end);
 }
 
+void test_padding()
+{
+    const value_type input[] = { token::code::padding, token::code::padding,
+                                 token::code::null,
+                                 token::code::padding };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::null);
+    decoder.next();
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::end);
+}
+
 void run()
 {
     test_empty();
     test_null();
     test_false();
     test_true();
+    test_padding();
 }
 
 } // namespace basic_suite
@@ -4437,6 +4449,253 @@ void run()
 
 } // namespace compact_float64_suite
 
+//-----------------------------------------------------------------------------
+// Variable-length integers
+//-----------------------------------------------------------------------------
+
+namespace varint_suite
+{
+
+void test_zero()
+{
+    const value_type input[] = { token::code::varint, 0x00 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::varint);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.symbol(), token::symbol::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<token::varint>(), 0);
+    decoder.next();
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::end);
+}
+
+void test_minus_one()
+{
+    const value_type input[] = { token::code::varint, 0x01 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::varint);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<token::varint>(), -1);
+}
+
+void test_300()
+{
+    const value_type input[] = { token::code::varint, 0xD8, 0x04 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::varint);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.literal().size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<token::varint>(), 300);
+}
+
+void test_max()
+{
+    const value_type input[] = { token::code::varint,
+                                 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::varint);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<token::varint>(), std::numeric_limits<std::int64_t>::max());
+}
+
+void test_min()
+{
+    const value_type input[] = { token::code::varint,
+                                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::varint);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<token::varint>(), std::numeric_limits<std::int64_t>::min());
+}
+
+void fail_truncated()
+{
+    const value_type input[] = { token::code::varint, 0x80 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::end);
+}
+
+void fail_too_long()
+{
+    const value_type input[] = { token::code::varint,
+                                 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::error_overflow);
+}
+
+void test_delta_array()
+{
+    const value_type input[] = { token::code::delta_array, 0x05,
+                                 0x03, 0xC8, 0x01, 0x02, 0x04 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::delta_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.symbol(), token::symbol::array);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.delta_length(), 3);
+    std::int32_t output[3] = {};
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.delta_array(output, 3), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(output[0], 100);
+    TRIAL_PROTOCOL_TEST_EQUAL(output[1], 101);
+    TRIAL_PROTOCOL_TEST_EQUAL(output[2], 103);
+    decoder.next();
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::end);
+}
+
+void test_delta_array_empty()
+{
+    const value_type input[] = { token::code::delta_array, 0x01, 0x00 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::delta_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.delta_length(), 0);
+}
+
+void fail_delta_array_overflow()
+{
+    const value_type input[] = { token::code::delta_array, 0x03,
+                                 0x01, 0x80, 0x02 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::delta_array);
+    std::int8_t output[1] = {};
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(decoder.delta_array(output, 1),
+                                    format::error, "overflow");
+}
+
+void fail_delta_array_count()
+{
+    const value_type input[] = { token::code::delta_array, 0x02,
+                                 0x05, 0x00 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::error_invalid_length);
+}
+
+void fail_delta_array_truncated()
+{
+    const value_type input[] = { token::code::delta_array, 0x05,
+                                 0x03, 0xC8, 0x01 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::end);
+}
+
+void run()
+{
+    test_zero();
+    test_minus_one();
+    test_300();
+    test_max();
+    test_min();
+    fail_truncated();
+    fail_too_long();
+    test_delta_array();
+    test_delta_array_empty();
+    fail_delta_array_overflow();
+    fail_delta_array_count();
+    fail_delta_array_truncated();
+}
+
+} // namespace varint_suite
+
+//-----------------------------------------------------------------------------
+// Length-prefixed containers
+//-----------------------------------------------------------------------------
+
+namespace prefix_suite
+{
+
+void test_record()
+{
+    const value_type input[] = { token::code::length8, 3,
+                                 token::code::begin_record,
+                                 token::code::null,
+                                 token::code::end_record };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::begin_record);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.literal().size(), 2);
+    decoder.next();
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::null);
+    decoder.next();
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::end_record);
+    decoder.next();
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::end);
+}
+
+void test_array16()
+{
+    const value_type input[] = { token::code::length16, 0x02, 0x00,
+                                 token::code::begin_array,
+                                 token::code::end_array };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.literal().size(), 1);
+    decoder.next();
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::end_array);
+}
+
+void test_assoc_array_skip()
+{
+    const value_type input[] = { token::code::length32, 0x04, 0x00, 0x00, 0x00,
+                                 token::code::begin_assoc_array,
+                                 0x01, 0x02,
+                                 token::code::end_assoc_array,
+                                 token::code::true_value };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::begin_assoc_array);
+    decoder.skip();
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::true_value);
+    decoder.next();
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::end);
+}
+
+void fail_missing_length()
+{
+    const value_type input[] = { token::code::length16, 0x02 };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::end);
+}
+
+void fail_too_short()
+{
+    const value_type input[] = { token::code::length8, 1,
+                                 token::code::begin_record,
+                                 token::code::end_record };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::error_invalid_length);
+}
+
+void fail_truncated()
+{
+    const value_type input[] = { token::code::length8, 3,
+                                 token::code::begin_record,
+                                 token::code::end_record };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::end);
+}
+
+void fail_mismatched_end()
+{
+    const value_type input[] = { token::code::length8, 3,
+                                 token::code::begin_record,
+                                 token::code::null,
+                                 token::code::end_array };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::error_invalid_length);
+}
+
+void fail_not_container()
+{
+    const value_type input[] = { token::code::length8, 2,
+                                 token::code::null,
+                                 token::code::end_record };
+    format::detail::decoder decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::error_unexpected_token);
+}
+
+void run()
+{
+    test_record();
+    test_array16();
+    test_assoc_array_skip();
+    fail_missing_length();
+    fail_too_short();
+    fail_truncated();
+    fail_mismatched_end();
+    fail_not_container();
+}
+
+} // namespace prefix_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -4462,6 +4721,8 @@ int main()
     compact_int64_suite::run();
     compact_float32_suite::run();
     compact_float64_suite::run();
+    varint_suite::run();
+    prefix_suite::run();
 
     return boost::report_errors();
 }
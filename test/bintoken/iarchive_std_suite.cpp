@@ -695,6 +695,68 @@ void test_float64()
     TRIAL_PROTOCOL_TEST_EQUAL(value[3], 3.0);
 }
 
+void test_char()
+{
+    const value_type input[] = { token::code::array8_int8, 2 * token::int8::size,
+                                 0x41,
+                                 0x42 };
+    format::iarchive in(input);
+    std::vector<char> value;
+    TRIAL_PROTOCOL_TEST_NO_THROW(in >> value);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[0], 'A');
+    TRIAL_PROTOCOL_TEST_EQUAL(value[1], 'B');
+}
+
+void test_long_long()
+{
+    const value_type input[] = { token::code::array8_int64, 2 * token::int64::size,
+                                 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    format::iarchive in(input);
+    std::vector<long long> value;
+    TRIAL_PROTOCOL_TEST_NO_THROW(in >> value);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[0], 1LL);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[1], -1LL);
+}
+
+void test_unsigned_long_long()
+{
+    const value_type input[] = { token::code::array8_int64, 2 * token::int64::size,
+                                 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    format::iarchive in(input);
+    std::vector<unsigned long long> value;
+    TRIAL_PROTOCOL_TEST_NO_THROW(in >> value);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[0], 1ULL);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[1], 0xFFFFFFFFFFFFFFFFULL);
+}
+
+void fail_int32_from_int16()
+{
+    const value_type input[] = { token::code::array8_int16, 2 * token::int16::size,
+                                 0x01, 0x00,
+                                 0x02, 0x00 };
+    format::iarchive in(input);
+    std::vector<std::int32_t> value;
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(in >> value,
+                                    format::error, "incompatible type");
+}
+
+void fail_float64_from_begin_array()
+{
+    const value_type input[] = { token::code::begin_array,
+                                 0x01,
+                                 token::code::float64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F,
+                                 token::code::end_array };
+    format::iarchive in(input);
+    std::vector<token::float64::type> value;
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(in >> value,
+                                    format::error, "incompatible type");
+}
+
 void run()
 {
     test_empty();
@@ -708,6 +770,11 @@ void run()
     test_uint64();
     test_float32();
     test_float64();
+    test_char();
+    test_long_long();
+    test_unsigned_long_long();
+    fail_int32_from_int16();
+    fail_float64_from_begin_array();
 }
 
 } // namespace compact_vector_suite
@@ -618,6 +618,86 @@ void test_float64_empty()
                                  std::equal_to<output_type>());
 }
 
+void test_float64_many()
+{
+    std::vector<output_type> result;
+    format::oarchive ar(result);
+    std::vector<token::float64::type> value{ 1.0, 2.0 };
+    ar << value;
+
+    output_type expected[] = { token::code::array8_float64, 2 * token::float64::size,
+                               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F,
+                               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40 };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
+void test_float64_big()
+{
+    std::vector<output_type> result;
+    format::oarchive ar(result);
+    std::vector<token::float64::type> value(0x100, 1.0);
+    ar << value;
+
+    std::vector<output_type> expected{{token::code::array16_float64, 0x00, 0x08}};
+    for (std::vector<output_type>::size_type i = 0; i < value.size(); ++i)
+    {
+        for (auto byte : { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F })
+        {
+            expected.push_back(byte);
+        }
+    }
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected.begin(), expected.end(),
+                                 std::equal_to<output_type>());
+}
+
+//-----------------------------------------------------------------------------
+
+void test_char_many()
+{
+    std::vector<output_type> result;
+    format::oarchive ar(result);
+    std::vector<char> value{ 'A', 'B' };
+    ar << value;
+
+    output_type expected[] = { token::code::array8_int8, 0x02, 0x41, 0x42 };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
+void test_long_long_many()
+{
+    std::vector<output_type> result;
+    format::oarchive ar(result);
+    std::vector<long long> value{ 1, -1 };
+    ar << value;
+
+    output_type expected[] = { token::code::array8_int64, 2 * token::int64::size,
+                               0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                               0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
+void test_unsigned_long_long_many()
+{
+    std::vector<output_type> result;
+    format::oarchive ar(result);
+    std::vector<unsigned long long> value{ 1, 0xFFFFFFFFFFFFFFFFULL };
+    ar << value;
+
+    output_type expected[] = { token::code::array8_int64, 2 * token::int64::size,
+                               0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                               0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
 void run()
 {
     test_int8_empty();
@@ -640,6 +720,12 @@ void run()
 
     test_float32_empty();
     test_float64_empty();
+    test_float64_many();
+    test_float64_big();
+
+    test_char_many();
+    test_long_long_many();
+    test_unsigned_long_long_many();
 }
 
 } // namespace compact_vector_suite
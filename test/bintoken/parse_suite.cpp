@@ -10,6 +10,8 @@
 
 #include <trial/protocol/buffer/array.hpp>
 #include <trial/protocol/bintoken/parse.hpp>
+#include <trial/protocol/bintoken/partial/skip.hpp>
+#include <trial/dynamic/string_pool.hpp>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
 
 using namespace trial::dynamic;
@@ -97,6 +99,13 @@ void parse_integer()
         TRIAL_PROTOCOL_TEST(result.same<std::int64_t>());
         TRIAL_PROTOCOL_TEST_EQUAL(result.value<int>(), 2);
     }
+    // varint
+    {
+        const value_type input[] = { bintoken::token::code::varint, 0xD8, 0x04 };
+        auto result = bintoken::parse(input);
+        TRIAL_PROTOCOL_TEST(result.same<std::int64_t>());
+        TRIAL_PROTOCOL_TEST_EQUAL(result.value<int>(), 300);
+    }
 }
 
 void parse_real()
@@ -375,6 +384,18 @@ void parse_compact_array()
                                      expected.begin(), expected.end(),
                                      std::equal_to<decltype(expected)>());
     }
+    // delta_array
+    {
+        const value_type input[] = {
+            bintoken::token::code::delta_array, 0x05,
+            0x03, 0x82, 0x01, 0x02, 0x02 };
+        auto result = bintoken::parse(input);
+        TRIAL_PROTOCOL_TEST(result.is<array>());
+        const auto expected = array::make({ 0x41, 0x42, 0x43 });
+        TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                     expected.begin(), expected.end(),
+                                     std::equal_to<decltype(expected)>());
+    }
 }
 
 void parse_record()
@@ -653,6 +674,91 @@ void parse_assoc_array_nested_assoc_array()
                                  std::equal_to<decltype(expected)>());
 }
 
+void parse_assoc_array_pool()
+{
+    const value_type input[] = {
+        bintoken::token::code::begin_assoc_array,
+        bintoken::token::code::string8, 0x03, 0x41, 0x42, 0x43,
+        bintoken::token::code::begin_assoc_array,
+        bintoken::token::code::string8, 0x03, 0x41, 0x42, 0x43,
+        bintoken::token::code::int16, 0x7F, 0x00,
+        bintoken::token::code::end_assoc_array,
+        bintoken::token::code::end_assoc_array
+    };
+    string_pool pool;
+    auto result = bintoken::parse(input, pool);
+    TRIAL_PROTOCOL_TEST(result.is<map>());
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 1);
+    const auto expected = shared_map::make({ "ABC", shared_map::make({ "ABC", 127 }) });
+    TRIAL_PROTOCOL_TEST(result == expected);
+
+    // Keys share storage with pool
+    const auto& outer = (*result.key_begin()).assume_value<std::string>();
+    const auto& inner = (*result["ABC"].key_begin()).assume_value<std::string>();
+    TRIAL_PROTOCOL_TEST(&outer == &inner);
+    TRIAL_PROTOCOL_TEST(&outer == &pool.intern(std::string("ABC")).assume_value<std::string>());
+}
+
+void parse_compact_array_real()
+{
+    {
+        const value_type input[] = {
+            bintoken::token::code::array8_float32, 0x08,
+            0x00, 0x00, 0x80, 0x3F,
+            0x00, 0x00, 0x00, 0xC0
+        };
+        auto result = bintoken::parse(input);
+        TRIAL_PROTOCOL_TEST(result.is<array>());
+        const auto expected = array::make({ 1.0f, -2.0f });
+        TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                     expected.begin(), expected.end(),
+                                     std::equal_to<decltype(expected)>());
+    }
+    {
+        const value_type input[] = {
+            bintoken::token::code::array8_float64, 0x08,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F
+        };
+        auto result = bintoken::parse(input);
+        TRIAL_PROTOCOL_TEST(result.is<array>());
+        const auto expected = array::make({ 1.0 });
+        TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                     expected.begin(), expected.end(),
+                                     std::equal_to<decltype(expected)>());
+    }
+}
+
+void parse_array_nested_compact_array()
+{
+    const value_type input[] = {
+        bintoken::token::code::begin_array,
+        bintoken::token::code::array8_int8, 0x02, 0x41, 0x42,
+        bintoken::token::code::null,
+        bintoken::token::code::end_array
+    };
+    auto result = bintoken::parse(input);
+    TRIAL_PROTOCOL_TEST(result.is<array>());
+    const auto expected = array::make({ array::make({ 0x41, 0x42 }), null });
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected.begin(), expected.end(),
+                                 std::equal_to<decltype(expected)>());
+}
+
+void parse_assoc_array_nested_compact_array()
+{
+    const value_type input[] = {
+        bintoken::token::code::begin_assoc_array,
+        bintoken::token::code::string8, 0x01, 0x41,
+        bintoken::token::code::array8_int8, 0x02, 0x41, 0x42,
+        bintoken::token::code::end_assoc_array
+    };
+    auto result = bintoken::parse(input);
+    TRIAL_PROTOCOL_TEST(result.is<map>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 1);
+    const auto expected = array::make({ 0x41, 0x42 });
+    TRIAL_PROTOCOL_TEST(result["A"] == expected);
+}
+
 void run()
 {
     parse_empty();
@@ -663,6 +769,7 @@ void run()
     parse_real();
     parse_string();
     parse_compact_array();
+    parse_compact_array_real();
     parse_record();
     parse_record_nested_record();
     parse_record_nested_array();
@@ -671,10 +778,13 @@ void run()
     parse_array_nested_record();
     parse_array_nested_array();
     parse_array_nested_assoc_array();
+    parse_array_nested_compact_array();
     parse_assoc_array();
     parse_assoc_array_nested_record();
     parse_assoc_array_nested_array();
     parse_assoc_array_nested_assoc_array();
+    parse_assoc_array_nested_compact_array();
+    parse_assoc_array_pool();
 }
 
 } // namespace parser_suite
@@ -684,9 +794,117 @@ void run()
 namespace partial_suite
 {
 
+void parse_nested_value()
+{
+    const value_type input[] = {
+        bintoken::token::code::begin_array,
+        bintoken::token::code::int16, 0x7F, 0x00,
+        bintoken::token::code::null,
+        bintoken::token::code::end_array
+    };
+    bintoken::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    auto result = bintoken::partial::parse(reader);
+    TRIAL_PROTOCOL_TEST(result.is<int>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result.value<int>(), 127);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), bintoken::token::code::null);
+}
+
+void parse_nested_record()
+{
+    const value_type input[] = {
+        bintoken::token::code::begin_array,
+        bintoken::token::code::begin_record,
+        bintoken::token::code::string8, 0x03, 0x41, 0x42, 0x43,
+        bintoken::token::code::array8_int8, 0x01, 0x41,
+        bintoken::token::code::end_record,
+        bintoken::token::code::true_value,
+        bintoken::token::code::end_array
+    };
+    bintoken::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    auto result = bintoken::partial::parse(reader);
+    TRIAL_PROTOCOL_TEST(result.is<array>());
+    const auto expected = array::make({ "ABC", array::make({ 0x41 }) });
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected.begin(), expected.end(),
+                                 std::equal_to<decltype(expected)>());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), bintoken::token::code::true_value);
+}
+
+void parse_nested_prefixed_record()
+{
+    const value_type input[] = {
+        bintoken::token::code::begin_array,
+        bintoken::token::code::length8, 0x07,
+        bintoken::token::code::begin_record,
+        bintoken::token::code::string8, 0x03, 0x41, 0x42, 0x43,
+        bintoken::token::code::end_record,
+        bintoken::token::code::false_value,
+        bintoken::token::code::end_array
+    };
+    bintoken::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    auto result = bintoken::partial::parse(reader);
+    TRIAL_PROTOCOL_TEST(result.is<array>());
+    const auto expected = array::make({ "ABC" });
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected.begin(), expected.end(),
+                                 std::equal_to<decltype(expected)>());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), bintoken::token::code::false_value);
+}
+
+void parse_selected()
+{
+    // Skip the first record and decode the second
+    const value_type input[] = {
+        bintoken::token::code::begin_array,
+        bintoken::token::code::begin_record,
+        bintoken::token::code::int16, 0x7F, 0x00,
+        bintoken::token::code::end_record,
+        bintoken::token::code::begin_record,
+        bintoken::token::code::null,
+        bintoken::token::code::end_record,
+        bintoken::token::code::end_array
+    };
+    bintoken::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    bintoken::partial::skip(reader);
+    auto result = bintoken::partial::parse(reader);
+    const auto expected = array::make({ null });
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected.begin(), expected.end(),
+                                 std::equal_to<decltype(expected)>());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), bintoken::token::code::end_array);
+}
+
+void parse_skipped_view()
+{
+    // The skipped view is a self-contained subtree
+    const value_type input[] = {
+        bintoken::token::code::begin_array,
+        bintoken::token::code::begin_assoc_array,
+        bintoken::token::code::string8, 0x01, 0x41,
+        bintoken::token::code::int16, 0x7F, 0x00,
+        bintoken::token::code::end_assoc_array,
+        bintoken::token::code::end_array
+    };
+    bintoken::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    auto view = bintoken::partial::skip(reader);
+    auto result = bintoken::parse(view);
+    TRIAL_PROTOCOL_TEST(result.is<map>());
+    TRIAL_PROTOCOL_TEST(result["A"] == 127);
+}
+
 void run()
 {
-    // FIXME
+    parse_nested_value();
+    parse_nested_record();
+    parse_nested_prefixed_record();
+    parse_selected();
+    parse_skipped_view();
 }
 
 } // namespace partial_suite
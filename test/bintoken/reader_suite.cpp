@@ -10,8 +10,11 @@
 
 #include <functional>
 #include <limits>
+#include <vector>
 #include <trial/protocol/buffer/array.hpp>
+#include <trial/protocol/buffer/vector.hpp>
 #include <trial/protocol/bintoken/reader.hpp>
+#include <trial/protocol/bintoken/writer.hpp>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
 
 namespace format = trial::protocol::bintoken;
@@ -1179,6 +1182,74 @@ void fail_float64_overflow()
                                     format::error, "overflow");
 }
 
+void test_view_float64()
+{
+    // Payload at offset 8
+    alignas(token::float64::type) const value_type input[] = {
+        token::code::padding, token::code::padding, token::code::padding,
+        token::code::padding, token::code::padding, token::code::padding,
+        token::code::array8_float64, 2 * token::float64::size,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40 };
+    format::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::array8_float64);
+    auto view = reader.array_view<token::float64::type>();
+#if BOOST_ENDIAN_LITTLE_BYTE
+    TRIAL_PROTOCOL_TEST_EQUAL(view.size(), 2);
+    TRIAL_PROTOCOL_TEST(view.data() == reinterpret_cast<const token::float64::type *>(&input[8]));
+    TRIAL_PROTOCOL_TEST_EQUAL(view[0], 1.0);
+    TRIAL_PROTOCOL_TEST_EQUAL(view[1], 2.0);
+#else
+    TRIAL_PROTOCOL_TEST(view.empty());
+#endif
+}
+
+void test_view_float64_unaligned()
+{
+    // Payload at offset 3
+    alignas(token::float64::type) const value_type input[] = {
+        token::code::padding,
+        token::code::array8_float64, 1 * token::float64::size,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F };
+    format::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.array_view<token::float64::type>().empty());
+    std::array<token::float64::type, 1> buffer = {};
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.array<token::float64::type>(buffer.data(), buffer.size()), buffer.size());
+    TRIAL_PROTOCOL_TEST_EQUAL(buffer[0], 1.0);
+}
+
+void test_view_padding()
+{
+    // Writer output is read back without copying
+    std::vector<value_type> output;
+    format::writer writer(output);
+    writer.align_arrays(true);
+    writer.value(true);
+    const std::int32_t data[] = { 1, 2, 3 };
+    writer.array(data, 3);
+
+    format::reader reader(output);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::true_value);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::array8_int32);
+    auto view = reader.array_view<std::int32_t>();
+#if BOOST_ENDIAN_LITTLE_BYTE
+    TRIAL_PROTOCOL_TEST_EQUAL(view.size(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(view[0], 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(view[2], 3);
+#endif
+}
+
+void fail_view_incompatible()
+{
+    const value_type input[] = {
+        token::code::array8_int32, 1 * token::int32::size,
+        0x01, 0x00, 0x00, 0x00 };
+    format::reader reader(input);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(reader.array_view<token::float32::type>(),
+                                    format::error, "incompatible type");
+}
+
 void run()
 {
     test_int8();
@@ -1193,10 +1264,94 @@ void run()
     fail_float32_overflow();
     test_float64();
     fail_float64_overflow();
+    test_view_float64();
+    test_view_float64_unaligned();
+    test_view_padding();
+    fail_view_incompatible();
 }
 
 } // namespace compact_suite
 
+//-----------------------------------------------------------------------------
+// Variable-length integers
+//-----------------------------------------------------------------------------
+
+namespace varint_suite
+{
+
+void test_value()
+{
+    const value_type input[] = { token::code::varint, 0xD8, 0x04 };
+    format::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::varint);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.length(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 300);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<unsigned int>(), 300U);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<double>(), 300.0);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(reader.value<std::int8_t>(),
+                                    format::error, "overflow");
+}
+
+template <typename T>
+void round_trip(const std::vector<T>& data)
+{
+    std::vector<value_type> buffer;
+    format::writer writer(buffer);
+    writer.variable_integers(true);
+    writer.array(data.data(), data.size());
+    format::reader reader(buffer);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::delta_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.length(), data.size());
+    std::vector<T> result(reader.length());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.array(result.data(), result.size()), data.size());
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 data.begin(), data.end(),
+                                 std::equal_to<T>());
+}
+
+void test_delta_array()
+{
+    round_trip(std::vector<std::int32_t>{ 1000, 1001, 1003, 999, -5, -4 });
+    round_trip(std::vector<std::int64_t>{ std::numeric_limits<std::int64_t>::max(),
+                                          std::numeric_limits<std::int64_t>::max() - 1,
+                                          std::numeric_limits<std::int64_t>::min(),
+                                          std::numeric_limits<std::int64_t>::min() + 1,
+                                          std::numeric_limits<std::int64_t>::min() + 2 });
+    round_trip(std::vector<std::uint64_t>{ std::numeric_limits<std::uint64_t>::max(),
+                                           std::numeric_limits<std::uint64_t>::max() - 1,
+                                           std::numeric_limits<std::uint64_t>::max() - 2 });
+}
+
+void fail_delta_array_output_too_small()
+{
+    const value_type input[] = { token::code::delta_array, 0x05,
+                                 0x03, 0xC8, 0x01, 0x02, 0x04 };
+    format::reader reader(input);
+    std::int32_t output[2];
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(reader.array(output, 2),
+                                    format::error, "overflow");
+}
+
+void fail_delta_array_view()
+{
+    const value_type input[] = { token::code::delta_array, 0x05,
+                                 0x03, 0xC8, 0x01, 0x02, 0x04 };
+    format::reader reader(input);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(reader.array_view<std::int32_t>(),
+                                    format::error, "incompatible type");
+}
+
+void run()
+{
+    test_value();
+    test_delta_array();
+    fail_delta_array_output_too_small();
+    fail_delta_array_view();
+}
+
+} // namespace varint_suite
+
 //-----------------------------------------------------------------------------
 // Containers
 //-----------------------------------------------------------------------------
@@ -1267,11 +1422,76 @@ void test_assoc_array_empty()
     TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
 }
 
+void test_next_sibling()
+{
+    const value_type input[] = { token::code::begin_array,
+                                 token::code::begin_record,
+                                 token::code::begin_array,
+                                 token::code::end_array,
+                                 token::code::end_record,
+                                 token::code::null,
+                                 token::code::end_array };
+    format::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_record);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_sibling(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::null);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_sibling(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 0);
+}
+
+void test_next_sibling_prefixed()
+{
+    const value_type input[] = { token::code::begin_array,
+                                 token::code::length8, 4,
+                                 token::code::begin_record,
+                                 token::code::begin_array,
+                                 token::code::end_array,
+                                 token::code::end_record,
+                                 token::code::null,
+                                 token::code::end_array };
+    format::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_record);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_sibling(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::null);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 0);
+}
+
+void test_prefixed_content()
+{
+    const value_type input[] = { token::code::length8, 4,
+                                 token::code::begin_array,
+                                 0x01, 0x02,
+                                 token::code::end_array };
+    format::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 0);
+}
+
 void run()
 {
     test_record_empty();
     test_array_empty();
     test_assoc_array_empty();
+    test_next_sibling();
+    test_next_sibling_prefixed();
+    test_prefixed_content();
 }
 
 } // namespace container_suite
@@ -1286,6 +1506,7 @@ int main()
     number_suite::run();
     string_suite::run();
     compact_suite::run();
+    varint_suite::run();
     container_suite::run();
 
     return boost::report_errors();
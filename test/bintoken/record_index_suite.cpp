@@ -0,0 +1,338 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include <trial/protocol/buffer/vector.hpp>
+#include <trial/protocol/bintoken/reader.hpp>
+#include <trial/protocol/bintoken/writer.hpp>
+#include <trial/protocol/bintoken/record_index.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+namespace token = bintoken::token;
+using value_type = bintoken::reader::value_type;
+
+//-----------------------------------------------------------------------------
+// Writer
+//-----------------------------------------------------------------------------
+
+namespace writer_suite
+{
+
+void write_empty()
+{
+    std::vector<value_type> output;
+    bintoken::writer writer(output);
+    writer.index_values(true);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.write_index(), 25);
+    std::vector<value_type> expected = {
+        token::code::index,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00,
+        0x42, 0x54, 0x49, 0x58 };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(output.begin(), output.end(),
+                                 expected.begin(), expected.end(),
+                                 std::equal_to<value_type>());
+}
+
+void write_values()
+{
+    std::vector<value_type> output;
+    bintoken::writer writer(output);
+    writer.index_values(true);
+    writer.value(true);
+    writer.value<token::begin_array>();
+    writer.value(false);
+    writer.value<token::end_array>();
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.write_index(), 41);
+    std::vector<value_type> expected = {
+        token::code::true_value,
+        token::code::begin_array,
+        token::code::false_value,
+        token::code::end_array,
+        token::code::index,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00,
+        0x42, 0x54, 0x49, 0x58 };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(output.begin(), output.end(),
+                                 expected.begin(), expected.end(),
+                                 std::equal_to<value_type>());
+}
+
+void write_unindexed()
+{
+    std::vector<value_type> output;
+    bintoken::writer writer(output);
+    writer.value(true);
+    writer.index_values(true);
+    writer.value(false);
+    writer.write_index();
+    bintoken::record_index index(output);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.offset(0), 1);
+}
+
+void fail_open_container()
+{
+    std::vector<value_type> output;
+    bintoken::writer writer(output);
+    writer.index_values(true);
+    writer.value<token::begin_record>();
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(writer.write_index(),
+                                    bintoken::error,
+                                    "unexpected token");
+}
+
+void fail_key_without_value()
+{
+    std::vector<value_type> output;
+    bintoken::writer writer(output);
+    writer.index_values(true);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(writer.index_key(1),
+                                    bintoken::error,
+                                    "invalid value");
+}
+
+void run()
+{
+    write_empty();
+    write_values();
+    write_unindexed();
+    fail_open_container();
+    fail_key_without_value();
+}
+
+} // namespace writer_suite
+
+//-----------------------------------------------------------------------------
+// Index
+//-----------------------------------------------------------------------------
+
+namespace index_suite
+{
+
+std::vector<value_type> make_records(bool keyed, bool prefixed)
+{
+    std::vector<value_type> output;
+    bintoken::writer writer(output);
+    writer.prefix_containers(prefixed);
+    writer.index_values(true);
+    for (int i = 0; i < 4; ++i)
+    {
+        writer.value<token::begin_record>();
+        writer.value(i);
+        writer.value("alpha");
+        writer.value<token::end_record>();
+        if (keyed)
+        {
+            writer.index_key(100 + i);
+        }
+    }
+    writer.write_index();
+    return output;
+}
+
+void test_offsets()
+{
+    auto input = make_records(false, false);
+    bintoken::record_index index(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.size(), 4);
+    TRIAL_PROTOCOL_TEST(!index.has_keys());
+    TRIAL_PROTOCOL_TEST_EQUAL(index.offset(0), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.offset(1), 10);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.offset(2), 20);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.offset(3), 30);
+    TRIAL_PROTOCOL_TEST_EQUAL(input[index.offset(3)], token::code::begin_record);
+}
+
+void test_keys()
+{
+    auto input = make_records(true, false);
+    bintoken::record_index index(input);
+    TRIAL_PROTOCOL_TEST(index.has_keys());
+    TRIAL_PROTOCOL_TEST_EQUAL(index.key(0), 100);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.key(3), 103);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.find(102), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.find(42), index.size());
+}
+
+void test_partial_keys()
+{
+    std::vector<value_type> output;
+    bintoken::writer writer(output);
+    writer.index_values(true);
+    writer.value(true);
+    writer.value(false);
+    writer.index_key(-1);
+    writer.value<token::null>();
+    writer.write_index();
+    bintoken::record_index index(output);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.size(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.key(0), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.key(1), -1);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.key(2), 0);
+}
+
+void test_prefixed()
+{
+    auto input = make_records(false, true);
+    bintoken::record_index index(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.size(), 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(index.offset(1), 12);
+    TRIAL_PROTOCOL_TEST_EQUAL(input[index.offset(1)], token::code::length8);
+}
+
+void fail_missing_footer()
+{
+    std::vector<value_type> input(32, token::code::null);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(bintoken::record_index index(input),
+                                    bintoken::error,
+                                    "invalid value");
+}
+
+void fail_truncated()
+{
+    auto input = make_records(false, false);
+    input.erase(input.begin(), input.begin() + 1);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(bintoken::record_index index(input),
+                                    bintoken::error,
+                                    "invalid length");
+}
+
+void fail_ordinal()
+{
+    auto input = make_records(false, false);
+    bintoken::record_index index(input);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(index.offset(4),
+                                    bintoken::error,
+                                    "invalid value");
+}
+
+void fail_key_without_keys()
+{
+    auto input = make_records(false, false);
+    bintoken::record_index index(input);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(index.key(0),
+                                    bintoken::error,
+                                    "incompatible type");
+}
+
+void run()
+{
+    test_offsets();
+    test_keys();
+    test_partial_keys();
+    test_prefixed();
+    fail_missing_footer();
+    fail_truncated();
+    fail_ordinal();
+    fail_key_without_keys();
+}
+
+} // namespace index_suite
+
+//-----------------------------------------------------------------------------
+// Reader
+//-----------------------------------------------------------------------------
+
+namespace reader_suite
+{
+
+void test_end_at_footer()
+{
+    std::vector<value_type> output;
+    bintoken::writer writer(output);
+    writer.index_values(true);
+    writer.value(true);
+    writer.write_index();
+
+    bintoken::reader reader(output);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::true_value);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void test_seek()
+{
+    auto input = index_suite::make_records(false, false);
+    bintoken::reader reader(input, 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_record);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 2);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "alpha");
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_record);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_record);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 3);
+}
+
+void test_seek_last()
+{
+    auto input = index_suite::make_records(false, false);
+    bintoken::reader reader(input, 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_record);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_record);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void test_seek_prefixed()
+{
+    auto input = index_suite::make_records(false, true);
+    bintoken::reader reader(input, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_record);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 1);
+}
+
+void fail_seek()
+{
+    auto input = index_suite::make_records(false, false);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(bintoken::reader reader(input, 4),
+                                    bintoken::error,
+                                    "invalid value");
+}
+
+void run()
+{
+    test_end_at_footer();
+    test_seek();
+    test_seek_last();
+    test_seek_prefixed();
+    fail_seek();
+}
+
+} // namespace reader_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    writer_suite::run();
+    index_suite::run();
+    reader_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,215 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <functional>
+#include <vector>
+#include <trial/protocol/buffer/array.hpp>
+#include <trial/protocol/buffer/vector.hpp>
+#include <trial/protocol/bintoken/writer.hpp>
+#include <trial/protocol/bintoken/partial/skip.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+namespace token = bintoken::token;
+using value_type = bintoken::reader::value_type;
+
+//-----------------------------------------------------------------------------
+// Delimited containers
+//-----------------------------------------------------------------------------
+
+namespace delimited_suite
+{
+
+void test_one_primitive()
+{
+    const value_type input[] = { token::code::int16, 0x00, 0x01 };
+    bintoken::reader reader(input);
+    auto skipped = bintoken::partial::skip(reader);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void test_one_record()
+{
+    const value_type input[] = { token::code::begin_record,
+                                 token::code::null,
+                                 token::code::end_record };
+    bintoken::reader reader(input);
+    auto skipped = bintoken::partial::skip(reader);
+    TRIAL_PROTOCOL_TEST_ALL_WITH(skipped.begin(), skipped.end(),
+                                 input, input + sizeof(input),
+                                 std::equal_to<value_type>());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void test_nested()
+{
+    const value_type input[] = { token::code::begin_array,
+                                 token::code::begin_array,
+                                 token::code::begin_assoc_array,
+                                 0x01, 0x02,
+                                 token::code::end_assoc_array,
+                                 token::code::begin_record,
+                                 token::code::end_record,
+                                 token::code::end_array,
+                                 token::code::true_value,
+                                 token::code::end_array };
+    bintoken::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_array);
+    auto skipped = bintoken::partial::skip(reader);
+    TRIAL_PROTOCOL_TEST_ALL_WITH(skipped.begin(), skipped.end(),
+                                 input + 1, input + 9,
+                                 std::equal_to<value_type>());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::true_value);
+    skipped = bintoken::partial::skip(reader);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+    TRIAL_PROTOCOL_TEST(!reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 0);
+}
+
+void fail_end_token()
+{
+    const value_type input[] = { token::code::end_array };
+    bintoken::reader reader(input);
+    std::error_code ec;
+    bintoken::partial::skip(reader, ec);
+    TRIAL_PROTOCOL_TEST(ec == bintoken::insufficient_tokens);
+}
+
+void fail_truncated()
+{
+    const value_type input[] = { token::code::begin_array,
+                                 token::code::null };
+    bintoken::reader reader(input);
+    std::error_code ec;
+    auto skipped = bintoken::partial::skip(reader, ec);
+    TRIAL_PROTOCOL_TEST(ec == bintoken::insufficient_tokens);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped.size(), 2);
+}
+
+void fail_mismatched_end()
+{
+    const value_type input[] = { token::code::begin_array,
+                                 token::code::null,
+                                 token::code::end_record };
+    bintoken::reader reader(input);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(bintoken::partial::skip(reader),
+                                    bintoken::error,
+                                    "expected end record bracket");
+}
+
+void run()
+{
+    test_one_primitive();
+    test_one_record();
+    test_nested();
+    fail_end_token();
+    fail_truncated();
+    fail_mismatched_end();
+}
+
+} // namespace delimited_suite
+
+//-----------------------------------------------------------------------------
+// Length-prefixed containers
+//-----------------------------------------------------------------------------
+
+namespace prefix_suite
+{
+
+void test_one_record()
+{
+    const value_type input[] = { token::code::length8, 3,
+                                 token::code::begin_record,
+                                 token::code::null,
+                                 token::code::end_record };
+    bintoken::reader reader(input);
+    auto skipped = bintoken::partial::skip(reader);
+    TRIAL_PROTOCOL_TEST_ALL_WITH(skipped.begin(), skipped.end(),
+                                 input + 2, input + sizeof(input),
+                                 std::equal_to<value_type>());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void test_content_not_decoded()
+{
+    // The content is invalid but skipped without decoding
+    const value_type input[] = { token::code::begin_array,
+                                 token::code::length8, 4,
+                                 token::code::begin_record,
+                                 0x84, 0x85,
+                                 token::code::end_record,
+                                 token::code::false_value,
+                                 token::code::end_array };
+    bintoken::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    auto skipped = bintoken::partial::skip(reader);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped.size(), 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::false_value);
+}
+
+void test_writer()
+{
+    std::vector<value_type> output;
+    bintoken::writer writer(output);
+    writer.value<token::begin_array>();
+    writer.prefix_containers(true);
+    for (int i = 0; i < 3; ++i)
+    {
+        writer.value<token::begin_record>();
+        writer.value(i);
+        writer.value("alpha");
+        writer.value<token::begin_array>();
+        writer.value(3.0);
+        writer.value<token::end_array>();
+        writer.value<token::end_record>();
+    }
+    writer.prefix_containers(false);
+    writer.value(true);
+    writer.value<token::end_array>();
+
+    bintoken::reader reader(output);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    for (int i = 0; i < 3; ++i)
+    {
+        TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_record);
+        bintoken::partial::skip(reader);
+        TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::true_value);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+    TRIAL_PROTOCOL_TEST(!reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 0);
+}
+
+void run()
+{
+    test_one_record();
+    test_content_not_decoded();
+    test_writer();
+}
+
+} // namespace prefix_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    delimited_suite::run();
+    prefix_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,244 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include <trial/protocol/buffer/array.hpp>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/buffer/vector.hpp>
+#include <trial/protocol/bintoken/transcode.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+namespace token = bintoken::token;
+using value_type = bintoken::reader::value_type;
+
+namespace
+{
+
+std::vector<value_type> to_bintoken(const std::string& input)
+{
+    std::vector<value_type> result;
+    json::reader reader(input);
+    bintoken::writer writer(result);
+    bintoken::transcode(reader, writer);
+    return result;
+}
+
+template <typename T>
+std::string to_json(const T& input)
+{
+    std::string result;
+    bintoken::reader reader(input);
+    json::writer writer(result);
+    bintoken::transcode(reader, writer);
+    return result;
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// JSON to BinToken
+//-----------------------------------------------------------------------------
+
+namespace json_suite
+{
+
+void test_null()
+{
+    auto output = to_bintoken("null");
+    value_type expected[] = { token::code::null };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(output.begin(), output.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<value_type>());
+}
+
+void test_integer()
+{
+    auto output = to_bintoken("-1000");
+    value_type expected[] = { token::code::int16, 0x18, 0xFC };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(output.begin(), output.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<value_type>());
+}
+
+void test_escaped_string()
+{
+    auto output = to_bintoken("\"a\\nb\"");
+    value_type expected[] = { token::code::string8, 0x03, 'a', '\n', 'b' };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(output.begin(), output.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<value_type>());
+}
+
+void test_nested()
+{
+    auto output = to_bintoken("[true,{\"k\":[]}]");
+    value_type expected[] = { token::code::begin_array,
+                              token::code::true_value,
+                              token::code::begin_assoc_array,
+                              token::code::string8, 0x01, 'k',
+                              token::code::begin_array,
+                              token::code::end_array,
+                              token::code::end_assoc_array,
+                              token::code::end_array };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(output.begin(), output.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<value_type>());
+}
+
+void test_advance_past_value()
+{
+    const std::string input = "[[1],2]";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    std::vector<value_type> output;
+    bintoken::writer writer(output);
+    bintoken::transcode(reader, writer);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), json::token::symbol::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(output.size(), 3);
+}
+
+void fail_truncated()
+{
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(to_bintoken("[1,"),
+                                    json::error,
+                                    "algorithm used requires more tokens than available");
+}
+
+void fail_end_token()
+{
+    const std::string input = "[]";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    std::vector<value_type> output;
+    bintoken::writer writer(output);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(bintoken::transcode(reader, writer),
+                                    json::error,
+                                    "algorithm used requires more tokens than available");
+}
+
+void run()
+{
+    test_null();
+    test_integer();
+    test_escaped_string();
+    test_nested();
+    test_advance_past_value();
+    fail_truncated();
+    fail_end_token();
+}
+
+} // namespace json_suite
+
+//-----------------------------------------------------------------------------
+// BinToken to JSON
+//-----------------------------------------------------------------------------
+
+namespace bintoken_suite
+{
+
+void test_scalars()
+{
+    const value_type input[] = { token::code::begin_record,
+                                 token::code::null,
+                                 token::code::false_value,
+                                 token::code::int16, 0x18, 0xFC,
+                                 token::code::string8, 0x03, 'a', '\n', 'b',
+                                 token::code::end_record };
+    TRIAL_PROTOCOL_TEST_EQUAL(to_json(input), "[null,false,-1000,\"a\\nb\"]");
+}
+
+void test_assoc_array()
+{
+    const value_type input[] = { token::code::begin_assoc_array,
+                                 token::code::string8, 0x01, 'k',
+                                 token::code::begin_array,
+                                 token::code::end_array,
+                                 token::code::end_assoc_array };
+    TRIAL_PROTOCOL_TEST_EQUAL(to_json(input), "{\"k\":[]}");
+}
+
+void test_compact_array()
+{
+    const value_type input[] = { token::code::array8_int16, 0x04,
+                                 0x01, 0x00, 0xFF, 0xFF };
+    TRIAL_PROTOCOL_TEST_EQUAL(to_json(input), "[1,-1]");
+}
+
+void test_delta_array()
+{
+    const value_type input[] = { token::code::delta_array, 0x04,
+                                 0x03, 0x14, 0x02, 0x01 };
+    TRIAL_PROTOCOL_TEST_EQUAL(to_json(input), "[10,11,10]");
+}
+
+void test_round_trip()
+{
+    const std::string input = "{\"alpha\":[1,2,[]],\"bravo\":{\"charlie\":null},\"delta\":\"a\\tb\"}";
+    TRIAL_PROTOCOL_TEST_EQUAL(to_json(to_bintoken(input)), input);
+}
+
+void fail_key()
+{
+    const value_type input[] = { token::code::begin_assoc_array,
+                                 0x01, 0x02,
+                                 token::code::end_assoc_array };
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(to_json(input),
+                                    bintoken::error,
+                                    "incompatible type");
+}
+
+void fail_missing_value()
+{
+    const value_type input[] = { token::code::begin_assoc_array,
+                                 token::code::string8, 0x01, 'k',
+                                 token::code::end_assoc_array };
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(to_json(input),
+                                    bintoken::error,
+                                    "invalid value");
+}
+
+void fail_truncated()
+{
+    const value_type input[] = { token::code::begin_array,
+                                 token::code::null };
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(to_json(input),
+                                    bintoken::error,
+                                    "insufficient tokens");
+}
+
+void run()
+{
+    test_scalars();
+    test_assoc_array();
+    test_compact_array();
+    test_delta_array();
+    test_round_trip();
+    fail_key();
+    fail_missing_value();
+    fail_truncated();
+}
+
+} // namespace bintoken_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    json_suite::run();
+    bintoken_suite::run();
+
+    return boost::report_errors();
+}
@@ -456,6 +456,48 @@ void test_float64()
                                  std::equal_to<output_type>());
 }
 
+void test_aligned_float64()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.align_arrays(true);
+    std::array<token::float64::type, 2> data = {{ -1.0, 1.0 }};
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.array(data.data(), data.size()), 24);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(true), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.array(data.data(), data.size()), 23);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.size(), 48);
+
+    output_type expected[] = { token::code::padding, token::code::padding, token::code::padding,
+                               token::code::padding, token::code::padding, token::code::padding,
+                               token::code::array8_float64, 2 * token::float64::size,
+                               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xBF,
+                               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F,
+                               token::code::true_value,
+                               token::code::padding, token::code::padding, token::code::padding,
+                               token::code::padding, token::code::padding,
+                               token::code::array8_float64, 2 * token::float64::size,
+                               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xBF,
+                               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
+void test_aligned_int16()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.align_arrays(true);
+    std::array<std::int16_t, 1> data = {{ 0x1101 }};
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.array(data.data(), data.size()), 4);
+
+    output_type expected[] = { token::code::array8_int16, token::int16::size,
+                               0x01, 0x11 };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
 void run()
 {
     test_int8_empty();
@@ -465,6 +507,8 @@ void run()
     test_int64();
     test_float32();
     test_float64();
+    test_aligned_float64();
+    test_aligned_int16();
 }
 
 } // namespace compact_suite
@@ -637,6 +681,257 @@ void run()
 
 } // namespace assoc_array_suite
 
+//-----------------------------------------------------------------------------
+// Variable-length integers
+//-----------------------------------------------------------------------------
+
+namespace varint_suite
+{
+
+void test_int16_fixed()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.variable_integers(true);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(1000), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], token::code::int16);
+}
+
+void test_int32()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.variable_integers(true);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(100000), 4);
+
+    output_type expected[] = { token::code::varint, 0xC0, 0x9A, 0x0C };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
+void test_int32_fixed()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.variable_integers(true);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(std::numeric_limits<std::int32_t>::max()), 5);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], token::code::int32);
+}
+
+void test_int64()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.variable_integers(true);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(-(INT64_C(1) << 40)), 7);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], token::code::varint);
+}
+
+void test_unsigned()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.variable_integers(true);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(100000U), 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(std::numeric_limits<std::uint64_t>::max()), 9);
+
+    output_type expected[] = { token::code::varint, 0xC0, 0x9A, 0x0C,
+                               token::code::int64, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
+void test_delta_array()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.variable_integers(true);
+    std::int32_t data[] = { 100, 101, 103 };
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.array(data, 3), 7);
+
+    output_type expected[] = { token::code::delta_array, 0x05,
+                               0x03, 0xC8, 0x01, 0x02, 0x04 };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
+void test_delta_array_compact()
+{
+    // Large differences are shorter as compact array
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.variable_integers(true);
+    std::int16_t data[] = { 0x7000, -0x7000 };
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.array(data, 2), 6);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], token::code::array8_int16);
+}
+
+void test_int8_array_compact()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.variable_integers(true);
+    std::int8_t data[] = { 1, 2, 3 };
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.array(data, 3), 5);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], token::code::array8_int8);
+}
+
+void run()
+{
+    test_int16_fixed();
+    test_int32();
+    test_int32_fixed();
+    test_int64();
+    test_unsigned();
+    test_delta_array();
+    test_delta_array_compact();
+    test_int8_array_compact();
+}
+
+} // namespace varint_suite
+
+//-----------------------------------------------------------------------------
+// Length-prefixed containers
+//-----------------------------------------------------------------------------
+
+namespace prefix_suite
+{
+
+void test_record()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.prefix_containers(true);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_record>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(false), 1);
+    TRIAL_PROTOCOL_TEST(result.empty());
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_record>(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.size(), 5);
+
+    output_type expected[] = { token::code::length8, 3,
+                               token::code::begin_record,
+                               token::code::false_value,
+                               token::code::end_record };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
+void test_nested()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.prefix_containers(true);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_assoc_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(1), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(2), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_assoc_array>(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_array>(), 3);
+
+    output_type expected[] = { token::code::length8, 8,
+                               token::code::begin_array,
+                               token::code::length8, 4,
+                               token::code::begin_assoc_array,
+                               0x01,
+                               0x02,
+                               token::code::end_assoc_array,
+                               token::code::end_array };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
+void test_mixed()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_array>(), 1);
+    writer.prefix_containers(true);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_record>(), 1);
+    writer.prefix_containers(false);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_record>(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_array>(), 1);
+
+    output_type expected[] = { token::code::begin_array,
+                               token::code::length8, 4,
+                               token::code::begin_record,
+                               token::code::begin_array,
+                               token::code::end_array,
+                               token::code::end_record,
+                               token::code::end_array };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
+void test_length16()
+{
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.prefix_containers(true);
+    std::vector<std::int8_t> data(0x100);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.array(data.data(), data.size()), 0x103);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_array>(), 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 3 + 0x105);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], token::code::length16);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1], 0x05);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[2], 0x01);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[3], token::code::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.back(), token::code::end_array);
+}
+
+void test_aligned()
+{
+    // Arrays are not padded inside length-prefixed containers
+    std::vector<output_type> result;
+    format::writer writer(result);
+    writer.prefix_containers(true);
+    writer.align_arrays(true);
+    std::array<token::float64::type, 2> data = {{ -1.0, 1.0 }};
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.array(data.data(), data.size()), 18);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_array>(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(true), 1);
+    // Top-level arrays are still aligned
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.array(data.data(), data.size()), 25);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.size(), 48);
+
+    output_type expected[] = { token::code::length8, 20,
+                               token::code::begin_array,
+                               token::code::array8_float64, 2 * token::float64::size,
+                               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xBF,
+                               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F,
+                               token::code::end_array,
+                               token::code::true_value,
+                               token::code::padding, token::code::padding, token::code::padding,
+                               token::code::padding, token::code::padding, token::code::padding,
+                               token::code::padding,
+                               token::code::array8_float64, 2 * token::float64::size,
+                               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xBF,
+                               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
+void run()
+{
+    test_record();
+    test_nested();
+    test_mixed();
+    test_length16();
+    test_aligned();
+}
+
+} // namespace prefix_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -650,6 +945,8 @@ int main()
     record_suite::run();
     array_suite::run();
     assoc_array_suite::run();
+    varint_suite::run();
+    prefix_suite::run();
 
     return boost::report_errors();
 }
@@ -9,9 +9,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <trial/protocol/core/detail/lightweight_test.hpp>
+#include <trial/protocol/core/detail/string_view.hpp>
 #include <trial/dynamic/algorithm/find.hpp>
 
 using namespace trial::dynamic;
+using trial::protocol::core::detail::string_view;
 
 //-----------------------------------------------------------------------------
 // key::find
@@ -99,9 +101,45 @@ void find_map()
     }
 }
 
+void find_map_string_key()
+{
+    variable data = map::make(
+        {
+            {1, null},
+            {"alpha", true},
+            {"bravo", 2},
+            {L"alpha", 3.0}
+        });
+    {
+        variable::key_iterator where = key::find(data, std::string("alpha"));
+        TRIAL_PROTOCOL_TEST_EQUAL(std::distance(data.key_begin(), where), 1);
+    }
+    {
+        variable::key_iterator where = key::find(data, string_view("bravo"));
+        TRIAL_PROTOCOL_TEST_EQUAL(std::distance(data.key_begin(), where), 2);
+    }
+    {
+        variable::key_iterator where = key::find(data, std::wstring(L"alpha"));
+        TRIAL_PROTOCOL_TEST_EQUAL(std::distance(data.key_begin(), where), 3);
+    }
+    {
+        variable::key_iterator where = key::find(data, 1);
+        TRIAL_PROTOCOL_TEST_EQUAL(std::distance(data.key_begin(), where), 0);
+    }
+    {
+        variable::key_iterator where = key::find(data, string_view("charlie"));
+        TRIAL_PROTOCOL_TEST(where == data.key_end());
+    }
+    {
+        variable::key_iterator where = key::find(data, std::wstring(L"bravo"));
+        TRIAL_PROTOCOL_TEST(where == data.key_end());
+    }
+}
+
 void run()
 {
     find_map();
+    find_map_string_key();
 }
 
 } // namespace key_find_suite
@@ -0,0 +1,261 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2017 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+#include <trial/dynamic/compact.hpp>
+
+using namespace trial::dynamic;
+
+//-----------------------------------------------------------------------------
+// Layout
+//-----------------------------------------------------------------------------
+
+namespace layout_suite
+{
+
+void size_compact()
+{
+    static_assert(sizeof(compact_variable) == 2 * sizeof(void *), "compact_variable must be two pointers");
+    TRIAL_PROTOCOL_TEST(sizeof(compact_variable) < sizeof(variable));
+}
+
+void same_string_type()
+{
+    static_assert(std::is_same<compact_variable::string_type, std::string>::value, "string_type must be std::string");
+    static_assert(std::is_same<compact_variable::wstring_type, std::wstring>::value, "wstring_type must be std::wstring");
+    static_assert(std::is_same<compact_variable::u16string_type, std::u16string>::value, "u16string_type must be std::u16string");
+    static_assert(std::is_same<compact_variable::u32string_type, std::u32string>::value, "u32string_type must be std::u32string");
+}
+
+void run()
+{
+    size_compact();
+    same_string_type();
+}
+
+} // namespace layout_suite
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+namespace ctor_suite
+{
+
+void construct_null()
+{
+    compact_variable data;
+    TRIAL_PROTOCOL_TEST(data.same<nullable>());
+}
+
+void construct_boolean()
+{
+    compact_variable data(true);
+    TRIAL_PROTOCOL_TEST(data.same<bool>());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.value<bool>(), true);
+}
+
+void construct_integer()
+{
+    compact_variable data(2LL);
+    TRIAL_PROTOCOL_TEST(data.same<long long int>());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.value<long long int>(), 2LL);
+}
+
+void construct_real()
+{
+    compact_variable data(3.0);
+    TRIAL_PROTOCOL_TEST(data.same<double>());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.value<double>(), 3.0);
+}
+
+void construct_long_real()
+{
+    compact_variable data(3.0L);
+    TRIAL_PROTOCOL_TEST(data.same<long double>());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.value<long double>(), 3.0L);
+}
+
+void construct_string()
+{
+    compact_variable data("alpha");
+    TRIAL_PROTOCOL_TEST(data.same<std::string>());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.value<std::string>(), "alpha");
+}
+
+void construct_wstring()
+{
+    compact_variable data(L"bravo");
+    TRIAL_PROTOCOL_TEST(data.same<std::wstring>());
+    TRIAL_PROTOCOL_TEST(data.value<std::wstring>() == L"bravo");
+}
+
+void construct_array()
+{
+    compact_variable data = compact_array::make({ true, 2, 3.0, "alpha" });
+    TRIAL_PROTOCOL_TEST(data.is<array>());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 4);
+    TRIAL_PROTOCOL_TEST(data[0] == true);
+    TRIAL_PROTOCOL_TEST(data[1] == 2);
+    TRIAL_PROTOCOL_TEST(data[2] == 3.0);
+    TRIAL_PROTOCOL_TEST(data[3] == "alpha");
+}
+
+void construct_map()
+{
+    compact_variable data = compact_map::make(
+        {
+            { "alpha", true },
+            { "bravo", compact_array::make({ 2, 3.0 }) }
+        });
+    TRIAL_PROTOCOL_TEST(data.is<map>());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 2);
+    TRIAL_PROTOCOL_TEST(data["alpha"] == true);
+    TRIAL_PROTOCOL_TEST(data["bravo"].size() == 2);
+    TRIAL_PROTOCOL_TEST(data["bravo"][1] == 3.0);
+}
+
+void run()
+{
+    construct_null();
+    construct_boolean();
+    construct_integer();
+    construct_real();
+    construct_long_real();
+    construct_string();
+    construct_wstring();
+    construct_array();
+    construct_map();
+}
+
+} // namespace ctor_suite
+
+//-----------------------------------------------------------------------------
+// Copy and move
+//-----------------------------------------------------------------------------
+
+namespace copy_suite
+{
+
+void copy_string()
+{
+    compact_variable data("alpha");
+    compact_variable copy(data);
+    TRIAL_PROTOCOL_TEST(copy == "alpha");
+    copy = "bravo";
+    TRIAL_PROTOCOL_TEST(data == "alpha");
+    TRIAL_PROTOCOL_TEST(copy == "bravo");
+}
+
+void copy_array()
+{
+    compact_variable data = compact_array::make({ 1, "alpha" });
+    compact_variable copy(data);
+    TRIAL_PROTOCOL_TEST_EQUAL(copy.size(), 2);
+    copy.insert(2);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(copy.size(), 3);
+}
+
+void move_string()
+{
+    compact_variable data("alpha");
+    const auto *before = &data.assume_value<std::string>();
+    compact_variable copy(std::move(data));
+    TRIAL_PROTOCOL_TEST(data.same<nullable>());
+    TRIAL_PROTOCOL_TEST(copy == "alpha");
+    // Heap object has been transferred
+    TRIAL_PROTOCOL_TEST(&copy.assume_value<std::string>() == before);
+}
+
+void move_map()
+{
+    compact_variable data = compact_map::make({ { "alpha", 1 } });
+    compact_variable copy;
+    copy = std::move(data);
+    TRIAL_PROTOCOL_TEST(data.same<nullable>());
+    TRIAL_PROTOCOL_TEST(copy["alpha"] == 1);
+}
+
+void assign_from_nested()
+{
+    compact_variable data = compact_array::make({ compact_array::make({ 1, 2 }), "alpha" });
+    data = data[0];
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 2);
+    TRIAL_PROTOCOL_TEST(data[0] == 1);
+    TRIAL_PROTOCOL_TEST(data[1] == 2);
+}
+
+void move_from_nested()
+{
+    compact_variable data = compact_map::make({ { "alpha", compact_map::make({ { "bravo", 2 } }) } });
+    data = std::move(data["alpha"]);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 1);
+    TRIAL_PROTOCOL_TEST(data["bravo"] == 2);
+}
+
+void run()
+{
+    copy_string();
+    copy_array();
+    move_string();
+    move_map();
+    assign_from_nested();
+    move_from_nested();
+}
+
+} // namespace copy_suite
+
+//-----------------------------------------------------------------------------
+// Comparison
+//-----------------------------------------------------------------------------
+
+namespace comparison_suite
+{
+
+void compare_numbers()
+{
+    compact_variable data = compact_array::make({ 1, 2.0, 3.0L });
+    compact_variable expect = compact_array::make({ 1, 2.0, 3.0L });
+    TRIAL_PROTOCOL_TEST(data == expect);
+    TRIAL_PROTOCOL_TEST(data[0] < data[1]);
+    TRIAL_PROTOCOL_TEST(data[1] < data[2]);
+    TRIAL_PROTOCOL_TEST(data[2] < compact_variable("alpha"));
+}
+
+void compare_string_key()
+{
+    compact_variable data = compact_map::make({ { "alpha", 1 }, { "bravo", 2 } });
+    TRIAL_PROTOCOL_TEST(data["alpha"] == 1);
+    TRIAL_PROTOCOL_TEST(data[std::string("bravo")] == 2);
+}
+
+void run()
+{
+    compare_numbers();
+    compare_string_key();
+}
+
+} // namespace comparison_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    layout_suite::run();
+    ctor_suite::run();
+    copy_suite::run();
+    comparison_suite::run();
+
+    return boost::report_errors();
+}
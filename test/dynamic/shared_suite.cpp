@@ -0,0 +1,228 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2017 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+#include <trial/dynamic/shared.hpp>
+
+using namespace trial::dynamic;
+
+//-----------------------------------------------------------------------------
+// Layout
+//-----------------------------------------------------------------------------
+
+namespace layout_suite
+{
+
+void size_shared()
+{
+    static_assert(sizeof(shared_variable) == 2 * sizeof(void *), "shared_variable must be two pointers");
+    static_assert(std::is_same<shared_variable::string_type, std::string>::value, "string_type must be std::string");
+}
+
+void run()
+{
+    size_shared();
+}
+
+} // namespace layout_suite
+
+//-----------------------------------------------------------------------------
+// Strings
+//-----------------------------------------------------------------------------
+
+namespace string_suite
+{
+
+void copy_shares()
+{
+    const shared_variable data("alpha");
+    const shared_variable copy(data);
+    TRIAL_PROTOCOL_TEST(copy == "alpha");
+    TRIAL_PROTOCOL_TEST(&copy.assume_value<std::string>() == &data.assume_value<std::string>());
+}
+
+void assign_shares()
+{
+    const shared_variable data("alpha");
+    shared_variable copy("bravo");
+    copy = data;
+    TRIAL_PROTOCOL_TEST(copy == "alpha");
+    TRIAL_PROTOCOL_TEST(&static_cast<const shared_variable&>(copy).assume_value<std::string>() == &data.assume_value<std::string>());
+}
+
+void modify_unshares()
+{
+    const shared_variable data("alpha");
+    shared_variable copy(data);
+    copy.assume_value<std::string>() += "bravo";
+    TRIAL_PROTOCOL_TEST(data == "alpha");
+    TRIAL_PROTOCOL_TEST(copy == "alphabravo");
+    TRIAL_PROTOCOL_TEST(&static_cast<const shared_variable&>(copy).assume_value<std::string>() != &data.assume_value<std::string>());
+}
+
+void modify_unique()
+{
+    shared_variable data("alpha");
+    const auto *before = &static_cast<const shared_variable&>(data).assume_value<std::string>();
+    data.assume_value<std::string>() += "bravo";
+    TRIAL_PROTOCOL_TEST(data == "alphabravo");
+    TRIAL_PROTOCOL_TEST(&data.assume_value<std::string>() == before);
+}
+
+void destroy_shared()
+{
+    shared_variable copy;
+    {
+        shared_variable data("alpha");
+        copy = data;
+    }
+    TRIAL_PROTOCOL_TEST(copy == "alpha");
+}
+
+void shared_key()
+{
+    const shared_variable key("alpha");
+    shared_variable first = shared_map::make({ { key, 1 } });
+    shared_variable second = shared_map::make({ { key, 2 } });
+    TRIAL_PROTOCOL_TEST(first["alpha"] == 1);
+    TRIAL_PROTOCOL_TEST(second["alpha"] == 2);
+    const auto& first_key = (*first.key_begin()).assume_value<std::string>();
+    const auto& second_key = (*second.key_begin()).assume_value<std::string>();
+    TRIAL_PROTOCOL_TEST(&first_key == &second_key);
+    TRIAL_PROTOCOL_TEST(&first_key == &key.assume_value<std::string>());
+}
+
+void run()
+{
+    copy_shares();
+    assign_shares();
+    modify_unshares();
+    modify_unique();
+    destroy_shared();
+    shared_key();
+}
+
+} // namespace string_suite
+
+//-----------------------------------------------------------------------------
+// Containers
+//-----------------------------------------------------------------------------
+
+namespace container_suite
+{
+
+void copy_array_shares()
+{
+    const shared_variable data = shared_array::make({ 1, 2, 3 });
+    const shared_variable copy(data);
+    TRIAL_PROTOCOL_TEST(copy == data);
+    TRIAL_PROTOCOL_TEST(&copy.assume_value<shared_variable::array_type>() == &data.assume_value<shared_variable::array_type>());
+}
+
+void copy_map_shares()
+{
+    const shared_variable data = shared_map::make({ { "alpha", 1 }, { "bravo", 2 } });
+    const shared_variable copy(data);
+    TRIAL_PROTOCOL_TEST(copy == data);
+    TRIAL_PROTOCOL_TEST(&copy.assume_value<shared_variable::map_type>() == &data.assume_value<shared_variable::map_type>());
+}
+
+void modify_array_unshares()
+{
+    const shared_variable data = shared_array::make({ 1, 2, 3 });
+    shared_variable copy(data);
+    copy.insert(4);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(copy.size(), 4);
+}
+
+void modify_map_unshares()
+{
+    const shared_variable data = shared_map::make({ { "alpha", 1 } });
+    shared_variable copy(data);
+    copy["alpha"] = 2;
+    copy["bravo"] = 3;
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 1);
+    TRIAL_PROTOCOL_TEST(data["alpha"] == 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(copy.size(), 2);
+    TRIAL_PROTOCOL_TEST(copy["alpha"] == 2);
+}
+
+void modify_nested_copies_path()
+{
+    const shared_variable data = shared_map::make(
+        {
+            { "alpha", shared_map::make({ { "bravo", 1 } }) },
+            { "charlie", shared_array::make({ 2, 3 }) }
+        });
+    shared_variable copy(data);
+    copy["alpha"]["bravo"] = 4;
+
+    TRIAL_PROTOCOL_TEST(data["alpha"]["bravo"] == 1);
+    TRIAL_PROTOCOL_TEST(copy["alpha"]["bravo"] == 4);
+
+    // Containers along the path are copied
+    const shared_variable& result = copy;
+    TRIAL_PROTOCOL_TEST(&result.assume_value<shared_variable::map_type>() != &data.assume_value<shared_variable::map_type>());
+    TRIAL_PROTOCOL_TEST(&result["alpha"].assume_value<shared_variable::map_type>() != &data["alpha"].assume_value<shared_variable::map_type>());
+    // Untouched subtrees are still shared
+    TRIAL_PROTOCOL_TEST(&result["charlie"].assume_value<shared_variable::array_type>() == &data["charlie"].assume_value<shared_variable::array_type>());
+}
+
+void iterate_unique()
+{
+    shared_variable data = shared_array::make({ 1, 2, 3 });
+    int sum = 0;
+    for (auto& element : data)
+    {
+        element = element.value<int>() + 1;
+        sum += element.value<int>();
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(sum, 9);
+}
+
+void iterate_shared()
+{
+    const shared_variable data = shared_array::make({ 1, 2, 3 });
+    shared_variable copy(data);
+    for (auto& element : copy)
+    {
+        element = 0;
+    }
+    TRIAL_PROTOCOL_TEST(data == shared_array::make({ 1, 2, 3 }));
+    TRIAL_PROTOCOL_TEST(copy == shared_array::make({ 0, 0, 0 }));
+}
+
+void run()
+{
+    copy_array_shares();
+    copy_map_shares();
+    modify_array_unshares();
+    modify_map_unshares();
+    modify_nested_copies_path();
+    iterate_unique();
+    iterate_shared();
+}
+
+} // namespace container_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    layout_suite::run();
+    string_suite::run();
+    container_suite::run();
+
+    return boost::report_errors();
+}
@@ -18,6 +18,8 @@ using namespace trial::dynamic;
 // std::iota
 //-----------------------------------------------------------------------------
 
+#if __cplusplus < 201703L
+// Increment of bool was removed in C++17
 void test_array_boolean()
 {
     variable data = array::repeat(4, null);
@@ -27,6 +29,7 @@ void test_array_boolean()
                                  result.begin(), result.end(),
                                  std::equal_to<variable>());
 }
+#endif
 
 void test_array_integer()
 {
@@ -50,7 +53,9 @@ void test_array_real()
 
 int main()
 {
+#if __cplusplus < 201703L
     test_array_boolean();
+#endif
     test_array_integer();
     test_array_real();
 
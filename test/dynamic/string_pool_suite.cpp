@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2017 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+#include <trial/protocol/core/detail/string_view.hpp>
+#include <trial/dynamic/string_pool.hpp>
+
+using namespace trial::dynamic;
+
+//-----------------------------------------------------------------------------
+// Intern
+//-----------------------------------------------------------------------------
+
+namespace intern_suite
+{
+
+void intern_empty()
+{
+    string_pool pool;
+    TRIAL_PROTOCOL_TEST(pool.empty());
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 0);
+}
+
+void intern_string()
+{
+    string_pool pool;
+    const auto& result = pool.intern(std::string("alpha"));
+    TRIAL_PROTOCOL_TEST(result == "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 1);
+}
+
+void intern_pointer()
+{
+    string_pool pool;
+    const char input[] = "alphabravo";
+    const auto& result = pool.intern(input, 5);
+    TRIAL_PROTOCOL_TEST(result == "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 1);
+}
+
+void intern_string_view()
+{
+    string_pool pool;
+    trial::protocol::core::detail::string_view input("alpha");
+    const auto& result = pool.intern(input);
+    TRIAL_PROTOCOL_TEST(result == "alpha");
+}
+
+void intern_wstring()
+{
+    string_pool pool;
+    const auto& result = pool.intern(std::wstring(L"alpha"));
+    TRIAL_PROTOCOL_TEST(result == L"alpha");
+    pool.intern(std::string("alpha"));
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 2);
+}
+
+void intern_repeated()
+{
+    string_pool pool;
+    const auto& first = pool.intern(std::string("alpha"));
+    const auto& second = pool.intern(std::string("alpha"));
+    TRIAL_PROTOCOL_TEST(&first == &second);
+    pool.intern(std::string("bravo"));
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 2);
+}
+
+void intern_shared()
+{
+    string_pool pool;
+    shared_variable first = pool.intern(std::string("alpha"));
+    shared_variable second = pool.intern(std::string("alpha"));
+    const shared_variable& lhs = first;
+    const shared_variable& rhs = second;
+    TRIAL_PROTOCOL_TEST(&lhs.assume_value<std::string>() == &rhs.assume_value<std::string>());
+}
+
+void intern_clear()
+{
+    string_pool pool;
+    shared_variable data = pool.intern(std::string("alpha"));
+    pool.clear();
+    TRIAL_PROTOCOL_TEST(pool.empty());
+    TRIAL_PROTOCOL_TEST(data == "alpha");
+}
+
+void intern_unshared()
+{
+    basic_string_pool<std::allocator<char>> pool;
+    variable data = pool.intern(std::string("alpha"));
+    TRIAL_PROTOCOL_TEST(data == "alpha");
+    pool.intern(std::string("alpha"));
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 1);
+}
+
+void run()
+{
+    intern_empty();
+    intern_string();
+    intern_pointer();
+    intern_string_view();
+    intern_wstring();
+    intern_repeated();
+    intern_shared();
+    intern_clear();
+    intern_unshared();
+}
+
+} // namespace intern_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    intern_suite::run();
+
+    return boost::report_errors();
+}
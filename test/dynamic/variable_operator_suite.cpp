@@ -9,9 +9,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <trial/protocol/core/detail/lightweight_test.hpp>
+#include <trial/protocol/core/detail/string_view.hpp>
 #include <trial/dynamic/variable.hpp>
 
 using namespace trial::dynamic;
+using trial::protocol::core::detail::string_view;
 
 //-----------------------------------------------------------------------------
 // Append
@@ -3536,6 +3538,72 @@ void create_map_key()
     TRIAL_PROTOCOL_TEST(data["delta"] == "beryllium");
 }
 
+void key_map_string_key()
+{
+    variable data = map::make(
+        {
+            { 1, true },
+            { "alpha", 2 },
+            { "bravo", 3.0 },
+            { L"alpha", "beryllium" }
+        });
+    TRIAL_PROTOCOL_TEST(data[std::string("alpha")] == 2);
+    TRIAL_PROTOCOL_TEST(data[string_view("bravo")] == 3.0);
+    TRIAL_PROTOCOL_TEST(data[std::wstring(L"alpha")] == "beryllium");
+    TRIAL_PROTOCOL_TEST(data[L"alpha"] == "beryllium");
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 4);
+    TRIAL_PROTOCOL_TEST(data[string_view("unknown")] == null);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 5);
+}
+
+void key_const_map_string_key()
+{
+    const variable data = map::make(
+        {
+            { 1, true },
+            { "alpha", 2 },
+            { "bravo", 3.0 },
+            { L"alpha", "beryllium" }
+        });
+    TRIAL_PROTOCOL_TEST(data[std::string("alpha")] == 2);
+    TRIAL_PROTOCOL_TEST(data[string_view("bravo")] == 3.0);
+    TRIAL_PROTOCOL_TEST(data[L"alpha"] == "beryllium");
+    TRIAL_PROTOCOL_TEST_THROWS(data[string_view("unknown")],
+                               std::out_of_range);
+    TRIAL_PROTOCOL_TEST_THROWS(data[u"alpha"],
+                               std::out_of_range);
+}
+
+void key_string_key()
+{
+    {
+        variable data(true);
+        TRIAL_PROTOCOL_TEST_THROW_EQUAL(data[string_view("alpha")],
+                                        error,
+                                        "incompatible type");
+    }
+    {
+        const variable data = array::make({ true, 2, 3.0, "alpha" });
+        TRIAL_PROTOCOL_TEST_THROW_EQUAL(data[string_view("alpha")],
+                                        error,
+                                        "incompatible type");
+    }
+}
+
+void create_map_string_key()
+{
+    variable data;
+    data[string_view("alpha")] = true;
+    TRIAL_PROTOCOL_TEST(data.is<map>());
+    TRIAL_PROTOCOL_TEST(data["alpha"] == true);
+    data[std::string("bravo")] = 2;
+    TRIAL_PROTOCOL_TEST(data["bravo"] == 2);
+    data[string_view("alpha")] = 3.0;
+    TRIAL_PROTOCOL_TEST(data["alpha"] == 3.0);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 2);
+    TRIAL_PROTOCOL_TEST((*data.key_begin()).same<variable::string_type>());
+}
+
 void run()
 {
     index_null();
@@ -3558,6 +3626,11 @@ void run()
     key_const_map();
 
     create_map_key();
+
+    key_map_string_key();
+    key_const_map_string_key();
+    key_string_key();
+    create_map_string_key();
 }
 
 } // namespace subscript_suite
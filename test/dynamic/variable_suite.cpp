@@ -4779,6 +4779,25 @@ void assign_map_with_map()
     TRIAL_PROTOCOL_TEST_EQUAL(data.is<map>(), true);
 }
 
+void assign_array_with_nested()
+{
+    variable data = array::make({ array::make({ 1, 2 }), "alpha" });
+    data = data[0];
+    TRIAL_PROTOCOL_TEST_EQUAL(data.is<array>(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 2);
+    TRIAL_PROTOCOL_TEST(data[0] == 1);
+    TRIAL_PROTOCOL_TEST(data[1] == 2);
+}
+
+void assign_map_with_moved_nested()
+{
+    variable data = map::make({ { "alpha", map::make({ { "bravo", 2 } }) } });
+    data = std::move(data["alpha"]);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.is<map>(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 1);
+    TRIAL_PROTOCOL_TEST(data["bravo"] == 2);
+}
+
 void run()
 {
     assign_null_with_null();
@@ -4860,6 +4879,9 @@ void run()
     assign_map_with_string();
     assign_map_with_array();
     assign_map_with_map();
+
+    assign_array_with_nested();
+    assign_map_with_moved_nested();
 }
 
 } // namespace assign_suite
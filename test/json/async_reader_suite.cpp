@@ -0,0 +1,527 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cerrno>
+#include <coroutine>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <trial/protocol/json/async_reader.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+namespace token = json::token;
+
+namespace
+{
+
+// Eagerly started coroutine
+
+class task
+{
+public:
+    struct promise_type
+    {
+        task get_return_object() noexcept
+        {
+            return task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+        std::exception_ptr exception;
+    };
+
+    task(const task&) = delete;
+    ~task() { handle.destroy(); }
+
+    bool done() const noexcept { return handle.done(); }
+
+    void get() const
+    {
+        if (handle.promise().exception)
+            std::rethrow_exception(handle.promise().exception);
+    }
+
+private:
+    explicit task(std::coroutine_handle<promise_type> handle) noexcept
+        : handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+// Source that completes reads immediately
+
+class string_source
+{
+public:
+    struct awaiter
+    {
+        bool await_ready() const noexcept { return true; }
+        void await_suspend(std::coroutine_handle<>) const noexcept {}
+        std::size_t await_resume() const noexcept { return count; }
+
+        std::size_t count;
+    };
+
+    string_source(std::string input, std::size_t chunk_size)
+        : input(std::move(input)),
+          chunk_size(chunk_size)
+    {
+    }
+
+    awaiter read_some(char *data, std::size_t size)
+    {
+        ++reads;
+        const std::size_t count = std::min({ size, chunk_size, input.size() - position });
+        std::memcpy(data, input.data() + position, count);
+        position += count;
+        return { count };
+    }
+
+    int reads = 0;
+
+private:
+    std::string input;
+    std::size_t chunk_size;
+    std::size_t position = 0;
+};
+
+// Source that suspends every read until the test provides input
+
+class deferred_source
+{
+public:
+    struct awaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) noexcept { self.waiting = handle; }
+        std::size_t await_resume()
+        {
+            if (self.failure)
+                throw std::runtime_error("read failure");
+            const std::size_t count = std::min(size, self.input.size());
+            std::memcpy(data, self.input.data(), count);
+            self.input.erase(0, count);
+            return count;
+        }
+
+        deferred_source& self;
+        char *data;
+        std::size_t size;
+    };
+
+    awaiter read_some(char *data, std::size_t size)
+    {
+        return { *this, data, size };
+    }
+
+    // Resume the pending read with input, or with end of input if empty
+    void resume(const std::string& chunk)
+    {
+        input = chunk;
+        std::exchange(waiting, nullptr).resume();
+    }
+
+    void fail()
+    {
+        failure = true;
+        std::exchange(waiting, nullptr).resume();
+    }
+
+    std::coroutine_handle<> waiting;
+
+private:
+    std::string input;
+    bool failure = false;
+};
+
+// Source that reads from a non-blocking file descriptor
+
+class pipe_source
+{
+public:
+    struct awaiter
+    {
+        bool await_ready()
+        {
+            count = ::read(self.descriptor, data, size);
+            return (count >= 0) || (errno != EAGAIN);
+        }
+        void await_suspend(std::coroutine_handle<> handle) noexcept { self.waiting = handle; }
+        std::size_t await_resume()
+        {
+            if (count < 0)
+            {
+                count = ::read(self.descriptor, data, size);
+            }
+            if (count < 0)
+                throw std::system_error(errno, std::generic_category());
+            return std::size_t(count);
+        }
+
+        pipe_source& self;
+        char *data;
+        std::size_t size;
+        ssize_t count;
+    };
+
+    explicit pipe_source(int descriptor)
+        : descriptor(descriptor)
+    {
+    }
+
+    awaiter read_some(char *data, std::size_t size)
+    {
+        return { *this, data, size, 0 };
+    }
+
+    bool readable() const
+    {
+        pollfd entry = { descriptor, POLLIN, 0 };
+        return ::poll(&entry, 1, 0) > 0;
+    }
+
+    std::coroutine_handle<> waiting;
+
+private:
+    int descriptor;
+};
+
+void add(std::string& output, token::code::value code, const json::reader::view_type& literal)
+{
+    output += std::to_string(int(code));
+    output += ':';
+    output.append(literal.data(), literal.size());
+    output += ' ';
+}
+
+// Tokens of the input parsed by basic_reader
+std::string expect(const std::string& input)
+{
+    std::string result;
+    json::reader reader(input);
+    if (reader.code() >= token::code::null)
+    {
+        do
+        {
+            add(result, reader.code(), reader.literal());
+        } while (reader.next());
+    }
+    add(result, reader.code(), {});
+    return result;
+}
+
+template <typename Source>
+task collect(json::async_reader<Source>& reader, std::string& result)
+{
+    // Awaiting in the loop condition is miscompiled by some GCC versions
+    while (true)
+    {
+        const bool proceed = co_await reader.next();
+        if (!proceed)
+            break;
+        add(result, reader.code(), reader.literal());
+    }
+    add(result, reader.code(), {});
+}
+
+template <typename Source>
+std::string collect(Source& source, std::size_t read_size)
+{
+    std::string result;
+    json::async_reader<Source> reader(source, read_size);
+    task work = collect(reader, result);
+    TRIAL_PROTOCOL_TEST(work.done());
+    work.get();
+    return result;
+}
+
+const std::vector<std::string> documents = {
+    "null",
+    "true",
+    " false ",
+    "12345",
+    "-0.25e+1",
+    R"("alpha\"bravo")",
+    "[]",
+    "{}",
+    R"( {"alpha": [null, true, false, 12345, -0.25e+1, "bra\"vo"], "charlie" : {"delta":""}, "echo":[[], {}]} )",
+    // Malformed
+    "",
+    "nul",
+    "[1, 2",
+    R"(["alpha)",
+    "[1, ]",
+    R"({"alpha": 1,})",
+    "[1] 2",
+    "[01]",
+};
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Chunks
+//-----------------------------------------------------------------------------
+
+namespace chunk_suite
+{
+
+void read_whole()
+{
+    for (const auto& document : documents)
+    {
+        string_source source(document, document.size() + 1);
+        TRIAL_PROTOCOL_TEST_EQUAL(collect(source, 4096), expect(document));
+    }
+}
+
+void read_chunks()
+{
+    // Every chunk size up to the size of the document
+    for (const auto& document : documents)
+    {
+        for (std::size_t chunk_size = 1; chunk_size <= document.size(); ++chunk_size)
+        {
+            string_source source(document, chunk_size);
+            TRIAL_PROTOCOL_TEST_EQUAL(collect(source, 4096), expect(document));
+        }
+    }
+}
+
+void read_small_buffer()
+{
+    // Tokens longer than the read size
+    const std::string document = R"(["alpha bravo charlie delta", 1234567890123, "echo"])";
+    string_source source(document, document.size());
+    TRIAL_PROTOCOL_TEST_EQUAL(collect(source, 3), expect(document));
+    TRIAL_PROTOCOL_TEST(source.reads > int(document.size() / 3));
+}
+
+void read_buffered()
+{
+    // Buffered tokens are parsed without reading
+    const std::string document = "[1, 2, 3, 4, 5, 6, 7, 8, 9]";
+    string_source source(document, document.size());
+    TRIAL_PROTOCOL_TEST_EQUAL(collect(source, 4096), expect(document));
+    // Initial read and end of input
+    TRIAL_PROTOCOL_TEST_EQUAL(source.reads, 2);
+}
+
+void run()
+{
+    read_whole();
+    read_chunks();
+    read_small_buffer();
+    read_buffered();
+}
+
+} // namespace chunk_suite
+
+//-----------------------------------------------------------------------------
+// Suspension
+//-----------------------------------------------------------------------------
+
+namespace suspend_suite
+{
+
+task sum_array(json::async_reader<deferred_source>& reader, int& sum)
+{
+    const bool started = co_await reader.next();
+    if (!started || reader.symbol() != token::symbol::begin_array)
+        co_return;
+    while (true)
+    {
+        const bool proceed = co_await reader.next();
+        if (!proceed)
+            break;
+        if (reader.symbol() == token::symbol::integer)
+        {
+            sum += reader.value<int>();
+        }
+    }
+}
+
+void suspend_number()
+{
+    deferred_source source;
+    json::async_reader<deferred_source> reader(source);
+    int sum = 0;
+    task work = sum_array(reader, sum);
+    TRIAL_PROTOCOL_TEST(source.waiting);
+    source.resume("[1, 2");
+    // Number may continue in next chunk
+    TRIAL_PROTOCOL_TEST_EQUAL(sum, 1);
+    TRIAL_PROTOCOL_TEST(source.waiting);
+    source.resume("0, 3");
+    TRIAL_PROTOCOL_TEST_EQUAL(sum, 21);
+    source.resume("]");
+    TRIAL_PROTOCOL_TEST_EQUAL(sum, 24);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 0);
+    TRIAL_PROTOCOL_TEST(!work.done());
+    source.resume("");
+    TRIAL_PROTOCOL_TEST(work.done());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end);
+}
+
+task read_strings(json::async_reader<deferred_source>& reader, std::vector<std::string>& output)
+{
+    while (true)
+    {
+        const bool proceed = co_await reader.next();
+        if (!proceed)
+            break;
+        if (reader.symbol() == token::symbol::string)
+        {
+            output.push_back(reader.value<std::string>());
+        }
+    }
+}
+
+void suspend_string()
+{
+    deferred_source source;
+    json::async_reader<deferred_source> reader(source);
+    std::vector<std::string> output;
+    task work = read_strings(reader, output);
+    source.resume(R"(["al)");
+    TRIAL_PROTOCOL_TEST(output.empty());
+    source.resume(R"(pha", "bra\)");
+    TRIAL_PROTOCOL_TEST_EQUAL(output.size(), 1);
+    source.resume(R"("vo"])");
+    TRIAL_PROTOCOL_TEST_EQUAL(output.size(), 2);
+    source.resume("");
+    TRIAL_PROTOCOL_TEST(work.done());
+    work.get();
+    TRIAL_PROTOCOL_TEST_EQUAL(output[0], "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(output[1], "bra\"vo");
+}
+
+void fail_source()
+{
+    deferred_source source;
+    json::async_reader<deferred_source> reader(source);
+    int sum = 0;
+    task work = sum_array(reader, sum);
+    source.resume("[1, 2");
+    source.fail();
+    TRIAL_PROTOCOL_TEST(work.done());
+    TRIAL_PROTOCOL_TEST_THROWS(work.get(), std::runtime_error);
+    TRIAL_PROTOCOL_TEST_EQUAL(sum, 1);
+}
+
+void run()
+{
+    suspend_number();
+    suspend_string();
+    fail_source();
+}
+
+} // namespace suspend_suite
+
+//-----------------------------------------------------------------------------
+// Pipe
+//-----------------------------------------------------------------------------
+
+namespace pipe_suite
+{
+
+// Writes the pieces into a pipe and resumes the reader when the pipe is
+// readable
+std::string pipe_collect(const std::vector<std::string>& pieces)
+{
+    int descriptors[2];
+    TRIAL_PROTOCOL_TEST_EQUAL(::pipe(descriptors), 0);
+    ::fcntl(descriptors[0], F_SETFL, ::fcntl(descriptors[0], F_GETFL) | O_NONBLOCK);
+
+    pipe_source source(descriptors[0]);
+    json::async_reader<pipe_source> reader(source, 16);
+    std::string result;
+    task work = collect(reader, result);
+    for (const auto& piece : pieces)
+    {
+        TRIAL_PROTOCOL_TEST_EQUAL(::write(descriptors[1], piece.data(), piece.size()),
+                                  ssize_t(piece.size()));
+        while (source.waiting && source.readable())
+        {
+            std::exchange(source.waiting, nullptr).resume();
+        }
+    }
+    ::close(descriptors[1]);
+    while (source.waiting)
+    {
+        std::exchange(source.waiting, nullptr).resume();
+    }
+    ::close(descriptors[0]);
+    TRIAL_PROTOCOL_TEST(work.done());
+    work.get();
+    return result;
+}
+
+void pipe_document()
+{
+    const std::vector<std::string> pieces = {
+        R"( {"alpha": [nu)",
+        R"(ll, true, false, 123)",
+        R"(45, -0.25e)",
+        R"(+1, "bra\)",
+        R"("vo"], "charlie" : {"delta":""}, "echo":[[], {}]} )",
+    };
+    std::string document;
+    for (const auto& piece : pieces)
+    {
+        document += piece;
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(pipe_collect(pieces), expect(document));
+}
+
+void pipe_characters()
+{
+    const std::string document = R"({"alpha": [1, 2.5, "bravo"]})";
+    std::vector<std::string> pieces;
+    for (auto character : document)
+    {
+        pieces.emplace_back(1, character);
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(pipe_collect(pieces), expect(document));
+}
+
+void run()
+{
+    pipe_document();
+    pipe_characters();
+}
+
+} // namespace pipe_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    chunk_suite::run();
+    suspend_suite::run();
+    pipe_suite::run();
+
+    return boost::report_errors();
+}
@@ -1799,12 +1799,25 @@ void fail_as_float()
                                     json::error, "incompatible type");
 }
 
+void test_has_escape()
+{
+    TRIAL_PROTOCOL_TEST(!decoder_type("\"\"").has_escape());
+    TRIAL_PROTOCOL_TEST(!decoder_type("\"alpha\"").has_escape());
+    TRIAL_PROTOCOL_TEST(!decoder_type("\"\xC3\xA6\"").has_escape());
+    TRIAL_PROTOCOL_TEST(decoder_type("\"\\n\"").has_escape());
+    TRIAL_PROTOCOL_TEST(decoder_type("\"\\nalpha\"").has_escape());
+    TRIAL_PROTOCOL_TEST(decoder_type("\"alpha\\n\"").has_escape());
+    TRIAL_PROTOCOL_TEST(decoder_type("\"alpha\\nbravo\"").has_escape());
+    TRIAL_PROTOCOL_TEST(decoder_type("\"\\u0041\\u0042\"").has_escape());
+}
+
 void run()
 {
     test_empty();
     test_space();
     test_alpha();
     test_alpha_bravo();
+    test_has_escape();
     test_escape_quote();
     test_escape_reverse_solidus();
     test_escape_solidus();
@@ -2723,6 +2736,129 @@ void run()
 
 } // namespace collector_suite
 
+//-----------------------------------------------------------------------------
+// Trusted input
+//-----------------------------------------------------------------------------
+
+namespace trusted_suite
+{
+
+using trusted_decoder_type = json::detail::basic_decoder<char, json::validation::trusted>;
+
+// Well-formed input is decoded as with validation
+
+void compare(const std::string& input)
+{
+    decoder_type strict(input.data(), input.size());
+    trusted_decoder_type trusted(input.data(), input.size());
+    while (true)
+    {
+        TRIAL_PROTOCOL_TEST_EQUAL(trusted.code(), strict.code());
+        TRIAL_PROTOCOL_TEST_EQUAL(std::string(trusted.literal().begin(), trusted.literal().end()),
+                                  std::string(strict.literal().begin(), strict.literal().end()));
+        switch (strict.code())
+        {
+        case token::code::integer:
+            TRIAL_PROTOCOL_TEST_EQUAL(trusted.signed_value<long long>(),
+                                      strict.signed_value<long long>());
+            break;
+        case token::code::real:
+            TRIAL_PROTOCOL_TEST_EQUAL(trusted.real_value<double>(),
+                                      strict.real_value<double>());
+            break;
+        case token::code::string:
+            TRIAL_PROTOCOL_TEST_EQUAL(trusted.string_value<std::string>(),
+                                      strict.string_value<std::string>());
+            TRIAL_PROTOCOL_TEST_EQUAL(trusted.has_escape(), strict.has_escape());
+            break;
+        default:
+            break;
+        }
+        if (strict.code() == token::code::end)
+            break;
+        strict.next();
+        trusted.next();
+    }
+}
+
+void test_number()
+{
+    compare("0");
+    compare("-0");
+    compare("12345");
+    compare("-12345");
+    compare("0.5");
+    compare("-1.25");
+    compare("1e2");
+    compare("1E+2");
+    compare("-1.5e-2");
+    compare("[1,-2,3.5,4e1]");
+}
+
+void test_string()
+{
+    compare("\"\"");
+    compare("\"alpha\"");
+    compare("\"alpha\\\"bravo\\\\charlie\\/delta\\b\\f\\n\\r\\t\"");
+    compare("\"\\u0041\\u00e6\\u20AC\"");
+    compare("\"alpha\\u0041bravo\"");
+    compare("\"\xC3\xA6\xE2\x82\xAC\xF0\x9F\x98\x80\"");
+    compare("\"alpha\xC3\xA6" "bravo\\ncharlie\xE2\x82\xAC" "delta\"");
+    compare("[\"alpha\", {\"bravo\": \"charlie\"}]");
+}
+
+void test_string_segments()
+{
+    // More segments than are recorded during scanning
+    std::string input = "\"";
+    for (int i = 0; i < 40; ++i)
+    {
+        input += "alpha\\n\xC3\xA6";
+    }
+    input += "\"";
+    compare(input);
+}
+
+void test_unchecked()
+{
+    // Grammar is not checked
+    trusted_decoder_type decoder("01");
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.literal(), "01");
+}
+
+void fail_string_eof()
+{
+    // Bounds are still checked
+    {
+        trusted_decoder_type decoder("\"alpha");
+        TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::error_unexpected_token);
+    }
+    {
+        trusted_decoder_type decoder("\"alpha\\");
+        TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::error_unexpected_token);
+    }
+    {
+        trusted_decoder_type decoder("\"\\u00");
+        TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::error_unexpected_token);
+    }
+    {
+        trusted_decoder_type decoder("\"\xE2\x82");
+        TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::code::error_unexpected_token);
+    }
+}
+
+void run()
+{
+    test_number();
+    test_string();
+    test_string_segments();
+    test_unchecked();
+    fail_string_eof();
+}
+
+} // namespace trusted_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -2741,6 +2877,7 @@ int main()
     container_suite::run();
     view_suite::run();
     collector_suite::run();
+    trusted_suite::run();
 
     return boost::report_errors();
 }
@@ -0,0 +1,237 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/json/filter.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+namespace token = json::token;
+
+namespace
+{
+
+std::string apply(const json::filter& filter, const std::string& input)
+{
+    std::string result;
+    json::reader reader(input);
+    json::writer writer(result);
+    filter.apply(reader, writer);
+    return result;
+}
+
+void redact(const json::filter::match&, json::writer& writer)
+{
+    writer.value("***");
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Passthrough
+//-----------------------------------------------------------------------------
+
+namespace passthrough_suite
+{
+
+void pass_value()
+{
+    json::filter filter;
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, "42"), "42");
+}
+
+void pass_container()
+{
+    json::filter filter;
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, R"({ "alpha" : [1, 2.0, "bravo"] })"),
+                              R"({ "alpha" : [1, 2.0, "bravo"] })");
+}
+
+void pass_unselected_subtree()
+{
+    json::filter filter;
+    filter.erase("/alpha/bravo");
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, R"({ "alpha" : { "charlie" : [ 1, 2 ] }, "delta" : { "echo" : null } })"),
+                              R"({"alpha":{"charlie":[ 1, 2 ]},"delta":{ "echo" : null }})");
+}
+
+void run()
+{
+    pass_value();
+    pass_container();
+    pass_unselected_subtree();
+}
+
+} // namespace passthrough_suite
+
+//-----------------------------------------------------------------------------
+// Replace
+//-----------------------------------------------------------------------------
+
+namespace replace_suite
+{
+
+void replace_member()
+{
+    json::filter filter;
+    TRIAL_PROTOCOL_TEST_EQUAL(filter.replace("/user/password", redact), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, R"({"user": {"name": "alpha", "password": "bravo"}, "id": 42})"),
+                              R"({"user":{"name":"alpha","password":"***"},"id":42})");
+}
+
+void replace_wildcard()
+{
+    json::filter filter;
+    filter.replace("/*/secret", redact);
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, R"([{"secret": 1}, {"public": 2}, {"secret": [3]}])"),
+                              R"([{"secret":"***"},{"public":2},{"secret":"***"}])");
+}
+
+void replace_container()
+{
+    json::filter filter;
+    filter.replace("/alpha", redact);
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, R"({"alpha": {"bravo": [1, 2]}})"),
+                              R"({"alpha":"***"})");
+}
+
+void replace_with_match()
+{
+    json::filter filter;
+    filter.replace("/price",
+                   [] (const json::filter::match& entry, json::writer& writer)
+                   {
+                       writer.value(entry.value<int>() * 2);
+                   });
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, R"({"price": 21})"),
+                              R"({"price":42})");
+}
+
+void replace_root()
+{
+    json::filter filter;
+    filter.replace("", redact);
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, R"([1, 2])"), R"("***")");
+}
+
+void replace_first_rule()
+{
+    json::filter filter;
+    filter.erase("/alpha");
+    filter.replace("/alpha", redact);
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, R"({"alpha": 1, "bravo": 2})"),
+                              R"({"bravo":2})");
+}
+
+void fail_empty_callback()
+{
+    json::filter filter;
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(filter.replace("/alpha", json::filter::callback_type()),
+                                    json::error,
+                                    "invalid value");
+}
+
+void run()
+{
+    replace_member();
+    replace_wildcard();
+    replace_container();
+    replace_with_match();
+    replace_root();
+    replace_first_rule();
+    fail_empty_callback();
+}
+
+} // namespace replace_suite
+
+//-----------------------------------------------------------------------------
+// Erase
+//-----------------------------------------------------------------------------
+
+namespace erase_suite
+{
+
+void erase_member()
+{
+    json::filter filter;
+    filter.erase("/bravo");
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, R"({"alpha": 1, "bravo": [2], "charlie": 3})"),
+                              R"({"alpha":1,"charlie":3})");
+}
+
+void erase_first_member()
+{
+    json::filter filter;
+    filter.erase("/alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, R"({"alpha": 1, "bravo": 2})"),
+                              R"({"bravo":2})");
+}
+
+void erase_element()
+{
+    json::filter filter;
+    filter.erase("/1");
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, R"([1, 2, 3])"), R"([1,3])");
+}
+
+void erase_nested()
+{
+    json::filter filter;
+    filter.erase("/items/*/internal");
+    TRIAL_PROTOCOL_TEST_EQUAL(apply(filter, R"({"items": [{"id": 1, "internal": true}, {"internal": false, "id": 2}]})"),
+                              R"({"items":[{"id":1},{"id":2}]})");
+}
+
+void fail_truncated()
+{
+    json::filter filter;
+    filter.erase("/alpha/bravo");
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(apply(filter, R"({"alpha": {"bravo": 1)"),
+                                    json::error,
+                                    "expected end object bracket");
+}
+
+void fail_malformed()
+{
+    json::filter filter;
+    filter.erase("/alpha");
+    std::string result;
+    json::reader reader(R"({"bravo": [1 2]})");
+    json::writer writer(result);
+    std::error_code ec;
+    filter.apply(reader, writer, ec);
+    TRIAL_PROTOCOL_TEST(ec);
+}
+
+void run()
+{
+    erase_member();
+    erase_first_member();
+    erase_element();
+    erase_nested();
+    fail_truncated();
+    fail_malformed();
+}
+
+} // namespace erase_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    passthrough_suite::run();
+    replace_suite::run();
+    erase_suite::run();
+
+    return boost::report_errors();
+}
@@ -502,6 +502,39 @@ void test_nested()
     TRIAL_PROTOCOL_TEST_EQUAL(value[0][0], true);
 }
 
+void test_int()
+{
+    const char input[] = "[1,-2,3]";
+    json::iarchive in(input);
+    std::vector<int> value;
+    TRIAL_PROTOCOL_TEST_NO_THROW(in >> value);
+    std::vector<int> expected = { 1, -2, 3 };
+    TRIAL_PROTOCOL_TEST_ALL_EQUAL(value.begin(), value.end(),
+                                  expected.begin(), expected.end());
+}
+
+void test_double()
+{
+    const char input[] = "[[0.5,1],[]]";
+    json::iarchive in(input);
+    std::vector< std::vector<double> > value;
+    TRIAL_PROTOCOL_TEST_NO_THROW(in >> value);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.size(), 2U);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[0].size(), 2U);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[0][0], 0.5);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[0][1], 1.0);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[1].size(), 0U);
+}
+
+void fail_int_mixed()
+{
+    const char input[] = "[1,\"alpha\"]";
+    json::iarchive in(input);
+    std::vector<int> value;
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(in >> value,
+                                    json::error, "invalid value");
+}
+
 void fail_mixed()
 {
     // Although this is legal JSON, we cannot deserialize it into a vector<bool>
@@ -545,6 +578,9 @@ void run()
     test_bool_one();
     test_bool_two();
     test_nested();
+    test_int();
+    test_double();
+    fail_int_mixed();
     fail_mixed();
     fail_missing_end();
     fail_missing_begin();
@@ -619,6 +619,111 @@ void run()
 
 } // namespace record_suite
 
+//-----------------------------------------------------------------------------
+// Schema
+//-----------------------------------------------------------------------------
+
+namespace schema_suite
+{
+
+struct point
+{
+    int x;
+    int y;
+};
+
+struct line
+{
+    std::string name;
+    point from;
+    point to;
+};
+
+const auto point_schema = json::make_schema<point>(
+    json::field("x", &point::x),
+    json::field("y", &point::y));
+
+const auto line_schema = json::make_schema<line>(
+    json::field("name", &line::name),
+    json::field("from", &line::from, point_schema),
+    json::field("to", &line::to, point_schema));
+
+} // namespace schema_suite
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+template <>
+struct schema_traits<schema_suite::point>
+{
+    static const decltype(schema_suite::point_schema)& get() { return schema_suite::point_schema; }
+};
+
+template <>
+struct schema_traits<schema_suite::line>
+{
+    static const decltype(schema_suite::line_schema)& get() { return schema_suite::line_schema; }
+};
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+namespace schema_suite
+{
+
+void test_struct()
+{
+    std::ostringstream result;
+    json::oarchive ar(result);
+    point value = { 1, 2 };
+    ar << value;
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "{\"x\":1,\"y\":2}");
+}
+
+void test_nested()
+{
+    std::ostringstream result;
+    json::oarchive ar(result);
+    line value = { "alpha", { 1, 2 }, { 3, 4 } };
+    ar << value;
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "{\"name\":\"alpha\",\"from\":{\"x\":1,\"y\":2},\"to\":{\"x\":3,\"y\":4}}");
+}
+
+void test_vector()
+{
+    std::ostringstream result;
+    json::oarchive ar(result);
+    std::vector<point> value = { { 1, 2 }, { 3, 4 } };
+    ar << value;
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "[{\"x\":1,\"y\":2},{\"x\":3,\"y\":4}]");
+}
+
+void test_map()
+{
+    std::ostringstream result;
+    json::oarchive ar(result);
+    std::map<std::string, point> value;
+    value["alpha"] = { 1, 2 };
+    value["bravo"] = { 3, 4 };
+    ar << value;
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "{\"alpha\":{\"x\":1,\"y\":2},\"bravo\":{\"x\":3,\"y\":4}}");
+}
+
+void run()
+{
+    test_struct();
+    test_nested();
+    test_vector();
+    test_map();
+}
+
+} // namespace schema_suite
+
 //-----------------------------------------------------------------------------
 // dynamic::variable
 //-----------------------------------------------------------------------------
@@ -721,6 +826,7 @@ int main()
     map_suite::run();
     set_suite::run();
     record_suite::run();
+    schema_suite::run();
     dynamic_suite::run();
 
     return boost::report_errors();
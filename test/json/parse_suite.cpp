@@ -13,6 +13,8 @@
 #include <iomanip>
 #include <trial/protocol/buffer/string.hpp>
 #include <trial/protocol/json/parse.hpp>
+#include <trial/dynamic/compact.hpp>
+#include <trial/dynamic/string_pool.hpp>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
 
 using namespace trial::dynamic;
@@ -368,6 +370,44 @@ void parse_map_nested_map()
                                  std::equal_to<variable>());
 }
 
+void parse_compact()
+{
+    std::string input = "{\"alpha\":null,\"bravo\":[true,2,3.0,\"hydrogen\"]}";
+    auto result = json::parse<std::string, compact_allocator<>>(input);
+    TRIAL_PROTOCOL_TEST(result.is<map>());
+
+    compact_variable expect =
+        {
+            { "alpha", null },
+            { "bravo", { true, 2, 3.0, "hydrogen" } }
+        };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expect.begin(), expect.end(),
+                                 std::equal_to<compact_variable>());
+}
+
+void parse_pool()
+{
+    std::string input = "[{\"alpha\":1,\"bravo\":2},{\"alpha\":3,\"bravo\":4}]";
+    string_pool pool;
+    auto result = json::parse(input, pool);
+    TRIAL_PROTOCOL_TEST(result.is<array>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 2);
+    TRIAL_PROTOCOL_TEST(result[0]["alpha"] == 1);
+    TRIAL_PROTOCOL_TEST(result[1]["bravo"] == 4);
+
+    // Keys share storage across objects and documents
+    auto other = json::parse(std::string("{\"alpha\":5}"), pool);
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 2);
+    const auto& document = result;
+    const auto& first = (*document[0].key_begin()).assume_value<std::string>();
+    const auto& second = (*document[1].key_begin()).assume_value<std::string>();
+    const auto& third = (*other.key_begin()).assume_value<std::string>();
+    TRIAL_PROTOCOL_TEST(&first == &second);
+    TRIAL_PROTOCOL_TEST(&first == &third);
+}
+
 void run()
 {
     parse_empty();
@@ -384,6 +424,8 @@ void run()
     parse_map();
     parse_map_nested_array();
     parse_map_nested_map();
+    parse_compact();
+    parse_pool();
 }
 
 } // namespace parser_suite
@@ -0,0 +1,461 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <trial/protocol/json/push_parser.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+
+namespace
+{
+
+// Records events in a compact notation
+
+class recorder : public json::push_parser<recorder>
+{
+public:
+    recorder(std::size_t limit = std::size_t(-1))
+        : limit(limit)
+    {
+    }
+
+    bool on_null() { return add("null"); }
+    bool on_boolean(bool value) { return add(value ? "true" : "false"); }
+    bool on_integer(std::intmax_t value) { return add("i" + std::to_string(value)); }
+    bool on_real(double value) { return add("r" + std::to_string(value)); }
+    bool on_string(const view_type& value) { return add("s" + std::string(value.data(), value.size())); }
+    bool on_key(const view_type& value) { return add("k" + std::string(value.data(), value.size())); }
+    bool on_begin_array() { return add("["); }
+    bool on_end_array() { return add("]"); }
+    bool on_begin_object() { return add("{"); }
+    bool on_end_object() { return add("}"); }
+
+    std::string events;
+
+private:
+    bool add(const std::string& event)
+    {
+        if (!events.empty())
+        {
+            events += ' ';
+        }
+        events += event;
+        return --limit > 0;
+    }
+
+    std::size_t limit;
+};
+
+// Records numbers by handler
+
+class number_recorder : public json::push_parser<number_recorder>
+{
+public:
+    bool on_integer(std::intmax_t value) { return add("i" + std::to_string(value)); }
+    bool on_unsigned_integer(std::uintmax_t value) { return add("u" + std::to_string(value)); }
+    bool on_real(double value) { return add("r" + std::to_string(value)); }
+
+    std::string events;
+
+private:
+    bool add(const std::string& event)
+    {
+        if (!events.empty())
+        {
+            events += ' ';
+        }
+        events += event;
+        return true;
+    }
+};
+
+// Only counts strings
+
+class string_counter : public json::push_parser<string_counter>
+{
+public:
+    bool on_string(const view_type&) { ++count; return true; }
+
+    int count = 0;
+};
+
+std::string parse(const std::string& input)
+{
+    recorder parser;
+    TRIAL_PROTOCOL_TEST(parser.parse(input));
+    TRIAL_PROTOCOL_TEST(parser.finish());
+    return parser.events;
+}
+
+std::error_code fail(const std::string& input)
+{
+    recorder parser;
+    if (parser.parse(input))
+    {
+        parser.finish();
+    }
+    TRIAL_PROTOCOL_TEST(!parser.aborted());
+    return parser.error();
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Values
+//-----------------------------------------------------------------------------
+
+namespace value_suite
+{
+
+void parse_scalar()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("null"), "null");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("true"), "true");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("false"), "false");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("42"), "i42");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("-42"), "i-42");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("0.5"), "r0.500000");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("1e2"), "r100.000000");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse(R"("alpha")"), "salpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse(R"("")"), "s");
+}
+
+void parse_escaped()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(parse(R"("a\"b")"), "sa\"b");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse(R"("A\n")"), "sA\n");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse(R"({"a\\b":1})"), "{ ka\\b i1 }");
+}
+
+void parse_whitespace()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(parse(" \t\n 42 \r\n "), "i42");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse(" [ 1 , 2 ] "), "[ i1 i2 ]");
+}
+
+void parse_array()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("[]"), "[ ]");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("[null,true,1,2.0,\"x\"]"), "[ null true i1 r2.000000 sx ]");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("[[],[[]]]"), "[ [ ] [ [ ] ] ]");
+}
+
+void parse_object()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("{}"), "{ }");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse(R"({"a":1,"b":"c"})"), "{ ka i1 kb sc }");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse(R"({"a":{"b":[{}]}})"), "{ ka { kb [ { } ] } }");
+}
+
+void parse_large_integer()
+{
+    // Forwarded to on_real() by default
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("18446744073709551615"), "r18446744073709551616.000000");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("[9223372036854775808]"), "[ r9223372036854775808.000000 ]");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("[-9223372036854775809]"), "[ r-9223372036854775808.000000 ]");
+    TRIAL_PROTOCOL_TEST_EQUAL(parse("99999999999999999999"), "r100000000000000000000.000000");
+
+    number_recorder parser;
+    TRIAL_PROTOCOL_TEST(parser.parse("[9223372036854775807, 9223372036854775808,"
+                                     " 18446744073709551615, 18446744073709551616,"
+                                     " -9223372036854775808, -9223372036854775809]"));
+    TRIAL_PROTOCOL_TEST(parser.finish());
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events,
+                              "i9223372036854775807 u9223372036854775808"
+                              " u18446744073709551615 r18446744073709551616.000000"
+                              " i-9223372036854775808 r-9223372036854775808.000000");
+}
+
+void parse_default_handlers()
+{
+    string_counter parser;
+    TRIAL_PROTOCOL_TEST(parser.parse(R"({"a":["b",1,null,{"c":"d"}]})"));
+    TRIAL_PROTOCOL_TEST(parser.finish());
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.count, 2);
+}
+
+void parse_level()
+{
+    recorder parser;
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.level(), 0);
+    TRIAL_PROTOCOL_TEST(parser.parse("[{\"a\":["));
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.level(), 3);
+    TRIAL_PROTOCOL_TEST(parser.parse("]}]"));
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.level(), 0);
+    TRIAL_PROTOCOL_TEST(parser.finish());
+}
+
+void parse_reset()
+{
+    recorder parser;
+    TRIAL_PROTOCOL_TEST(parser.parse("[1"));
+    parser.reset();
+    parser.events.clear();
+    TRIAL_PROTOCOL_TEST(parser.parse("2"));
+    TRIAL_PROTOCOL_TEST(parser.finish());
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, "i2");
+}
+
+void run()
+{
+    parse_scalar();
+    parse_escaped();
+    parse_whitespace();
+    parse_array();
+    parse_object();
+    parse_large_integer();
+    parse_default_handlers();
+    parse_level();
+    parse_reset();
+}
+
+} // namespace value_suite
+
+//-----------------------------------------------------------------------------
+// Chunks
+//-----------------------------------------------------------------------------
+
+namespace chunk_suite
+{
+
+const std::string document = R"( {"alpha": [null, true, false, 12345, -0.25e+1, "bra\"vo"], "charlie" : {"delta":""}, "echo":[]} )";
+const std::string expected = "{ kalpha [ null true false i12345 r-2.500000 sbra\"vo ] kcharlie { kdelta s } kecho [ ] }";
+
+void parse_split()
+{
+    // Split document at every position
+    for (std::size_t split = 0; split <= document.size(); ++split)
+    {
+        recorder parser;
+        TRIAL_PROTOCOL_TEST(parser.parse(document.substr(0, split)));
+        TRIAL_PROTOCOL_TEST(parser.parse(document.substr(split)));
+        TRIAL_PROTOCOL_TEST(parser.finish());
+        TRIAL_PROTOCOL_TEST_EQUAL(parser.events, expected);
+    }
+}
+
+void parse_characters()
+{
+    recorder parser;
+    for (auto character : document)
+    {
+        TRIAL_PROTOCOL_TEST(parser.parse(std::string(1, character)));
+    }
+    TRIAL_PROTOCOL_TEST(parser.finish());
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, expected);
+}
+
+void parse_empty_chunks()
+{
+    recorder parser;
+    TRIAL_PROTOCOL_TEST(parser.parse(""));
+    TRIAL_PROTOCOL_TEST(parser.parse("[1"));
+    TRIAL_PROTOCOL_TEST(parser.parse(""));
+    TRIAL_PROTOCOL_TEST(parser.parse("2]"));
+    TRIAL_PROTOCOL_TEST(parser.finish());
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, "[ i12 ]");
+}
+
+void parse_number_at_end()
+{
+    // Number is only complete at the end of the input
+    recorder parser;
+    TRIAL_PROTOCOL_TEST(parser.parse("12"));
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, "");
+    TRIAL_PROTOCOL_TEST(parser.parse("34"));
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, "");
+    TRIAL_PROTOCOL_TEST(parser.finish());
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, "i1234");
+}
+
+void parse_events_before_end()
+{
+    // Events are invoked as soon as tokens are complete
+    recorder parser;
+    TRIAL_PROTOCOL_TEST(parser.parse("[\"alpha\", 1"));
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, "[ salpha");
+    TRIAL_PROTOCOL_TEST(parser.parse(", tr"));
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, "[ salpha i1");
+    TRIAL_PROTOCOL_TEST(parser.parse("ue]"));
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, "[ salpha i1 true ]");
+    TRIAL_PROTOCOL_TEST(parser.finish());
+}
+
+void fail_truncated()
+{
+    recorder parser;
+    TRIAL_PROTOCOL_TEST(parser.parse("[1, \"alp"));
+    TRIAL_PROTOCOL_TEST(!parser.finish());
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.error(), json::make_error_code(json::unexpected_token));
+}
+
+void fail_incomplete()
+{
+    recorder parser;
+    TRIAL_PROTOCOL_TEST(parser.parse("[1, 2"));
+    TRIAL_PROTOCOL_TEST(parser.parse("]"));
+    TRIAL_PROTOCOL_TEST(!parser.parse(" [3"));
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.error(), json::make_error_code(json::unexpected_token));
+
+    recorder other;
+    TRIAL_PROTOCOL_TEST(other.parse("[1, 2"));
+    TRIAL_PROTOCOL_TEST(!other.finish());
+    TRIAL_PROTOCOL_TEST_EQUAL(other.error(), json::make_error_code(json::insufficient_tokens));
+}
+
+void fail_error_in_chunk()
+{
+    // Errors inside a chunk are reported without waiting for more input
+    recorder parser;
+    TRIAL_PROTOCOL_TEST(!parser.parse("[1, ], 2, 3"));
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.error(), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST(!parser.parse("4"));
+    TRIAL_PROTOCOL_TEST(!parser.finish());
+}
+
+void run()
+{
+    parse_split();
+    parse_characters();
+    parse_empty_chunks();
+    parse_number_at_end();
+    parse_events_before_end();
+    fail_truncated();
+    fail_incomplete();
+    fail_error_in_chunk();
+}
+
+} // namespace chunk_suite
+
+//-----------------------------------------------------------------------------
+// Abort
+//-----------------------------------------------------------------------------
+
+namespace abort_suite
+{
+
+void abort_first()
+{
+    recorder parser(1);
+    TRIAL_PROTOCOL_TEST(!parser.parse("[1,2,3]"));
+    TRIAL_PROTOCOL_TEST(parser.aborted());
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.error(), json::make_error_code(json::no_error));
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, "[");
+}
+
+void abort_middle()
+{
+    recorder parser(3);
+    TRIAL_PROTOCOL_TEST(!parser.parse(R"({"a":"b","c":"d"})"));
+    TRIAL_PROTOCOL_TEST(parser.aborted());
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, "{ ka sb");
+    TRIAL_PROTOCOL_TEST(!parser.parse("[]"));
+    TRIAL_PROTOCOL_TEST(!parser.finish());
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, "{ ka sb");
+}
+
+void abort_finish()
+{
+    recorder parser(1);
+    TRIAL_PROTOCOL_TEST(parser.parse("42"));
+    TRIAL_PROTOCOL_TEST(!parser.finish());
+    TRIAL_PROTOCOL_TEST(parser.aborted());
+    TRIAL_PROTOCOL_TEST_EQUAL(parser.events, "i42");
+}
+
+void run()
+{
+    abort_first();
+    abort_middle();
+    abort_finish();
+}
+
+} // namespace abort_suite
+
+//-----------------------------------------------------------------------------
+// Errors
+//-----------------------------------------------------------------------------
+
+namespace error_suite
+{
+
+void fail_empty()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(fail(""), json::make_error_code(json::insufficient_tokens));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("  "), json::make_error_code(json::insufficient_tokens));
+}
+
+void fail_outer()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("]"), json::make_error_code(json::unbalanced_end_array));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("}"), json::make_error_code(json::unbalanced_end_object));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail(","), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("1 2"), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("[] []"), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("[]]"), json::make_error_code(json::unexpected_token));
+}
+
+void fail_value()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("nul"), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("nullx"), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("-"), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("[1.]"), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("01"), json::make_error_code(json::invalid_value));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("[@]"), json::make_error_code(json::unexpected_token));
+}
+
+void fail_array()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("[1,]"), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("[,1]"), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("[1 2]"), json::make_error_code(json::expected_end_array));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("[}"), json::make_error_code(json::expected_end_array));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("[1}"), json::make_error_code(json::expected_end_array));
+}
+
+void fail_object()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("{1:2}"), json::make_error_code(json::invalid_key));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail(R"({"a":1,2:3})"), json::make_error_code(json::invalid_key));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail(R"({"a" 1})"), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail(R"({"a":})"), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail(R"({"a":1,})"), json::make_error_code(json::unexpected_token));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail(R"({"a":1 "b":2})"), json::make_error_code(json::expected_end_object));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail("{]"), json::make_error_code(json::expected_end_object));
+    TRIAL_PROTOCOL_TEST_EQUAL(fail(R"({"a":1])"), json::make_error_code(json::expected_end_object));
+}
+
+void run()
+{
+    fail_empty();
+    fail_outer();
+    fail_value();
+    fail_array();
+    fail_object();
+}
+
+} // namespace error_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    value_suite::run();
+    chunk_suite::run();
+    abort_suite::run();
+    error_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,240 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include <trial/protocol/json/query.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+namespace token = json::token;
+
+//-----------------------------------------------------------------------------
+// Paths
+//-----------------------------------------------------------------------------
+
+namespace path_suite
+{
+
+void insert_paths()
+{
+    json::query query;
+    TRIAL_PROTOCOL_TEST_EQUAL(query.size(), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(query.insert("/alpha"), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(query.insert("/alpha/bravo"), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(query.insert("/alpha"), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(query.size(), 3);
+}
+
+void fail_relative()
+{
+    json::query query;
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(query.insert("alpha"),
+                                    json::error,
+                                    "invalid key");
+}
+
+void fail_escape()
+{
+    json::query query;
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(query.insert("/alpha~2"),
+                                    json::error,
+                                    "invalid key");
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(query.insert("/alpha~"),
+                                    json::error,
+                                    "invalid key");
+}
+
+void run()
+{
+    insert_paths();
+    fail_relative();
+    fail_escape();
+}
+
+} // namespace path_suite
+
+//-----------------------------------------------------------------------------
+// Evaluation
+//-----------------------------------------------------------------------------
+
+namespace evaluate_suite
+{
+
+void evaluate_root()
+{
+    json::query query({ "" });
+    auto result = query.evaluate("[1, 2]");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].path, 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].literal, "[1, 2]");
+}
+
+void evaluate_member()
+{
+    json::query query({ "/user/id" });
+    auto result = query.evaluate(R"({"name": "alpha", "user": {"name": "bravo", "id": 42}})");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].path, 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].literal, "42");
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].value<int>(), 42);
+}
+
+void evaluate_missing()
+{
+    json::query query({ "/user/id" });
+    auto result = query.evaluate(R"({"user": {"name": "bravo"}, "id": 42})");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 0);
+}
+
+void evaluate_index()
+{
+    json::query query({ "/1", "/0/alpha" });
+    auto result = query.evaluate(R"([{"alpha": true}, "bravo", "charlie"])");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].path, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].value<bool>(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1].path, 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1].value<std::string>(), "bravo");
+}
+
+void evaluate_index_key()
+{
+    // Array indices are object keys within objects
+    json::query query({ "/0" });
+    auto result = query.evaluate(R"({"0": 1, "00": 2})");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].literal, "1");
+}
+
+void evaluate_wildcard()
+{
+    json::query query({ "/items/*/price" });
+    auto result = query.evaluate(R"({"items": [{"price": 1}, {"name": "alpha"}, {"price": 2.5}]})");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].value<int>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1].value<double>(), 2.5);
+}
+
+void evaluate_wildcard_object()
+{
+    json::query query({ "/*/id" });
+    auto result = query.evaluate(R"({"alpha": {"id": 1}, "bravo": {"id": 2}})");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].value<int>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1].value<int>(), 2);
+}
+
+void evaluate_overlapping()
+{
+    json::query query({ "/alpha", "/alpha/bravo", "/*/bravo" });
+    auto result = query.evaluate(R"({"alpha": {"bravo": null}})");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].path, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].literal, "null");
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1].path, 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1].literal, "null");
+    TRIAL_PROTOCOL_TEST_EQUAL(result[2].path, 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[2].literal, R"({"bravo": null})");
+}
+
+void evaluate_escaped_path()
+{
+    json::query query({ "/a~1b", "/c~0d" });
+    auto result = query.evaluate(R"({"a/b": 1, "c~d": 2})");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].path, 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1].path, 1);
+}
+
+void evaluate_escaped_key()
+{
+    json::query query({ "/a\"b" });
+    auto result = query.evaluate(R"({"ab": 0, "a\"b": 1, "a\"c": 2})");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].literal, "1");
+}
+
+void evaluate_reader()
+{
+    json::query query({ "/alpha" });
+    json::reader reader(R"([{"alpha": 1}, {"alpha": 2}])");
+    TRIAL_PROTOCOL_TEST(reader.next());
+    std::vector<int> result;
+    auto callback = [&result] (const json::query::match& entry)
+        {
+            result.push_back(entry.value<int>());
+        };
+    query.evaluate(reader, callback);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_object);
+    query.evaluate(reader, callback);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1], 2);
+}
+
+void evaluate_relaxed()
+{
+    json::query query({ "/beta" });
+    query.relaxed(true);
+    auto result = query.evaluate(R"({"alpha": [1, {"x": "]"}, 3 4], "beta": {"y": 2}})");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].literal, R"({"y": 2})");
+}
+
+void fail_truncated()
+{
+    json::query query({ "/alpha/*" });
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(query.evaluate(R"({"alpha": [1, 2)"),
+                                    json::error,
+                                    "expected end array bracket");
+}
+
+void fail_malformed()
+{
+    json::query query({ "/alpha" });
+    json::reader reader(R"({"alpha": [1 2]})");
+    std::error_code ec;
+    query.evaluate(reader, [] (const json::query::match&) {}, ec);
+    TRIAL_PROTOCOL_TEST(ec);
+}
+
+void run()
+{
+    evaluate_root();
+    evaluate_member();
+    evaluate_missing();
+    evaluate_index();
+    evaluate_index_key();
+    evaluate_wildcard();
+    evaluate_wildcard_object();
+    evaluate_overlapping();
+    evaluate_escaped_path();
+    evaluate_escaped_key();
+    evaluate_reader();
+    evaluate_relaxed();
+    fail_truncated();
+    fail_malformed();
+}
+
+} // namespace evaluate_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    path_suite::run();
+    evaluate_suite::run();
+
+    return boost::report_errors();
+}
@@ -9,6 +9,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <scoped_allocator>
+#include <vector>
 #include <trial/protocol/json/reader.hpp>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
 
@@ -975,6 +976,344 @@ void run()
 
 } // namespace object_suite
 
+//-----------------------------------------------------------------------------
+// Sibling
+//-----------------------------------------------------------------------------
+
+namespace sibling_suite
+{
+
+void test_end_array()
+{
+    const char input[] = R"([[1, "]", {"[": "\""}], 2])";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_end(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 2);
+}
+
+void test_end_object()
+{
+    const char input[] = R"({"alpha": {"bravo": [1, 2, 3]}, "charlie": true})";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_object);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_end(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_object);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "charlie");
+}
+
+void test_sibling()
+{
+    const char input[] = R"([1, [2, [3]], {"alpha": [4]}, 5])";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_sibling(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_sibling(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_object);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_sibling(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 5);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_sibling(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 0);
+}
+
+void test_sibling_outer()
+{
+    const char input[] = R"({"alpha": [1, 2]})";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_sibling(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void test_unvalidated_content()
+{
+    const char input[] = R"([[1 2 alpha], 3])";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_sibling(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 3);
+}
+
+void fail_end_value()
+{
+    const char input[] = "[1]";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_end(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::error_unexpected_token);
+}
+
+void fail_missing_end()
+{
+    const char input[] = R"([[1, "]")";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_end(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::error_expected_end_array);
+}
+
+void fail_mismatched_end()
+{
+    const char input[] = "[{1]}";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next_end(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::error_expected_end_object);
+}
+
+void run()
+{
+    test_end_array();
+    test_end_object();
+    test_sibling();
+    test_sibling_outer();
+    test_unvalidated_content();
+    fail_end_value();
+    fail_missing_end();
+    fail_mismatched_end();
+}
+
+} // namespace sibling_suite
+
+//-----------------------------------------------------------------------------
+// Values
+//-----------------------------------------------------------------------------
+
+namespace values_suite
+{
+
+void test_empty()
+{
+    json::reader reader("[]");
+    std::vector<int> result;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::no_error);
+    TRIAL_PROTOCOL_TEST(result.empty());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end);
+}
+
+void test_integer()
+{
+    json::reader reader("[1, -2, 3]");
+    std::vector<int> result;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::no_error);
+    std::vector<int> expected = { 1, -2, 3 };
+    TRIAL_PROTOCOL_TEST_ALL_EQUAL(result.begin(), result.end(),
+                                  expected.begin(), expected.end());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end);
+}
+
+void test_real()
+{
+    json::reader reader("[0.5, 1, -2.25e1]");
+    std::vector<double> result;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::no_error);
+    std::vector<double> expected = { 0.5, 1.0, -22.5 };
+    TRIAL_PROTOCOL_TEST_ALL_EQUAL(result.begin(), result.end(),
+                                  expected.begin(), expected.end());
+}
+
+void test_append()
+{
+    json::reader reader("[2, 3]");
+    std::vector<int> result = { 1 };
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::no_error);
+    std::vector<int> expected = { 1, 2, 3 };
+    TRIAL_PROTOCOL_TEST_ALL_EQUAL(result.begin(), result.end(),
+                                  expected.begin(), expected.end());
+}
+
+void test_iterator()
+{
+    json::reader reader("[1, 2, 3]");
+    int result[3] = {};
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values<int>(result), json::no_error);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1], 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[2], 3);
+}
+
+void test_nested()
+{
+    json::reader reader("[[1, 2], [3], true]");
+    TRIAL_PROTOCOL_TEST(reader.next());
+    std::vector<int> result;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::no_error);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::no_error);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::boolean);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 3);
+}
+
+void test_resume()
+{
+    json::reader reader(R"([1, "alpha", [2], 3])");
+    std::vector<int> result;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::invalid_value);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::string);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 2);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_array);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 3);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_array);
+}
+
+void fail_not_array()
+{
+    json::reader reader("1");
+    std::vector<int> result;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::incompatible_type);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::integer);
+}
+
+void fail_missing_end()
+{
+    json::reader reader("[1, 2");
+    std::vector<int> result;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::expected_end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::error);
+}
+
+void fail_mismatched_end()
+{
+    json::reader reader("[1, 2}");
+    std::vector<int> result;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::expected_end_array);
+}
+
+void fail_missing_separator()
+{
+    json::reader reader("[1 2]");
+    std::vector<int> result;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::expected_end_array);
+}
+
+void fail_trailing_separator()
+{
+    json::reader reader("[1, 2,]");
+    std::vector<int> result;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::unexpected_token);
+}
+
+void fail_malformed_value()
+{
+    json::reader reader("[1, -]");
+    std::vector<int> result;
+    TRIAL_PROTOCOL_TEST(reader.values(result) != json::no_error);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::error);
+}
+
+void run()
+{
+    test_empty();
+    test_integer();
+    test_real();
+    test_append();
+    test_iterator();
+    test_nested();
+    test_resume();
+    fail_not_array();
+    fail_missing_end();
+    fail_mismatched_end();
+    fail_missing_separator();
+    fail_trailing_separator();
+    fail_malformed_value();
+}
+
+} // namespace values_suite
+
+//-----------------------------------------------------------------------------
+// Trusted input
+//-----------------------------------------------------------------------------
+
+namespace trusted_suite
+{
+
+void test_object()
+{
+    const char input[] = R"({"alpha": [null, true, -1.5e1, "bra\"vo"], "charlie": {"delta": 42}})";
+    json::trusted_reader reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_object);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::null);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<bool>(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<double>(), -15.0);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "bra\"vo");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "charlie");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "delta");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 42);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_object);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_object);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void test_values()
+{
+    json::trusted_reader reader("[1, -2, 3]");
+    std::vector<int> result;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.values(result), json::no_error);
+    std::vector<int> expected = { 1, -2, 3 };
+    TRIAL_PROTOCOL_TEST_ALL_EQUAL(result.begin(), result.end(),
+                                  expected.begin(), expected.end());
+}
+
+void fail_structure()
+{
+    // Structure is still validated
+    json::trusted_reader reader("[1 2]");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::error_expected_end_array);
+}
+
+void run()
+{
+    test_object();
+    test_values();
+    fail_structure();
+}
+
+} // namespace trusted_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -985,6 +1324,9 @@ int main()
     ubasic_suite::run();
     array_suite::run();
     object_suite::run();
+    sibling_suite::run();
+    values_suite::run();
+    trusted_suite::run();
 
     return boost::report_errors();
 }
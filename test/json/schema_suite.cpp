@@ -0,0 +1,360 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/json/schema.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+namespace token = json::token;
+
+namespace
+{
+
+struct point
+{
+    int x = 0;
+    int y = 0;
+};
+
+struct person
+{
+    std::string name;
+    int age = 0;
+    bool active = false;
+    double score = 0.0;
+    point location;
+    std::vector<int> numbers;
+    std::vector<point> path;
+};
+
+const auto point_schema = json::make_schema<point>(
+    json::field("x", &point::x),
+    json::field("y", &point::y));
+
+const auto person_schema = json::make_schema<person>(
+    json::field("name", &person::name),
+    json::field("age", &person::age),
+    json::field("active", &person::active),
+    json::field("score", &person::score),
+    json::field("location", &person::location, point_schema),
+    json::field("numbers", &person::numbers),
+    json::field("path", &person::path, point_schema));
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Schema
+//-----------------------------------------------------------------------------
+
+namespace schema_suite
+{
+
+void make_size()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(point_schema.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(person_schema.size(), 7);
+}
+
+void fail_duplicate_name()
+{
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::make_schema<point>(json::field("x", &point::x),
+                                                             json::field("x", &point::y)),
+                                    json::error,
+                                    "invalid key");
+}
+
+void run()
+{
+    make_size();
+    fail_duplicate_name();
+}
+
+} // namespace schema_suite
+
+//-----------------------------------------------------------------------------
+// Reading
+//-----------------------------------------------------------------------------
+
+namespace read_suite
+{
+
+void read_point()
+{
+    json::reader reader(R"({"x": 1, "y": 2})");
+    point result;
+    point_schema.read(reader, result);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.x, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.y, 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end);
+}
+
+void read_any_order()
+{
+    json::reader reader(R"({"y": 2, "x": 1})");
+    point result;
+    point_schema.read(reader, result);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.x, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.y, 2);
+}
+
+void read_missing()
+{
+    json::reader reader(R"({"y": 2})");
+    point result;
+    result.x = 42;
+    point_schema.read(reader, result);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.x, 42);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.y, 2);
+}
+
+void read_unknown()
+{
+    json::reader reader(R"({"z": [1, {"x": 3}], "x": 1, "xx": 4, "": 5, "y": 2})");
+    point result;
+    point_schema.read(reader, result);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.x, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.y, 2);
+}
+
+void read_duplicate()
+{
+    json::reader reader(R"({"x": 1, "x": 2})");
+    point result;
+    point_schema.read(reader, result);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.x, 2);
+}
+
+void read_escaped_key()
+{
+    json::reader reader(R"({"x": 1, "y\"": 2})");
+    point result;
+    point_schema.read(reader, result);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.x, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.y, 0);
+}
+
+void read_person()
+{
+    json::reader reader(R"({"path": [{"x": 1, "y": 2}, {"y": 4, "x": 3}], "name": "alpha", "age": 42, "active": true, "score": 0.5, "location": {"x": 5, "y": 6}, "numbers": [1, 2, 3]})");
+    person result;
+    person_schema.read(reader, result);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.name, "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.age, 42);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.active, true);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.score, 0.5);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.location.x, 5);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.location.y, 6);
+    std::vector<int> expected_numbers = { 1, 2, 3 };
+    TRIAL_PROTOCOL_TEST_ALL_EQUAL(result.numbers.begin(), result.numbers.end(),
+                                  expected_numbers.begin(), expected_numbers.end());
+    TRIAL_PROTOCOL_TEST_EQUAL(result.path.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.path[0].x, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.path[0].y, 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.path[1].x, 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.path[1].y, 4);
+}
+
+void read_empty()
+{
+    json::reader reader(R"({"numbers": [], "path": []})");
+    person result;
+    result.numbers.push_back(1);
+    person_schema.read(reader, result);
+    TRIAL_PROTOCOL_TEST(result.numbers.empty());
+    TRIAL_PROTOCOL_TEST(result.path.empty());
+}
+
+void read_array_of_objects()
+{
+    json::reader reader(R"([{"x": 1}, {"x": 2}])");
+    TRIAL_PROTOCOL_TEST(reader.next());
+    point result;
+    point_schema.read(reader, result);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.x, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_object);
+    point_schema.read(reader, result);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.x, 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_array);
+}
+
+void fail_not_object()
+{
+    json::reader reader("[1, 2]");
+    point result;
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(point_schema.read(reader, result),
+                                    json::error,
+                                    "incompatible type");
+}
+
+void fail_incompatible_member()
+{
+    json::reader reader(R"({"x": "alpha"})");
+    point result;
+    std::error_code ec;
+    point_schema.read(reader, result, ec);
+    TRIAL_PROTOCOL_TEST_EQUAL(ec, json::make_error_code(json::invalid_value));
+}
+
+void fail_incompatible_array()
+{
+    json::reader reader(R"({"numbers": 1})");
+    person result;
+    std::error_code ec;
+    person_schema.read(reader, result, ec);
+    TRIAL_PROTOCOL_TEST_EQUAL(ec, json::make_error_code(json::incompatible_type));
+}
+
+void fail_truncated()
+{
+    json::reader reader(R"({"x": 1, "y": )");
+    point result;
+    std::error_code ec;
+    point_schema.read(reader, result, ec);
+    TRIAL_PROTOCOL_TEST(ec);
+}
+
+void run()
+{
+    read_point();
+    read_any_order();
+    read_missing();
+    read_unknown();
+    read_duplicate();
+    read_escaped_key();
+    read_person();
+    read_empty();
+    read_array_of_objects();
+    fail_not_object();
+    fail_incompatible_member();
+    fail_incompatible_array();
+    fail_truncated();
+}
+
+} // namespace read_suite
+
+//-----------------------------------------------------------------------------
+// Writing
+//-----------------------------------------------------------------------------
+
+namespace write_suite
+{
+
+void write_point()
+{
+    std::string result;
+    json::writer writer(result);
+    point value;
+    value.x = 1;
+    value.y = 2;
+    point_schema.write(writer, value);
+    TRIAL_PROTOCOL_TEST_EQUAL(result, R"({"x":1,"y":2})");
+}
+
+void write_person()
+{
+    std::string result;
+    json::writer writer(result);
+    person value;
+    value.name = "alpha";
+    value.age = 42;
+    value.active = true;
+    value.score = 0.5;
+    value.location.x = 5;
+    value.location.y = 6;
+    value.numbers = { 1, 2, 3 };
+    value.path.resize(2);
+    value.path[1].x = 3;
+    person_schema.write(writer, value);
+    TRIAL_PROTOCOL_TEST_EQUAL(result, R"({"name":"alpha","age":42,"active":true,"score":0.500000000000000,"location":{"x":5,"y":6},"numbers":[1,2,3],"path":[{"x":0,"y":0},{"x":3,"y":0}]})");
+}
+
+void write_empty_vector()
+{
+    std::string result;
+    json::writer writer(result);
+    person value;
+    person_schema.write(writer, value);
+    TRIAL_PROTOCOL_TEST_EQUAL(result, R"({"name":"","age":0,"active":false,"score":0.00000000000000,"location":{"x":0,"y":0},"numbers":[],"path":[]})");
+}
+
+void write_array()
+{
+    std::string result;
+    json::writer writer(result);
+    point value;
+    writer.value<token::begin_array>();
+    point_schema.write(writer, value);
+    value.x = 1;
+    point_schema.write(writer, value);
+    writer.value(true);
+    writer.value<token::end_array>();
+    TRIAL_PROTOCOL_TEST_EQUAL(result, R"([{"x":0,"y":0},{"x":1,"y":0},true])");
+}
+
+void write_object()
+{
+    std::string result;
+    json::writer writer(result);
+    point value;
+    writer.value<token::begin_object>();
+    writer.value("alpha");
+    point_schema.write(writer, value);
+    writer.value("bravo");
+    point_schema.write(writer, value);
+    writer.value<token::end_object>();
+    TRIAL_PROTOCOL_TEST_EQUAL(result, R"({"alpha":{"x":0,"y":0},"bravo":{"x":0,"y":0}})");
+}
+
+void write_escaped_key()
+{
+    struct escaped
+    {
+        int value = 1;
+    };
+    const auto schema = json::make_schema<escaped>(json::field("a\"b", &escaped::value));
+    std::string result;
+    json::writer writer(result);
+    schema.write(writer, escaped());
+    TRIAL_PROTOCOL_TEST_EQUAL(result, R"({"a\"b":1})");
+
+    json::reader reader(result);
+    escaped output;
+    output.value = 0;
+    schema.read(reader, output);
+    TRIAL_PROTOCOL_TEST_EQUAL(output.value, 1);
+}
+
+void run()
+{
+    write_point();
+    write_person();
+    write_empty_vector();
+    write_array();
+    write_object();
+    write_escaped_key();
+}
+
+} // namespace write_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    schema_suite::run();
+    read_suite::run();
+    write_suite::run();
+
+    return boost::report_errors();
+}
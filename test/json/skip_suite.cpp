@@ -206,6 +206,81 @@ void fail_on_close_object()
     TRIAL_PROTOCOL_TEST_EQUAL(ec, json::errc::insufficient_tokens);
 }
 
+void test_relaxed_array()
+{
+    const char input[] = R"([
+        [],
+        [ "test", false, [32, "foo"] ],
+        [ "]", "\"]", {"[": "{"} ],
+        46
+    ])";
+    json::reader reader(input);
+    json::reader::view_type skipped;
+    TRIAL_PROTOCOL_TEST(reader.next());
+
+    skipped = json::partial::skip(reader, json::partial::skip_mode::relaxed);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, "[]");
+
+    skipped = json::partial::skip(reader, json::partial::skip_mode::relaxed);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, R"([ "test", false, [32, "foo"] ])");
+
+    skipped = json::partial::skip(reader, json::partial::skip_mode::relaxed);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, R"([ "]", "\"]", {"[": "{"} ])");
+
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 46);
+    skipped = json::partial::skip(reader, json::partial::skip_mode::relaxed);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, "46");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+}
+
+void test_relaxed_object()
+{
+    const char input[] = R"({"alpha": {"bravo": "charlie \\", "delta": [1, 2, 3, 4, 5, 6, 7, 8, 9, 10]}, "echo": null})";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST(reader.next());
+    auto skipped = json::partial::skip(reader, json::partial::skip_mode::relaxed);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, R"({"bravo": "charlie \\", "delta": [1, 2, 3, 4, 5, 6, 7, 8, 9, 10]})");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "echo");
+}
+
+void test_relaxed_one_object()
+{
+    json::reader reader(R"({"skip": "me"})");
+    auto skipped = json::partial::skip(reader, json::partial::skip_mode::relaxed);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, R"({"skip": "me"})");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void fail_relaxed_truncated()
+{
+    json::reader reader(R"({"skip": ["me"})");
+    std::error_code ec;
+    json::partial::skip(reader, json::partial::skip_mode::relaxed, ec);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::error);
+    TRIAL_PROTOCOL_TEST_EQUAL(ec, json::errc::insufficient_tokens);
+}
+
+void fail_relaxed_unterminated_string()
+{
+    json::reader reader(R"(["skip me])");
+    std::error_code ec;
+    json::partial::skip(reader, json::partial::skip_mode::relaxed, ec);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::error);
+    TRIAL_PROTOCOL_TEST_EQUAL(ec, json::errc::insufficient_tokens);
+}
+
+void fail_relaxed_comma_after_object()
+{
+    json::reader reader(R"({"skip": "me"},)");
+    std::error_code ec;
+    auto skipped = json::partial::skip(reader, json::partial::skip_mode::relaxed, ec);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, R"({"skip": "me"})");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::error);
+    TRIAL_PROTOCOL_TEST_EQUAL(ec, json::errc::unexpected_token);
+}
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -223,6 +298,12 @@ int main()
     fail_invalid_token_in_middle_of_object2();
     fail_on_close_array();
     fail_on_close_object();
+    test_relaxed_array();
+    test_relaxed_object();
+    test_relaxed_one_object();
+    fail_relaxed_truncated();
+    fail_relaxed_unterminated_string();
+    fail_relaxed_comma_after_object();
 
     return boost::report_errors();
 }
@@ -8,7 +8,10 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cstdint>
+#include <limits>
 #include <sstream>
+#include <vector>
 #include <trial/protocol/buffer/ostream.hpp>
 #include <trial/protocol/json/writer.hpp>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
@@ -265,6 +268,17 @@ void test_nested_bool_one()
     TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "[[false]]");
 }
 
+void test_literal_value()
+{
+    std::ostringstream result;
+    json::writer writer(result);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.literal_value("[1, 2]"), 6);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.literal_value("null"), 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "[[1, 2],null]");
+}
+
 void fail_missing_begin()
 {
     std::ostringstream result;
@@ -288,6 +302,7 @@ void run()
     test_bool_one();
     test_bool_two();
     test_nested_bool_one();
+    test_literal_value();
     fail_missing_begin();
     fail_mismatched_end();
 }
@@ -348,6 +363,19 @@ void test_nested_bool_one()
     TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "{\"key1\":{\"key2\":false}}");
 }
 
+void test_literal_value()
+{
+    std::ostringstream result;
+    json::writer writer(result);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_object>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.literal_value("\"key1\""), 6);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.literal_value("{}"), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value("key2"), 6);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.literal_value("true"), 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_object>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "{\"key1\":{},\"key2\":true}");
+}
+
 void fail_missing_begin()
 {
     std::ostringstream result;
@@ -371,12 +399,116 @@ void run()
     test_bool_one();
     test_bool_two();
     test_nested_bool_one();
+    test_literal_value();
     fail_missing_begin();
     fail_mismatched_end();
 }
 
 } // namespace object_suite
 
+//-----------------------------------------------------------------------------
+// Values
+//-----------------------------------------------------------------------------
+
+namespace values_suite
+{
+
+void test_empty()
+{
+    std::ostringstream result;
+    json::writer writer(result);
+    const int input[] = { 0 };
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.values(input, 0), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "[]");
+}
+
+void test_integer()
+{
+    std::ostringstream result;
+    json::writer writer(result);
+    const std::int64_t input[] = { 0, 1, -1, 42, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max() };
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.values(input, 6), 52);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "[0,1,-1,42,-9223372036854775808,9223372036854775807]");
+}
+
+void test_unsigned()
+{
+    std::ostringstream result;
+    json::writer writer(result);
+    const std::uint64_t input[] = { 0, std::numeric_limits<std::uint64_t>::max() };
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.values(input, 2), 24);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "[0,18446744073709551615]");
+}
+
+void test_bool()
+{
+    std::ostringstream result;
+    json::writer writer(result);
+    const bool input[] = { true, false };
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.values(input, 2), 12);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "[true,false]");
+}
+
+void test_real()
+{
+    std::ostringstream result;
+    json::writer writer(result);
+    const double input[] = { 0.5, std::numeric_limits<double>::infinity(), -2.0 };
+    writer.values(input, 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "[0.500000000000000,null,-2.00000000000000]");
+}
+
+void test_large()
+{
+    // Output is larger than the internal chunk
+    std::vector<std::int32_t> input;
+    std::ostringstream expected;
+    {
+        json::writer writer(expected);
+        writer.value<token::begin_array>();
+        for (std::int32_t i = 0; i < 1000; ++i)
+        {
+            input.push_back(i * 4099 - 2000000);
+            writer.value(input.back());
+        }
+        writer.value<token::end_array>();
+    }
+    std::ostringstream result;
+    json::writer writer(result);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.values(input.data(), input.size()), expected.str().size());
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), expected.str());
+}
+
+void test_nested()
+{
+    std::ostringstream result;
+    json::writer writer(result);
+    const int input[] = { 1, 2 };
+    writer.value<token::begin_object>();
+    writer.value("alpha");
+    writer.values(input, 2);
+    writer.value("bravo");
+    writer.value<token::begin_array>();
+    writer.values(input, 1);
+    writer.values(input, 2);
+    writer.value<token::end_array>();
+    writer.value<token::end_object>();
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "{\"alpha\":[1,2],\"bravo\":[[1],[1,2]]}");
+}
+
+void run()
+{
+    test_empty();
+    test_integer();
+    test_unsigned();
+    test_bool();
+    test_real();
+    test_large();
+    test_nested();
+}
+
+} // namespace values_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -390,6 +522,7 @@ int main()
     string_suite::run();
     array_suite::run();
     object_suite::run();
+    values_suite::run();
 
     return boost::report_errors();
 }